@@ -6,6 +6,7 @@ option(BUILD_PURE_ARM_COMPUTE "Build pure_arm_compute runtime" ON)
 option(BUILD_ACL_STATIC_LIB "Build ARM Comput Static Library" OFF)
 option(BUILD_BENCHMARK_ACL "Build ARM Compute Library Benchmarks" OFF)
 option(BUILD_NEURUN "Build neurun" OFF) #if implementation is done, it would replace nn runtime.
+option(BUILD_NEURUN_BENCHMARK "Build neurun micro benchmarks" OFF)
 option(BUILD_LABS "Build lab projects" ON)
 option(BUILD_ANDROID_NN_RUNTIME_TEST "Build Android NN Runtime Test" ON)
 option(BUILD_DETECTION_APP "Build detection example app" OFF)
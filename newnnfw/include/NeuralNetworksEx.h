@@ -60,6 +60,49 @@ int ANeuralNetworksModel_addOperationEx(ANeuralNetworksModel* model,
                                         const uint32_t* inputs, uint32_t outputCount,
                                         const uint32_t* outputs);
 
+/**
+ * Set the number of inputs which an execution of a compilation computes at once.
+ *
+ * The first dimension of every operand computed at runtime (i.e. every operand
+ * which is not a constant) is changed into the given batch size, so that the
+ * buffers given to {@link ANeuralNetworksExecution_setInput} and
+ * {@link ANeuralNetworksExecution_setOutput} have 'batch' inputs or outputs one
+ * after another. Weights are read once for the whole batch.
+ *
+ * This should be called before {@link ANeuralNetworksCompilation_finish}.
+ *
+ * @param compilation The compilation to be modified.
+ * @param batch The number of inputs computed at once. It should be positive.
+ *
+ * @return ANEURALNETWORKS_NO_ERROR if successful, ANEURALNETWORKS_BAD_DATA if
+ *         an operand computed at runtime has no batch dimension or if the
+ *         operands have batches of different sizes.
+ */
+int ANeuralNetworksCompilation_setBatchSizeEx(ANeuralNetworksCompilation* compilation,
+                                              uint32_t batch);
+
+/**
+ * Start recording when each operation runs and when inputs and outputs are copied.
+ *
+ * Events are kept in a ring buffer, so only the latest ones remain in a long run.
+ *
+ * @return ANEURALNETWORKS_NO_ERROR if successful.
+ */
+int ANeuralNetworksProfiler_startEx(void);
+
+/**
+ * Stop recording, and write the recorded events to a file.
+ *
+ * The file is written in the Chrome trace event format (JSON), which chrome://tracing
+ * shows. Each event has the operation type, the backend and the shapes of operands.
+ *
+ * @param path The path of the file to be written.
+ *
+ * @return ANEURALNETWORKS_NO_ERROR if successful, ANEURALNETWORKS_BAD_DATA if
+ *         the file cannot be written.
+ */
+int ANeuralNetworksProfiler_stopEx(const char* path);
+
 __END_DECLS
 
 #endif  // NN_RUNTIME_NEURAL_NETWORKS_EX_H
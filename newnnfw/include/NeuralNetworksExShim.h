@@ -57,4 +57,59 @@ inline int ANeuralNetworksModel_addOperationEx(
                           outputs);
 }
 
+typedef int (*ANeuralNetworksCompilation_setBatchSizeEx_fn)(
+    ANeuralNetworksCompilation *compilation, uint32_t batch);
+
+/**
+ * Set the number of inputs which an execution of a compilation computes at
+ * once.
+ *
+ * @param compilation The compilation to be modified.
+ * @param batch The number of inputs computed at once. It should be positive.
+ *
+ * See {@link ANeuralNetworksCompilation_setBatchSizeEx} in NeuralNetworksEx.h
+ * for details.
+ *
+ * @return ANEURALNETWORKS_NO_ERROR if successful.
+ */
+
+inline int ANeuralNetworksCompilation_setBatchSizeEx(
+    ANeuralNetworksCompilation *compilation, uint32_t batch) {
+  LOAD_FUNCTION(ANeuralNetworksCompilation_setBatchSizeEx);
+  EXECUTE_FUNCTION_RETURN(compilation, batch);
+}
+
+typedef int (*ANeuralNetworksProfiler_startEx_fn)(void);
+
+/**
+ * Start recording when each operation runs and when inputs and outputs are
+ * copied.
+ *
+ * See {@link ANeuralNetworksProfiler_startEx} in NeuralNetworksEx.h for details.
+ *
+ * @return ANEURALNETWORKS_NO_ERROR if successful.
+ */
+
+inline int ANeuralNetworksProfiler_startEx(void) {
+  LOAD_FUNCTION(ANeuralNetworksProfiler_startEx);
+  EXECUTE_FUNCTION_RETURN();
+}
+
+typedef int (*ANeuralNetworksProfiler_stopEx_fn)(const char *path);
+
+/**
+ * Stop recording, and write the recorded events to a file as a Chrome trace.
+ *
+ * @param path The path of the file to be written.
+ *
+ * See {@link ANeuralNetworksProfiler_stopEx} in NeuralNetworksEx.h for details.
+ *
+ * @return ANEURALNETWORKS_NO_ERROR if successful.
+ */
+
+inline int ANeuralNetworksProfiler_stopEx(const char *path) {
+  LOAD_FUNCTION(ANeuralNetworksProfiler_stopEx);
+  EXECUTE_FUNCTION_RETURN(path);
+}
+
 #endif // NN_API_EX_SHIM_H
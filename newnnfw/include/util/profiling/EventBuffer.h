@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_UTIL_PROFILING_EVENT_BUFFER_H__
+#define __NNFW_UTIL_PROFILING_EVENT_BUFFER_H__
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "util/profiling/profile_buffer.h"
+
+namespace nnfw
+{
+namespace util
+{
+namespace profiling
+{
+
+using EventType = ::tflite::profiling::ProfileEvent::EventType;
+
+struct Event
+{
+  // Label of the event, which should remain valid while the event is read
+  const char *tag;
+  uint64_t begin_timestamp_us;
+  // 0 if the event has not ended yet
+  uint64_t end_timestamp_us;
+  EventType event_type;
+  uint32_t event_metadata;
+  // Thread that has recorded the event (see EventBuffer::thread)
+  uint32_t thread;
+  // # of the enclosing events of the same thread
+  uint32_t depth;
+};
+
+// A ring buffer of the events that a single thread records
+//
+// Only the owner thread begins and ends events, and it never waits. Any other thread may read
+// events at the same time, and the events being written are skipped.
+class EventBuffer
+{
+public:
+  static constexpr uint64_t invalid_handle = ~static_cast<uint64_t>(0);
+
+public:
+  EventBuffer(uint32_t thread, uint32_t capacity);
+
+public:
+  uint32_t thread(void) const { return _thread; }
+
+public:
+  // NOTE Only the owner thread should call 'begin' and 'end', and events should end in the
+  //      reverse order of their beginning
+  uint64_t begin(const char *tag, EventType type, uint32_t metadata);
+  void end(uint64_t handle);
+
+public:
+  // Appends the events remaining in the buffer (from the oldest) to 'events'
+  void read(std::vector<Event> &events) const;
+  // Drops the events recorded so far
+  void clear(void);
+
+private:
+  // NOTE Each slot works as a seqlock. Its sequence number is odd while the owner writes it.
+  struct Slot
+  {
+    std::atomic<uint32_t> seq;
+    std::atomic<uint64_t> index;
+    std::atomic<const char *> tag;
+    std::atomic<uint64_t> begin_timestamp_us;
+    std::atomic<uint64_t> end_timestamp_us;
+    std::atomic<uint32_t> event_type;
+    std::atomic<uint32_t> event_metadata;
+    std::atomic<uint32_t> depth;
+  };
+
+private:
+  const uint32_t _thread;
+  const uint32_t _capacity;
+  std::unique_ptr<Slot[]> _slots;
+  // # of events that the owner has begun
+  std::atomic<uint64_t> _count;
+  // Events before this one have been cleared
+  std::atomic<uint64_t> _first;
+  // # of events that the owner has begun, but not ended
+  uint32_t _depth;
+};
+
+} // namespace profiling
+} // namespace util
+} // namespace nnfw
+
+#endif // __NNFW_UTIL_PROFILING_EVENT_BUFFER_H__
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_UTIL_PROFILING_OPERATION_COUNTERS_H__
+#define __NNFW_UTIL_PROFILING_OPERATION_COUNTERS_H__
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+
+#include "util/profiling/PerfCounters.h"
+#include "util/profiling/Roofline.h"
+
+namespace nnfw
+{
+namespace util
+{
+namespace profiling
+{
+
+// Accumulates the time and the hardware counts that each operation takes
+//
+// The counts are reported next to the time, so that an operation with a low IPC or many cache
+// misses per instruction stands out as memory-bound. Only the time is reported where hardware
+// counters are not available.
+class OperationCounters
+{
+public:
+  OperationCounters() : _enabled{false}
+  {
+    // DO NOTHING
+  }
+
+public:
+  void start(void) { _enabled.store(true, std::memory_order_relaxed); }
+  void stop(void) { _enabled.store(false, std::memory_order_relaxed); }
+  bool enabled(void) const { return _enabled.load(std::memory_order_relaxed); }
+
+public:
+  void add(uint32_t index, uint64_t elapsed_us, const PerfCounts &counts);
+  // NOTE This keeps the costs
+  void reset(void);
+
+public:
+  // Sets the estimated cost of a single run of an operation
+  void cost(uint32_t index, const OperationCost &cost);
+
+public:
+  // Writes a row per operation (in the order of indexes), with the averages of a single run
+  //
+  // 'name' returns the name of an operation (e.g. its type) from its index
+  void report(std::ostream &os, const std::function<std::string(uint32_t)> &name) const;
+  // Writes a roofline report (see Roofline) of the operations that have both time and cost
+  void roofline(std::ostream &os, const std::function<std::string(uint32_t)> &name,
+                double peak_gflops, double peak_gbps) const;
+
+private:
+  struct Entry
+  {
+    uint64_t calls;
+    uint64_t elapsed_us;
+    PerfCounts counts;
+  };
+
+private:
+  std::atomic<bool> _enabled;
+
+  mutable std::mutex _mutex;
+  std::map<uint32_t, Entry> _entries;
+  std::map<uint32_t, OperationCost> _costs;
+};
+
+// Measures an operation from its construction to its destruction on the current thread
+class ScopedOperationCounters
+{
+public:
+  ScopedOperationCounters(OperationCounters *counters, uint32_t index);
+  ~ScopedOperationCounters();
+
+public:
+  ScopedOperationCounters(const ScopedOperationCounters &) = delete;
+  ScopedOperationCounters &operator=(const ScopedOperationCounters &) = delete;
+
+private:
+  OperationCounters *const _counters;
+  const uint32_t _index;
+  uint64_t _begin_us;
+  PerfCounts _begin_counts;
+};
+
+} // namespace profiling
+} // namespace util
+} // namespace nnfw
+
+#endif // __NNFW_UTIL_PROFILING_OPERATION_COUNTERS_H__
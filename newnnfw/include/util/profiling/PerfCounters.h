@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_UTIL_PROFILING_PERF_COUNTERS_H__
+#define __NNFW_UTIL_PROFILING_PERF_COUNTERS_H__
+
+#include <cstdint>
+#include <vector>
+
+namespace nnfw
+{
+namespace util
+{
+namespace profiling
+{
+
+// Values of hardware counters
+struct PerfCounts
+{
+  enum Counter
+  {
+    CYCLES = 0,
+    INSTRUCTIONS,
+    CACHE_MISSES,
+    BRANCH_MISSES,
+    COUNT
+  };
+
+  uint64_t value[COUNT];
+  // Bit N is set if value[N] has been counted
+  uint32_t mask;
+};
+
+// Hardware counters of a thread (read with perf_event_open(2) on Linux)
+//
+// Each thread opens its own counters as they count only the events of the thread that has opened
+// them. A counter that the kernel or the CPU does not support (e.g. in a virtual machine, or with
+// a high perf_event_paranoid) is left out, and 'read' fails if no counter is left.
+class PerfCounters
+{
+public:
+  // Returns the counters of the calling thread, which are opened at the first call
+  static PerfCounters &thread(void);
+
+public:
+  PerfCounters();
+  ~PerfCounters();
+
+public:
+  PerfCounters(const PerfCounters &) = delete;
+  PerfCounters &operator=(const PerfCounters &) = delete;
+
+public:
+  bool available(void) const { return !_fds.empty(); }
+  bool available(PerfCounts::Counter counter) const { return _positions[counter] >= 0; }
+
+public:
+  // Returns false (and clears 'counts') if no counter is available
+  bool read(PerfCounts &counts) const;
+
+private:
+  // The first counter leads the group, so that all counters are read at once
+  std::vector<int> _fds;
+  // Position of each counter in the group (-1 if it is not available)
+  int _positions[PerfCounts::COUNT];
+};
+
+// Counts between 'begin' and 'end' (only the counters that both have counted are kept)
+PerfCounts operator-(const PerfCounts &end, const PerfCounts &begin);
+
+} // namespace profiling
+} // namespace util
+} // namespace nnfw
+
+#endif // __NNFW_UTIL_PROFILING_PERF_COUNTERS_H__
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_UTIL_PROFILING_PHASE_REPORT_H__
+#define __NNFW_UTIL_PROFILING_PHASE_REPORT_H__
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace nnfw
+{
+namespace util
+{
+namespace profiling
+{
+
+// Time and memory that each phase of a job (e.g. compiling a model) takes
+//
+// A phase that runs several times (e.g. once per operation) is accumulated in a single row, and
+// rows are listed in the order their phases first begin. A phase named "outer/inner" is a part of
+// the "outer" phase, so only phases without '/' add up to the total.
+//
+// Memory is the growth of the resident set size over a phase, which also covers the memory that
+// does not come from the heap (e.g. mapped device buffers). Memory released within a phase is not
+// seen, and pages that a later phase touches first are counted by the later one.
+//
+// NOTE This class is not thread-safe
+class PhaseReport
+{
+public:
+  struct Phase
+  {
+    std::string name;
+    uint32_t runs;
+    uint64_t elapsed_us;
+    // Growth of the resident set size (negative if the phase released memory)
+    int64_t resident_bytes;
+    // Bytes that the phase reports to have allocated (e.g. tensor buffers)
+    uint64_t allocated_bytes;
+  };
+
+public:
+  // Reserves the row of 'name' so that it precedes the phases that run within it
+  void declare(const std::string &name);
+  void add(const std::string &name, uint64_t elapsed_us, int64_t resident_bytes);
+  void allocate(const std::string &name, uint64_t bytes);
+  void clear(void) { _phases.clear(); }
+
+public:
+  const std::vector<Phase> &phases(void) const { return _phases; }
+  // Returns nullptr if 'name' has never run
+  const Phase *find(const std::string &name) const;
+
+public:
+  void report(std::ostream &os) const;
+
+private:
+  Phase &at(const std::string &name);
+
+private:
+  std::vector<Phase> _phases;
+};
+
+// Resident set size of this process in bytes (0 if unknown)
+uint64_t residentBytes(void);
+
+// Adds the time and the memory from its construction to its destruction to a phase
+class ScopedPhase
+{
+public:
+  // Does nothing if 'report' is nullptr
+  ScopedPhase(PhaseReport *report, const std::string &name);
+  ~ScopedPhase() { end(); }
+
+public:
+  // Ends the phase before the end of the scope (does nothing if it has already ended)
+  void end(void);
+
+public:
+  ScopedPhase(const ScopedPhase &) = delete;
+  ScopedPhase &operator=(const ScopedPhase &) = delete;
+
+private:
+  PhaseReport *_report;
+  std::string _name;
+  uint64_t _begin_us;
+  uint64_t _begin_resident;
+};
+
+} // namespace profiling
+} // namespace util
+} // namespace nnfw
+
+#endif // __NNFW_UTIL_PROFILING_PHASE_REPORT_H__
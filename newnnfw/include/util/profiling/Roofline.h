@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_UTIL_PROFILING_ROOFLINE_H__
+#define __NNFW_UTIL_PROFILING_ROOFLINE_H__
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace nnfw
+{
+namespace util
+{
+namespace profiling
+{
+
+// Arithmetic work and memory traffic of a single run of an operation, estimated from shapes
+struct OperationCost
+{
+  // # of multiply-accumulates (each of which is 2 FLOPs)
+  uint64_t macs;
+  // # of the other arithmetic operations (e.g. comparisons of max pooling)
+  uint64_t ops;
+  // Bytes of constants (weights, biases) read
+  uint64_t weight_bytes;
+  // Bytes of activations read
+  uint64_t input_bytes;
+  // Bytes written
+  uint64_t output_bytes;
+
+  uint64_t flops(void) const { return 2 * macs + ops; }
+  uint64_t bytes(void) const { return weight_bytes + input_bytes + output_bytes; }
+};
+
+// Compares the throughput of each operation with what its arithmetic intensity allows
+//
+// An operation is bounded by either the peak compute or the peak bandwidth times its arithmetic
+// intensity (FLOPs per byte), whichever is lower. The report shows the achieved GFLOP/s and GB/s
+// of each operation, and, if the peaks are known, how much time each operation loses against
+// its bound. Operations that lose the most come first in the summary.
+class Roofline
+{
+public:
+  // 'peak_gflops' and 'peak_gbps' are the peaks of the machine (0 if unknown)
+  Roofline(double peak_gflops, double peak_gbps);
+
+public:
+  // 'elapsed_us' is the total time of 'calls' runs
+  void add(const std::string &name, const OperationCost &cost, uint64_t calls,
+           uint64_t elapsed_us);
+
+public:
+  void report(std::ostream &os) const;
+
+private:
+  struct Row
+  {
+    std::string name;
+    OperationCost cost;
+    // Average time of a single run
+    double time_us;
+  };
+
+private:
+  // Time that 'row' would take at its bound (0 if the peaks are unknown)
+  double boundTime(const Row &row) const;
+
+private:
+  const double _peak_gflops;
+  const double _peak_gbps;
+  std::vector<Row> _rows;
+};
+
+} // namespace profiling
+} // namespace util
+} // namespace nnfw
+
+#endif // __NNFW_UTIL_PROFILING_ROOFLINE_H__
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_UTIL_PROFILING_TRACER_H__
+#define __NNFW_UTIL_PROFILING_TRACER_H__
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "util/profiling/EventBuffer.h"
+
+namespace nnfw
+{
+namespace util
+{
+namespace profiling
+{
+
+// Collects events from any number of threads, and merges them into a single timeline
+//
+// Each thread records events into its own EventBuffer, so recording takes neither a lock nor
+// a shared cache line once the thread has recorded its first event. Events may nest.
+//
+// NOTE tflite::profiling::Profiler (profiler.h) is single-threaded, and its layout is shared with
+//      TensorFlow Lite (tflite_benchmark_model passes the profiler of an interpreter to a runtime).
+//      Use this class when events are recorded from several threads.
+//
+// Example:
+//
+//   Tracer tracer;
+//   tracer.start();
+//   {
+//     ScopedEvent event{&tracer, "DoWork"};
+//     ...
+//   }
+//   tracer.stop();
+//   auto events = tracer.collect();
+class Tracer
+{
+public:
+  // 'capacity' is the # of events that each thread keeps
+  explicit Tracer(uint32_t capacity = 4096);
+
+public:
+  Tracer(const Tracer &) = delete;
+  Tracer &operator=(const Tracer &) = delete;
+
+public:
+  void start(void) { _enabled.store(true, std::memory_order_relaxed); }
+  void stop(void) { _enabled.store(false, std::memory_order_relaxed); }
+  bool enabled(void) const { return _enabled.load(std::memory_order_relaxed); }
+
+public:
+  // Returns EventBuffer::invalid_handle if the tracer is disabled
+  uint64_t begin(const char *tag, EventType type = EventType::DEFAULT, uint32_t metadata = 0);
+  // NOTE An event should end on the thread that has begun it
+  void end(uint64_t handle);
+
+public:
+  // Returns the events of every thread in the order of their beginning
+  //
+  // NOTE This may be called while other threads record events
+  std::vector<Event> collect(void) const;
+  // Drops the events recorded so far
+  void clear(void);
+
+private:
+  EventBuffer &buffer(void);
+
+private:
+  // Distinguishes tracers in the per-thread cache (addresses may be reused)
+  const uint64_t _id;
+  const uint32_t _capacity;
+  std::atomic<bool> _enabled;
+
+  mutable std::mutex _mutex;
+  std::vector<std::unique_ptr<EventBuffer>> _buffers;
+  // NOTE A thread that has the id of an exited thread takes over its buffer
+  std::unordered_map<std::thread::id, EventBuffer *> _threads;
+};
+
+// Records an event from its construction to its destruction
+class ScopedEvent
+{
+public:
+  ScopedEvent(Tracer *tracer, const char *tag, EventType type = EventType::DEFAULT,
+              uint32_t metadata = 0)
+      : _tracer{(tracer != nullptr && tracer->enabled()) ? tracer : nullptr},
+        _handle{(_tracer != nullptr) ? _tracer->begin(tag, type, metadata)
+                                     : EventBuffer::invalid_handle}
+  {
+    // DO NOTHING
+  }
+
+public:
+  ~ScopedEvent()
+  {
+    if (_tracer != nullptr)
+    {
+      _tracer->end(_handle);
+    }
+  }
+
+public:
+  ScopedEvent(const ScopedEvent &) = delete;
+  ScopedEvent &operator=(const ScopedEvent &) = delete;
+
+private:
+  Tracer *const _tracer;
+  const uint64_t _handle;
+};
+
+} // namespace profiling
+} // namespace util
+} // namespace nnfw
+
+#endif // __NNFW_UTIL_PROFILING_TRACER_H__
@@ -99,8 +99,9 @@ class ProfileBuffer {
     event_buffer_[index].event_metadata = event_metadata;
     event_buffer_[index].begin_timestamp_us = timestamp;
     event_buffer_[index].end_timestamp_us = 0;
-    current_index_++;
-    return index;
+    // NOTE The handle is the position in the whole sequence of events (not in the ring) so that
+    //      EndEvent can tell whether the event has been overwritten
+    return current_index_++;
   }
 
   // Sets the enabled state of buffer to |enabled|
@@ -111,7 +112,7 @@ class ProfileBuffer {
   // operation has not effect.
   void EndEvent(uint32_t event_handle) {
     if (!enabled_ || event_handle == kInvalidEventHandle ||
-        event_handle > current_index_) {
+        event_handle >= current_index_) {
       return;
     }
     const uint32_t max_size = event_buffer_.size();
@@ -139,7 +140,7 @@ class ProfileBuffer {
   // Returns the profile event at the given index. If the index is invalid a
   // nullptr is returned. The return event may get overwritten if more events
   // are added to buffer.
-  const struct ProfileEvent* const At(int index) const {
+  const struct ProfileEvent* At(size_t index) const {
     size_t size = Size();
     if (index >= size) {
       return nullptr;
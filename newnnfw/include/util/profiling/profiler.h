@@ -47,6 +47,10 @@ class ScopedOperatorProfile;
 // kept as simple as possible. It is designed to be used only on a single
 // thread.
 //
+// NOTE nnfw::util::profiling::Tracer (Tracer.h) records events from several
+//      threads. This class keeps the layout of TensorFlow Lite's Profiler as
+//      an interpreter may pass its profiler to a runtime.
+//
 // Profiles are collected using Scoped*Profile objects that begin and end a
 // profile event.
 // An example usage is shown in the example below:
@@ -25,6 +25,17 @@ class Profiler; // forward declaration
 }
 }
 
+namespace nnfw
+{
+namespace util
+{
+namespace profiling
+{
+class OperationCounters; // forward declaration
+}
+}
+}
+
 namespace profiling
 {
 
@@ -56,16 +67,20 @@ namespace profiling
 class Context
 {
 public:
-  Context() : _sync(), _profiler(nullptr) {}
+  Context() : _sync(), _profiler(nullptr), _counters(nullptr) {}
 
 public:
   const Sync &sync(void) const { return _sync; }
   tflite::profiling::Profiler* getProfiler() { return _profiler; }
   void setProfiler(tflite::profiling::Profiler* p) { _profiler = p; }
+  // Time and hardware counts of each operation (nullptr if they are not measured)
+  nnfw::util::profiling::OperationCounters* getCounters() { return _counters; }
+  void setCounters(nnfw::util::profiling::OperationCounters* c) { _counters = c; }
 
 private:
   Sync _sync;
   tflite::profiling::Profiler* _profiler;
+  nnfw::util::profiling::OperationCounters* _counters;
 
 public:
   static Context &get(void)
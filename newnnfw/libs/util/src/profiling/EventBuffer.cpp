@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/profiling/EventBuffer.h"
+
+#include <cassert>
+
+#include "util/profiling/time.h"
+
+namespace nnfw
+{
+namespace util
+{
+namespace profiling
+{
+
+constexpr uint64_t EventBuffer::invalid_handle;
+
+EventBuffer::EventBuffer(uint32_t thread, uint32_t capacity)
+    : _thread{thread}, _capacity{capacity}, _slots{new Slot[capacity]}, _count{0}, _first{0},
+      _depth{0}
+{
+  assert(capacity > 0);
+
+  for (uint32_t n = 0; n < capacity; ++n)
+  {
+    _slots[n].seq.store(0, std::memory_order_relaxed);
+    _slots[n].index.store(invalid_handle, std::memory_order_relaxed);
+  }
+}
+
+uint64_t EventBuffer::begin(const char *tag, EventType type, uint32_t metadata)
+{
+  const uint64_t timestamp = ::tflite::profiling::time::NowMicros();
+
+  // NOTE '_count' is written only by the owner (this thread)
+  const uint64_t index = _count.load(std::memory_order_relaxed);
+  auto &slot = _slots[index % _capacity];
+
+  const uint32_t seq = slot.seq.load(std::memory_order_relaxed);
+  slot.seq.store(seq + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  slot.index.store(index, std::memory_order_relaxed);
+  slot.tag.store(tag, std::memory_order_relaxed);
+  slot.begin_timestamp_us.store(timestamp, std::memory_order_relaxed);
+  slot.end_timestamp_us.store(0, std::memory_order_relaxed);
+  slot.event_type.store(static_cast<uint32_t>(type), std::memory_order_relaxed);
+  slot.event_metadata.store(metadata, std::memory_order_relaxed);
+  slot.depth.store(_depth, std::memory_order_relaxed);
+
+  slot.seq.store(seq + 2, std::memory_order_release);
+  _count.store(index + 1, std::memory_order_release);
+
+  ++_depth;
+
+  return index;
+}
+
+void EventBuffer::end(uint64_t handle)
+{
+  if (handle == invalid_handle)
+  {
+    return;
+  }
+
+  const uint64_t timestamp = ::tflite::profiling::time::NowMicros();
+
+  assert(_depth > 0);
+  --_depth;
+
+  const uint64_t count = _count.load(std::memory_order_relaxed);
+
+  assert(handle < count);
+
+  // The event has been overwritten
+  if (count - handle > _capacity)
+  {
+    return;
+  }
+
+  auto &slot = _slots[handle % _capacity];
+
+  const uint32_t seq = slot.seq.load(std::memory_order_relaxed);
+  slot.seq.store(seq + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  slot.end_timestamp_us.store(timestamp, std::memory_order_relaxed);
+
+  slot.seq.store(seq + 2, std::memory_order_release);
+}
+
+void EventBuffer::read(std::vector<Event> &events) const
+{
+  const uint64_t count = _count.load(std::memory_order_acquire);
+  const uint64_t first = _first.load(std::memory_order_relaxed);
+
+  uint64_t index = (count > _capacity) ? count - _capacity : 0;
+
+  if (index < first)
+  {
+    index = first;
+  }
+
+  for (; index < count; ++index)
+  {
+    const auto &slot = _slots[index % _capacity];
+
+    const uint32_t seq = slot.seq.load(std::memory_order_acquire);
+
+    // The owner is writing the slot
+    if (seq % 2 == 1)
+    {
+      continue;
+    }
+
+    Event event;
+
+    event.tag = slot.tag.load(std::memory_order_relaxed);
+    event.begin_timestamp_us = slot.begin_timestamp_us.load(std::memory_order_relaxed);
+    event.end_timestamp_us = slot.end_timestamp_us.load(std::memory_order_relaxed);
+    event.event_type = static_cast<EventType>(slot.event_type.load(std::memory_order_relaxed));
+    event.event_metadata = slot.event_metadata.load(std::memory_order_relaxed);
+    event.thread = _thread;
+    event.depth = slot.depth.load(std::memory_order_relaxed);
+
+    const uint64_t slot_index = slot.index.load(std::memory_order_relaxed);
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    // The owner has written the slot while it is read, or a newer event has overwritten it
+    if (slot.seq.load(std::memory_order_relaxed) != seq || slot_index != index)
+    {
+      continue;
+    }
+
+    events.emplace_back(event);
+  }
+}
+
+void EventBuffer::clear(void)
+{
+  _first.store(_count.load(std::memory_order_acquire), std::memory_order_relaxed);
+}
+
+} // namespace profiling
+} // namespace util
+} // namespace nnfw
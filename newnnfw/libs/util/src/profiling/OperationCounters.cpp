@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/profiling/OperationCounters.h"
+
+#include <iomanip>
+
+#include "util/profiling/time.h"
+
+namespace
+{
+
+const char *counter_names[nnfw::util::profiling::PerfCounts::COUNT] = {
+    "cycles", "instructions", "cache-misses", "branch-misses"};
+
+} // namespace
+
+namespace nnfw
+{
+namespace util
+{
+namespace profiling
+{
+
+void OperationCounters::add(uint32_t index, uint64_t elapsed_us, const PerfCounts &counts)
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+
+  auto it = _entries.find(index);
+
+  if (it == _entries.end())
+  {
+    PerfCounts zero{};
+    zero.mask = counts.mask;
+
+    it = _entries.emplace(index, Entry{0, 0, zero}).first;
+  }
+
+  auto &entry = it->second;
+
+  entry.calls += 1;
+  entry.elapsed_us += elapsed_us;
+
+  // NOTE A counter is reported only if it has been counted in every call
+  entry.counts.mask &= counts.mask;
+
+  for (uint32_t n = 0; n < PerfCounts::COUNT; ++n)
+  {
+    entry.counts.value[n] += counts.value[n];
+  }
+}
+
+void OperationCounters::reset(void)
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  _entries.clear();
+}
+
+void OperationCounters::cost(uint32_t index, const OperationCost &cost)
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  _costs[index] = cost;
+}
+
+void OperationCounters::roofline(std::ostream &os,
+                                 const std::function<std::string(uint32_t)> &name,
+                                 double peak_gflops, double peak_gbps) const
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+
+  Roofline roofline{peak_gflops, peak_gbps};
+
+  for (const auto &it : _entries)
+  {
+    auto cost = _costs.find(it.first);
+
+    if (cost != _costs.end())
+    {
+      roofline.add(std::to_string(it.first) + " " + name(it.first), cost->second,
+                   it.second.calls, it.second.elapsed_us);
+    }
+  }
+
+  roofline.report(os);
+}
+
+void OperationCounters::report(std::ostream &os,
+                               const std::function<std::string(uint32_t)> &name) const
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+
+  // Show the counters that have been counted for some operation
+  uint32_t mask = 0;
+
+  for (const auto &it : _entries)
+  {
+    mask |= it.second.counts.mask;
+  }
+
+  os << std::setw(6) << "index" << " " << std::setw(24) << std::left << "operation" << std::right
+     << std::setw(8) << "calls" << std::setw(14) << "time(us)";
+
+  for (uint32_t n = 0; n < PerfCounts::COUNT; ++n)
+  {
+    if (mask & (1u << n))
+    {
+      os << std::setw(16) << counter_names[n];
+    }
+  }
+
+  const uint32_t ipc_mask = (1u << PerfCounts::CYCLES) | (1u << PerfCounts::INSTRUCTIONS);
+
+  if ((mask & ipc_mask) == ipc_mask)
+  {
+    os << std::setw(8) << "IPC";
+  }
+
+  os << std::endl;
+
+  for (const auto &it : _entries)
+  {
+    const auto &entry = it.second;
+    const auto calls = entry.calls;
+
+    os << std::setw(6) << it.first << " " << std::setw(24) << std::left << name(it.first)
+       << std::right << std::setw(8) << calls << std::setw(14) << std::fixed
+       << std::setprecision(1) << static_cast<double>(entry.elapsed_us) / calls;
+
+    for (uint32_t n = 0; n < PerfCounts::COUNT; ++n)
+    {
+      if (!(mask & (1u << n)))
+      {
+        continue;
+      }
+
+      if (entry.counts.mask & (1u << n))
+      {
+        os << std::setw(16) << entry.counts.value[n] / calls;
+      }
+      else
+      {
+        os << std::setw(16) << "-";
+      }
+    }
+
+    if ((mask & ipc_mask) == ipc_mask)
+    {
+      const auto cycles = entry.counts.value[PerfCounts::CYCLES];
+      const auto instructions = entry.counts.value[PerfCounts::INSTRUCTIONS];
+
+      if ((entry.counts.mask & ipc_mask) == ipc_mask && cycles > 0)
+      {
+        os << std::setw(8) << std::setprecision(2) << static_cast<double>(instructions) / cycles;
+      }
+      else
+      {
+        os << std::setw(8) << "-";
+      }
+    }
+
+    os << std::endl;
+  }
+}
+
+ScopedOperationCounters::ScopedOperationCounters(OperationCounters *counters, uint32_t index)
+    : _counters{(counters != nullptr && counters->enabled()) ? counters : nullptr}, _index{index},
+      _begin_us{0}
+{
+  if (_counters != nullptr)
+  {
+    PerfCounters::thread().read(_begin_counts);
+    _begin_us = ::tflite::profiling::time::NowMicros();
+  }
+}
+
+ScopedOperationCounters::~ScopedOperationCounters()
+{
+  if (_counters != nullptr)
+  {
+    const auto end_us = ::tflite::profiling::time::NowMicros();
+
+    PerfCounts end_counts;
+    PerfCounters::thread().read(end_counts);
+
+    _counters->add(_index, end_us - _begin_us, end_counts - _begin_counts);
+  }
+}
+
+} // namespace profiling
+} // namespace util
+} // namespace nnfw
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/profiling/PerfCounters.h"
+
+#include <cstring>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+
+#ifdef __linux__
+
+int open_counter(uint64_t config, int group)
+{
+  perf_event_attr attr;
+
+  memset(&attr, 0, sizeof(attr));
+
+  attr.size = sizeof(attr);
+  attr.type = PERF_TYPE_HARDWARE;
+  attr.config = config;
+  // NOTE The leader starts disabled, and enables the whole group once every counter is opened
+  attr.disabled = (group == -1) ? 1 : 0;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  attr.read_format = PERF_FORMAT_GROUP;
+
+  // Count the calling thread on any CPU
+  return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, group, 0));
+}
+
+#endif
+
+} // namespace
+
+namespace nnfw
+{
+namespace util
+{
+namespace profiling
+{
+
+PerfCounters &PerfCounters::thread(void)
+{
+  static thread_local PerfCounters counters;
+  return counters;
+}
+
+PerfCounters::PerfCounters()
+{
+  for (uint32_t n = 0; n < PerfCounts::COUNT; ++n)
+  {
+    _positions[n] = -1;
+  }
+
+#ifdef __linux__
+  const uint64_t configs[PerfCounts::COUNT] = {PERF_COUNT_HW_CPU_CYCLES,
+                                               PERF_COUNT_HW_INSTRUCTIONS,
+                                               PERF_COUNT_HW_CACHE_MISSES,
+                                               PERF_COUNT_HW_BRANCH_MISSES};
+
+  for (uint32_t n = 0; n < PerfCounts::COUNT; ++n)
+  {
+    const int fd = open_counter(configs[n], _fds.empty() ? -1 : _fds.front());
+
+    if (fd >= 0)
+    {
+      _positions[n] = static_cast<int>(_fds.size());
+      _fds.emplace_back(fd);
+    }
+  }
+
+  if (!_fds.empty())
+  {
+    ioctl(_fds.front(), PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(_fds.front(), PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+  }
+#endif
+}
+
+PerfCounters::~PerfCounters()
+{
+#ifdef __linux__
+  for (auto fd : _fds)
+  {
+    close(fd);
+  }
+#endif
+}
+
+bool PerfCounters::read(PerfCounts &counts) const
+{
+  memset(&counts, 0, sizeof(counts));
+
+#ifdef __linux__
+  if (_fds.empty())
+  {
+    return false;
+  }
+
+  // NOTE The group is read as the # of counters followed by their values
+  uint64_t values[1 + PerfCounts::COUNT];
+
+  const auto size = static_cast<ssize_t>(sizeof(uint64_t) * (1 + _fds.size()));
+
+  if (::read(_fds.front(), values, size) != size)
+  {
+    return false;
+  }
+
+  for (uint32_t n = 0; n < PerfCounts::COUNT; ++n)
+  {
+    if (_positions[n] >= 0)
+    {
+      counts.value[n] = values[1 + _positions[n]];
+      counts.mask |= (1u << n);
+    }
+  }
+
+  return true;
+#else
+  return false;
+#endif
+}
+
+PerfCounts operator-(const PerfCounts &end, const PerfCounts &begin)
+{
+  PerfCounts counts;
+
+  counts.mask = end.mask & begin.mask;
+
+  for (uint32_t n = 0; n < PerfCounts::COUNT; ++n)
+  {
+    counts.value[n] = (counts.mask & (1u << n)) ? end.value[n] - begin.value[n] : 0;
+  }
+
+  return counts;
+}
+
+} // namespace profiling
+} // namespace util
+} // namespace nnfw
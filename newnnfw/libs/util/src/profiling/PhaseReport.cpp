@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/profiling/PhaseReport.h"
+#include "util/profiling/time.h"
+
+#include <fstream>
+#include <iomanip>
+
+#include <unistd.h>
+
+namespace
+{
+
+// # of phases that 'name' is nested in
+size_t depth(const std::string &name)
+{
+  size_t count = 0;
+
+  for (auto c : name)
+  {
+    count += (c == '/') ? 1 : 0;
+  }
+
+  return count;
+}
+
+} // namespace
+
+namespace nnfw
+{
+namespace util
+{
+namespace profiling
+{
+
+PhaseReport::Phase &PhaseReport::at(const std::string &name)
+{
+  for (auto &phase : _phases)
+  {
+    if (phase.name == name)
+    {
+      return phase;
+    }
+  }
+
+  _phases.emplace_back(Phase{name, 0, 0, 0, 0});
+  return _phases.back();
+}
+
+void PhaseReport::declare(const std::string &name) { at(name); }
+
+void PhaseReport::add(const std::string &name, uint64_t elapsed_us, int64_t resident_bytes)
+{
+  auto &phase = at(name);
+
+  phase.runs += 1;
+  phase.elapsed_us += elapsed_us;
+  phase.resident_bytes += resident_bytes;
+}
+
+void PhaseReport::allocate(const std::string &name, uint64_t bytes)
+{
+  at(name).allocated_bytes += bytes;
+}
+
+const PhaseReport::Phase *PhaseReport::find(const std::string &name) const
+{
+  for (const auto &phase : _phases)
+  {
+    if (phase.name == name)
+    {
+      return &phase;
+    }
+  }
+
+  return nullptr;
+}
+
+void PhaseReport::report(std::ostream &os) const
+{
+  os << std::fixed;
+
+  os << std::setw(40) << std::left << "phase" << std::right << std::setw(8) << "runs"
+     << std::setw(12) << "time(us)" << std::setw(14) << "resident(KB)" << std::setw(15)
+     << "allocated(KB)" << std::endl;
+
+  uint64_t total_us = 0;
+  int64_t total_resident = 0;
+  uint64_t total_allocated = 0;
+
+  for (const auto &phase : _phases)
+  {
+    // Show the innermost name below its outer phase
+    const auto level = depth(phase.name);
+    const auto label = std::string(2 * level, ' ') + phase.name.substr(phase.name.rfind('/') + 1);
+
+    os << std::setw(40) << std::left << label << std::right << std::setw(8) << phase.runs
+       << std::setw(12) << phase.elapsed_us << std::setprecision(1) << std::setw(14)
+       << phase.resident_bytes / 1024.0 << std::setw(15) << phase.allocated_bytes / 1024.0
+       << std::endl;
+
+    if (level == 0)
+    {
+      total_us += phase.elapsed_us;
+      total_resident += phase.resident_bytes;
+      total_allocated += phase.allocated_bytes;
+    }
+  }
+
+  os << "total: " << total_us << " us, " << std::setprecision(1) << total_resident / 1024.0
+     << " KB resident, " << total_allocated / 1024.0 << " KB allocated" << std::endl;
+}
+
+uint64_t residentBytes(void)
+{
+  // NOTE The second field of statm is the resident set size in pages
+  std::ifstream statm{"/proc/self/statm"};
+
+  uint64_t size = 0;
+  uint64_t resident = 0;
+
+  if (!(statm >> size >> resident))
+  {
+    return 0;
+  }
+
+  return resident * static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+}
+
+ScopedPhase::ScopedPhase(PhaseReport *report, const std::string &name)
+    : _report{report}, _begin_us{0}, _begin_resident{0}
+{
+  if (_report == nullptr)
+  {
+    return;
+  }
+
+  _name = name;
+  _report->declare(_name);
+
+  _begin_resident = residentBytes();
+  _begin_us = tflite::profiling::time::NowMicros();
+}
+
+void ScopedPhase::end(void)
+{
+  if (_report == nullptr)
+  {
+    return;
+  }
+
+  const auto end_us = tflite::profiling::time::NowMicros();
+  const auto end_resident = residentBytes();
+
+  _report->add(_name, end_us - _begin_us,
+               static_cast<int64_t>(end_resident) - static_cast<int64_t>(_begin_resident));
+
+  _report = nullptr;
+}
+
+} // namespace profiling
+} // namespace util
+} // namespace nnfw
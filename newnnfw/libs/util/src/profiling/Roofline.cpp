@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/profiling/Roofline.h"
+
+#include <algorithm>
+#include <iomanip>
+
+namespace
+{
+
+// FLOPs (or bytes) per microsecond into G/s
+double giga_per_second(double count, double time_us)
+{
+  return (time_us > 0) ? count / time_us / 1e3 : 0;
+}
+
+} // namespace
+
+namespace nnfw
+{
+namespace util
+{
+namespace profiling
+{
+
+Roofline::Roofline(double peak_gflops, double peak_gbps)
+    : _peak_gflops{peak_gflops}, _peak_gbps{peak_gbps}
+{
+  // DO NOTHING
+}
+
+void Roofline::add(const std::string &name, const OperationCost &cost, uint64_t calls,
+                   uint64_t elapsed_us)
+{
+  if (calls == 0)
+  {
+    return;
+  }
+
+  _rows.emplace_back(Row{name, cost, static_cast<double>(elapsed_us) / calls});
+}
+
+double Roofline::boundTime(const Row &row) const
+{
+  if (_peak_gflops <= 0 || _peak_gbps <= 0)
+  {
+    return 0;
+  }
+
+  // NOTE 1 GFLOP/s (or GB/s) is 1e3 FLOPs (or bytes) per microsecond
+  const double compute_us = row.cost.flops() / (_peak_gflops * 1e3);
+  const double memory_us = row.cost.bytes() / (_peak_gbps * 1e3);
+
+  return std::max(compute_us, memory_us);
+}
+
+void Roofline::report(std::ostream &os) const
+{
+  const bool bounded = (_peak_gflops > 0 && _peak_gbps > 0);
+
+  os << std::fixed;
+
+  os << std::setw(32) << std::left << "operation" << std::right << std::setw(12) << "MMACs"
+     << std::setw(12) << "weight(KB)" << std::setw(12) << "input(KB)" << std::setw(12)
+     << "output(KB)" << std::setw(10) << "FLOP/B" << std::setw(12) << "time(us)" << std::setw(10)
+     << "GFLOP/s" << std::setw(10) << "GB/s";
+
+  if (bounded)
+  {
+    os << std::setw(10) << "bound(%)";
+  }
+
+  os << std::endl;
+
+  OperationCost total{0, 0, 0, 0, 0};
+  double total_us = 0;
+
+  for (const auto &row : _rows)
+  {
+    const auto &cost = row.cost;
+
+    os << std::setw(32) << std::left << row.name << std::right << std::setprecision(2)
+       << std::setw(12) << cost.macs / 1e6 << std::setw(12) << cost.weight_bytes / 1024.0
+       << std::setw(12) << cost.input_bytes / 1024.0 << std::setw(12)
+       << cost.output_bytes / 1024.0 << std::setw(10)
+       << ((cost.bytes() > 0) ? static_cast<double>(cost.flops()) / cost.bytes() : 0)
+       << std::setprecision(1) << std::setw(12) << row.time_us << std::setprecision(2)
+       << std::setw(10) << giga_per_second(cost.flops(), row.time_us) << std::setw(10)
+       << giga_per_second(cost.bytes(), row.time_us);
+
+    if (bounded)
+    {
+      const double ratio = (row.time_us > 0) ? boundTime(row) / row.time_us : 0;
+      os << std::setprecision(1) << std::setw(10) << 100 * ratio;
+    }
+
+    os << std::endl;
+
+    total.macs += cost.macs;
+    total.ops += cost.ops;
+    total.weight_bytes += cost.weight_bytes;
+    total.input_bytes += cost.input_bytes;
+    total.output_bytes += cost.output_bytes;
+    total_us += row.time_us;
+  }
+
+  os << std::setprecision(2);
+  os << "total: " << total.macs / 1e6 << " MMACs, " << total.bytes() / 1048576.0 << " MB, "
+     << std::setprecision(1) << total_us << " us, " << std::setprecision(2)
+     << giga_per_second(total.flops(), total_us) << " GFLOP/s, "
+     << giga_per_second(total.bytes(), total_us) << " GB/s" << std::endl;
+
+  if (!bounded)
+  {
+    return;
+  }
+
+  // List the operations that lose the most time against their bounds
+  std::vector<std::pair<double, const Row *>> losses;
+
+  for (const auto &row : _rows)
+  {
+    losses.emplace_back(row.time_us - boundTime(row), &row);
+  }
+
+  std::sort(losses.begin(), losses.end(),
+            [](const std::pair<double, const Row *> &lhs,
+               const std::pair<double, const Row *> &rhs) { return lhs.first > rhs.first; });
+
+  const size_t count = std::min<size_t>(losses.size(), 5);
+
+  os << "furthest from the bound (peak " << _peak_gflops << " GFLOP/s, " << _peak_gbps
+     << " GB/s):" << std::endl;
+
+  for (size_t n = 0; n < count; ++n)
+  {
+    os << "  " << losses.at(n).second->name << ": " << std::setprecision(1) << losses.at(n).first
+       << " us lost" << std::endl;
+  }
+}
+
+} // namespace profiling
+} // namespace util
+} // namespace nnfw
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/profiling/Tracer.h"
+
+#include <algorithm>
+#include <tuple>
+
+namespace
+{
+
+std::atomic<uint64_t> next_tracer_id{1};
+
+// The buffer of the tracer that the current thread has used last
+struct Cache
+{
+  uint64_t tracer;
+  nnfw::util::profiling::EventBuffer *buffer;
+};
+
+thread_local Cache cache{0, nullptr};
+
+} // namespace
+
+namespace nnfw
+{
+namespace util
+{
+namespace profiling
+{
+
+Tracer::Tracer(uint32_t capacity)
+    : _id{next_tracer_id.fetch_add(1)}, _capacity{capacity}, _enabled{false}
+{
+  // DO NOTHING
+}
+
+EventBuffer &Tracer::buffer(void)
+{
+  if (cache.tracer == _id)
+  {
+    return *cache.buffer;
+  }
+
+  // NOTE A thread takes this path when it records its first event, or when it switches tracers
+  std::lock_guard<std::mutex> lock{_mutex};
+
+  auto it = _threads.find(std::this_thread::get_id());
+
+  if (it == _threads.end())
+  {
+    _buffers.emplace_back(new EventBuffer{static_cast<uint32_t>(_buffers.size()), _capacity});
+    it = _threads.emplace(std::this_thread::get_id(), _buffers.back().get()).first;
+  }
+
+  cache.tracer = _id;
+  cache.buffer = it->second;
+
+  return *cache.buffer;
+}
+
+uint64_t Tracer::begin(const char *tag, EventType type, uint32_t metadata)
+{
+  if (!enabled())
+  {
+    return EventBuffer::invalid_handle;
+  }
+
+  return buffer().begin(tag, type, metadata);
+}
+
+void Tracer::end(uint64_t handle)
+{
+  if (handle == EventBuffer::invalid_handle)
+  {
+    return;
+  }
+
+  buffer().end(handle);
+}
+
+std::vector<Event> Tracer::collect(void) const
+{
+  std::vector<Event> events;
+
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+
+    for (const auto &buffer : _buffers)
+    {
+      buffer->read(events);
+    }
+  }
+
+  // NOTE An enclosing event comes before the events that it encloses
+  std::stable_sort(events.begin(), events.end(), [](const Event &lhs, const Event &rhs) {
+    return std::tie(lhs.begin_timestamp_us, lhs.thread, lhs.depth) <
+           std::tie(rhs.begin_timestamp_us, rhs.thread, rhs.depth);
+  });
+
+  return events;
+}
+
+void Tracer::clear(void)
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+
+  for (const auto &buffer : _buffers)
+  {
+    buffer->clear();
+  }
+}
+
+} // namespace profiling
+} // namespace util
+} // namespace nnfw
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/profiling/OperationCounters.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <sstream>
+
+using nnfw::util::profiling::OperationCounters;
+using nnfw::util::profiling::PerfCounters;
+using nnfw::util::profiling::PerfCounts;
+using nnfw::util::profiling::ScopedOperationCounters;
+
+TEST(nnfw_util_profiling_PerfCounters, read_or_fail)
+{
+  PerfCounters counters;
+
+  PerfCounts begin;
+  PerfCounts end;
+
+  // NOTE Hardware counters may be unavailable (e.g. in a virtual machine)
+  ASSERT_EQ(counters.read(begin), counters.available());
+
+  volatile uint64_t sum = 0;
+  for (uint32_t n = 0; n < 100000; ++n)
+  {
+    sum += n;
+  }
+
+  ASSERT_EQ(counters.read(end), counters.available());
+
+  const auto counts = end - begin;
+
+  for (uint32_t n = 0; n < PerfCounts::COUNT; ++n)
+  {
+    const auto counter = static_cast<PerfCounts::Counter>(n);
+    ASSERT_EQ(counters.available(counter), (counts.mask & (1u << n)) != 0);
+  }
+
+  if (counters.available(PerfCounts::INSTRUCTIONS))
+  {
+    ASSERT_GE(counts.value[PerfCounts::INSTRUCTIONS], 100000);
+  }
+}
+
+TEST(nnfw_util_profiling_OperationCounters, report_timing_without_counters)
+{
+  OperationCounters counters;
+
+  PerfCounts none{};
+
+  counters.start();
+  counters.add(1, 10, none);
+  counters.add(1, 30, none);
+  counters.add(0, 5, none);
+
+  std::stringstream ss;
+  counters.report(ss, [](uint32_t index) { return (index == 0) ? "CONV_2D" : "SOFTMAX"; });
+
+  const auto report = ss.str();
+
+  ASSERT_NE(report.find("CONV_2D"), std::string::npos);
+  ASSERT_NE(report.find("20.0"), std::string::npos);
+  ASSERT_LT(report.find("CONV_2D"), report.find("SOFTMAX"));
+  ASSERT_EQ(report.find("cycles"), std::string::npos);
+}
+
+TEST(nnfw_util_profiling_OperationCounters, measure_scope)
+{
+  OperationCounters counters;
+
+  {
+    ScopedOperationCounters scoped{&counters, 0};
+  }
+
+  counters.start();
+  {
+    ScopedOperationCounters scoped{&counters, 7};
+  }
+  counters.stop();
+
+  std::stringstream ss;
+  counters.report(ss, [](uint32_t) { return "OP"; });
+
+  // The header and a row for the operation 7
+  const auto report = ss.str();
+
+  ASSERT_EQ(std::count(report.begin(), report.end(), '\n'), 2);
+  ASSERT_NE(report.find("     7 OP"), std::string::npos);
+}
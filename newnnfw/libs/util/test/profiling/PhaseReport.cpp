@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/profiling/PhaseReport.h"
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <vector>
+
+using nnfw::util::profiling::PhaseReport;
+using nnfw::util::profiling::ScopedPhase;
+
+TEST(nnfw_util_profiling_PhaseReport, accumulate_runs)
+{
+  PhaseReport report;
+
+  report.declare("planner");
+  report.add("planner/configure", 100, 4096);
+  report.add("planner/configure", 200, 0);
+  report.add("planner", 500, 8192);
+  report.add("allocate", 50, 1024);
+  report.allocate("allocate", 2048);
+
+  ASSERT_EQ(report.phases().size(), 3);
+  // Outer phases come first even though they end last
+  ASSERT_EQ(report.phases().at(0).name, "planner");
+  ASSERT_EQ(report.phases().at(1).name, "planner/configure");
+
+  const auto configure = report.find("planner/configure");
+
+  ASSERT_NE(configure, nullptr);
+  ASSERT_EQ(configure->runs, 2);
+  ASSERT_EQ(configure->elapsed_us, 300);
+  ASSERT_EQ(configure->resident_bytes, 4096);
+  ASSERT_EQ(report.find("allocate")->allocated_bytes, 2048);
+  ASSERT_EQ(report.find("verify"), nullptr);
+
+  std::stringstream ss;
+  report.report(ss);
+
+  // Only outer phases add up to the total
+  ASSERT_NE(ss.str().find("total: 550 us, 9.0 KB resident, 2.0 KB allocated"),
+            std::string::npos);
+}
+
+TEST(nnfw_util_profiling_PhaseReport, scoped_phase)
+{
+  PhaseReport report;
+
+  // NOTE Memory released within a phase is not seen, so the buffer outlives the phases
+  std::vector<char> buffer;
+
+  {
+    ScopedPhase outer{&report, "initialize"};
+
+    {
+      ScopedPhase inner{&report, "initialize/weights"};
+
+      // Touch 4 MB so that the resident set grows
+      buffer.assign(4 * 1024 * 1024, 1);
+    }
+  }
+
+  {
+    // Disabled
+    ScopedPhase phase{nullptr, "verify"};
+  }
+
+  {
+    ScopedPhase phase{&report, "allocate"};
+    phase.end();
+    // Ended only once
+    phase.end();
+  }
+
+  ASSERT_EQ(report.phases().size(), 3);
+  ASSERT_EQ(report.find("allocate")->runs, 1);
+  ASSERT_EQ(report.phases().at(0).name, "initialize");
+  ASSERT_EQ(report.find("initialize")->runs, 1);
+  ASSERT_EQ(report.find("initialize/weights")->runs, 1);
+  ASSERT_GE(report.find("initialize")->elapsed_us, report.find("initialize/weights")->elapsed_us);
+  ASSERT_EQ(report.find("verify"), nullptr);
+
+  if (nnfw::util::profiling::residentBytes() > 0)
+  {
+    ASSERT_GT(report.find("initialize/weights")->resident_bytes, 0);
+  }
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/profiling/Roofline.h"
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+using nnfw::util::profiling::OperationCost;
+using nnfw::util::profiling::Roofline;
+
+TEST(nnfw_util_profiling_Roofline, report_throughput)
+{
+  // 1 MMACs (2 MFLOPs) and 1 MB in 1000 us (averaged over 2 runs)
+  const OperationCost cost{1000000, 0, 500000, 250000, 250000};
+
+  ASSERT_EQ(cost.flops(), 2000000);
+  ASSERT_EQ(cost.bytes(), 1000000);
+
+  Roofline roofline{0, 0};
+  roofline.add("CONV_2D", cost, 2, 2000);
+  roofline.add("NEVER_RUN", cost, 0, 0);
+
+  std::stringstream ss;
+  roofline.report(ss);
+
+  const auto report = ss.str();
+
+  ASSERT_NE(report.find("CONV_2D"), std::string::npos);
+  ASSERT_EQ(report.find("NEVER_RUN"), std::string::npos);
+  // 2 GFLOP/s and 1 GB/s
+  ASSERT_NE(report.find("total: 1.00 MMACs"), std::string::npos);
+  ASSERT_NE(report.find("2.00 GFLOP/s, 1.00 GB/s"), std::string::npos);
+  ASSERT_EQ(report.find("furthest"), std::string::npos);
+}
+
+TEST(nnfw_util_profiling_Roofline, list_operations_furthest_from_bound)
+{
+  // Compute-bound: 10 MFLOPs at 10 GFLOP/s takes 1000 us at best
+  const OperationCost compute{5000000, 0, 0, 1000, 1000};
+  // Memory-bound: 10 MB at 10 GB/s takes 1000 us at best
+  const OperationCost memory{0, 0, 0, 5000000, 5000000};
+
+  Roofline roofline{10, 10};
+  roofline.add("COMPUTE", compute, 1, 1100);
+  roofline.add("MEMORY", memory, 1, 4000);
+
+  std::stringstream ss;
+  roofline.report(ss);
+
+  const auto report = ss.str();
+  const auto furthest = report.find("furthest");
+
+  ASSERT_NE(furthest, std::string::npos);
+  ASSERT_LT(report.find("MEMORY: 3000.0 us lost", furthest),
+            report.find("COMPUTE: 100.0 us lost", furthest));
+}
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/profiling/Tracer.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstring>
+#include <set>
+#include <thread>
+#include <vector>
+
+using nnfw::util::profiling::Event;
+using nnfw::util::profiling::EventType;
+using nnfw::util::profiling::ScopedEvent;
+using nnfw::util::profiling::Tracer;
+
+TEST(nnfw_util_profiling_Tracer, record_nested_events)
+{
+  Tracer tracer;
+
+  tracer.start();
+  {
+    ScopedEvent outer{&tracer, "outer"};
+    {
+      ScopedEvent inner{&tracer, "inner", EventType::OPERATOR_INVOKE_EVENT, 3};
+    }
+  }
+  tracer.stop();
+
+  const auto events = tracer.collect();
+
+  ASSERT_EQ(events.size(), 2);
+
+  ASSERT_STREQ(events.at(0).tag, "outer");
+  ASSERT_EQ(events.at(0).depth, 0);
+
+  ASSERT_STREQ(events.at(1).tag, "inner");
+  ASSERT_EQ(events.at(1).depth, 1);
+  ASSERT_EQ(events.at(1).event_type, EventType::OPERATOR_INVOKE_EVENT);
+  ASSERT_EQ(events.at(1).event_metadata, 3);
+
+  ASSERT_LE(events.at(0).begin_timestamp_us, events.at(1).begin_timestamp_us);
+  ASSERT_GE(events.at(0).end_timestamp_us, events.at(1).end_timestamp_us);
+}
+
+TEST(nnfw_util_profiling_Tracer, skip_while_disabled)
+{
+  Tracer tracer;
+
+  {
+    ScopedEvent event{&tracer, "disabled"};
+  }
+  {
+    ScopedEvent event{nullptr, "no tracer"};
+  }
+
+  ASSERT_TRUE(tracer.collect().empty());
+}
+
+TEST(nnfw_util_profiling_Tracer, keep_latest_events)
+{
+  Tracer tracer{4};
+
+  tracer.start();
+  for (uint32_t n = 0; n < 10; ++n)
+  {
+    ScopedEvent event{&tracer, "event", EventType::DEFAULT, n};
+  }
+
+  const auto events = tracer.collect();
+
+  ASSERT_EQ(events.size(), 4);
+  for (uint32_t n = 0; n < 4; ++n)
+  {
+    ASSERT_EQ(events.at(n).event_metadata, 6 + n);
+    ASSERT_NE(events.at(n).end_timestamp_us, 0);
+  }
+
+  tracer.clear();
+  ASSERT_TRUE(tracer.collect().empty());
+}
+
+TEST(nnfw_util_profiling_Tracer, record_from_many_threads)
+{
+  const uint32_t writer_count = 16;
+  const uint32_t iteration = 1000;
+
+  // Each iteration records an outer and an inner event
+  Tracer tracer{2 * iteration};
+
+  const char *outer_tag = "outer";
+  const char *inner_tag = "inner";
+
+  std::atomic<bool> running{true};
+
+  tracer.start();
+
+  // Collect events while they are recorded
+  std::thread reader{[&] {
+    while (running)
+    {
+      for (const auto &event : tracer.collect())
+      {
+        ASSERT_TRUE(event.tag == outer_tag || event.tag == inner_tag);
+        ASSERT_TRUE(event.end_timestamp_us == 0 ||
+                    event.end_timestamp_us >= event.begin_timestamp_us);
+      }
+    }
+  }};
+
+  std::vector<std::thread> writers;
+
+  for (uint32_t w = 0; w < writer_count; ++w)
+  {
+    writers.emplace_back([&, w] {
+      for (uint32_t n = 0; n < iteration; ++n)
+      {
+        ScopedEvent outer{&tracer, outer_tag, EventType::DEFAULT, w};
+        ScopedEvent inner{&tracer, inner_tag, EventType::DEFAULT, w};
+      }
+    });
+  }
+
+  for (auto &writer : writers)
+  {
+    writer.join();
+  }
+
+  running = false;
+  reader.join();
+
+  tracer.stop();
+
+  const auto events = tracer.collect();
+
+  ASSERT_EQ(events.size(), writer_count * iteration * 2);
+
+  std::set<uint32_t> threads;
+  std::vector<uint32_t> counts(writer_count, 0);
+
+  for (uint32_t n = 0; n < events.size(); ++n)
+  {
+    const auto &event = events.at(n);
+
+    ASSERT_NE(event.end_timestamp_us, 0);
+    ASSERT_EQ(event.depth, (event.tag == outer_tag) ? 0 : 1);
+
+    if (n > 0)
+    {
+      ASSERT_LE(events.at(n - 1).begin_timestamp_us, event.begin_timestamp_us);
+    }
+
+    threads.insert(event.thread);
+    counts.at(event.event_metadata) += 1;
+  }
+
+  ASSERT_EQ(threads.size(), writer_count);
+
+  for (auto count : counts)
+  {
+    ASSERT_EQ(count, iteration * 2);
+  }
+}
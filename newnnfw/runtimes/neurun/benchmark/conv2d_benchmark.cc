@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+// Compares the CPU convolution algorithms for the 3x3 stride-1 layers of common networks
+//
+// usage: neurun_conv2d_benchmark [repeat count (default: 10)]
+//
+// NOTE Set NEURUN_NUM_THREADS to choose the number of threads
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "backend/cpu/operand/Tensor.h"
+#include "exec/SchedulingProfile.h"
+#include "kernel/cpu/ConvolutionLayer.h"
+#include "kernel/cpu/PackedGemm.h"
+#include "kernel/cpu/WinogradConvolutionLayer.h"
+#include "util/benchmark.h"
+
+using neurun::kernel::cpu::Shape;
+using Tensor = neurun::backend::cpu::operand::Tensor;
+
+namespace
+{
+
+struct Layer
+{
+  const char *name;
+  uint32_t height;
+  uint32_t width;
+  uint32_t depth;
+  uint32_t outDepth;
+};
+
+// 3x3 stride-1 SAME convolutions of VGG-16, ResNet-50 and Inception-v3
+const Layer layers[] = {
+    {"vgg16/conv1_2", 224, 224, 64, 64},   {"vgg16/conv2_2", 112, 112, 128, 128},
+    {"vgg16/conv3_2", 56, 56, 256, 256},   {"vgg16/conv4_2", 28, 28, 512, 512},
+    {"vgg16/conv5_2", 14, 14, 512, 512},   {"resnet50/res2_b", 56, 56, 64, 64},
+    {"resnet50/res3_b", 28, 28, 128, 128}, {"resnet50/res4_b", 14, 14, 256, 256},
+    {"resnet50/res5_b", 7, 7, 512, 512},   {"inception3/mixed_5b", 35, 35, 64, 96},
+    {"inception3/mixed_6b", 17, 17, 128, 128}};
+
+Shape makeShape(std::vector<uint32_t> dimensions)
+{
+  Shape shape;
+  shape.type = OperandType::TENSOR_FLOAT32;
+  shape.dimensions = dimensions;
+  shape.scale = 0.0f;
+  shape.offset = 0;
+  return shape;
+}
+
+std::vector<float> sequence(uint32_t size, uint32_t period)
+{
+  std::vector<float> values(size);
+  for (uint32_t n = 0; n < size; ++n)
+  {
+    values[n] = static_cast<float>(n % period) / period - 0.5f;
+  }
+  return values;
+}
+
+// Average milliseconds of 'fn->run()' over 'repeat' runs after a warm-up run
+double measure(::arm_compute::IFunction &fn, int repeat)
+{
+  fn.prepare();
+  fn.run();
+
+  std::chrono::microseconds elapsed{0};
+
+  for (int n = 0; n < repeat; ++n)
+  {
+    nnfw::util::benchmark::measure(elapsed) << [&](void) { fn.run(); };
+  }
+
+  return elapsed.count() / 1000.0 / repeat;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+  const int repeat = (argc > 1) ? std::atoi(argv[1]) : 10;
+
+  // Kernels run on the threads of the default profile, as they do in the runtime
+  using neurun::exec::SchedulingProfile;
+  SchedulingProfile::Scope scope{SchedulingProfile::get(SchedulingProfile::defaultPreference())};
+
+  std::cout << std::left << std::setw(24) << "layer" << std::right << std::setw(12) << "im2col"
+            << std::setw(12) << "wino 2x2" << std::setw(12) << "wino 4x4" << std::setw(10)
+            << "speedup" << std::endl;
+
+  for (const auto &layer : layers)
+  {
+    const auto inputShape = makeShape({1, layer.height, layer.width, layer.depth});
+    const auto kernelShape = makeShape({layer.outDepth, 3, 3, layer.depth});
+    const auto biasShape = makeShape({layer.outDepth});
+    const auto outputShape = makeShape({1, layer.height, layer.width, layer.outDepth});
+
+    auto input = sequence(layer.height * layer.width * layer.depth, 7);
+    auto kernel = sequence(layer.outDepth * 9 * layer.depth, 5);
+    auto bias = sequence(layer.outDepth, 3);
+    std::vector<float> packed(kernel.size());
+    std::vector<float> output(layer.height * layer.width * layer.outDepth);
+
+    // NOTE ConvolutionLayer takes the kernel packed by InitializerGenerator
+    neurun::kernel::cpu::packWeights(kernel.data(), layer.outDepth, 9 * layer.depth,
+                                     packed.data());
+
+    Tensor input_tensor{reinterpret_cast<uint8_t *>(input.data())};
+    Tensor kernel_tensor{reinterpret_cast<uint8_t *>(kernel.data())};
+    Tensor packed_tensor{reinterpret_cast<uint8_t *>(packed.data())};
+    Tensor bias_tensor{reinterpret_cast<uint8_t *>(bias.data())};
+    Tensor output_tensor{reinterpret_cast<uint8_t *>(output.data())};
+
+    neurun::kernel::cpu::ConvolutionLayer im2col;
+    im2col.configure(&input_tensor, inputShape, &packed_tensor, kernelShape, &bias_tensor,
+                     biasShape, 1, 1, 1, 1, 1, 1, ANEURALNETWORKS_FUSED_NONE, &output_tensor,
+                     outputShape);
+
+    double elapsed[3] = {measure(im2col, repeat), 0.0, 0.0};
+
+    for (uint32_t n = 1; n <= 2; ++n)
+    {
+      neurun::kernel::cpu::WinogradConvolutionLayer winograd;
+      winograd.configure(&input_tensor, inputShape, &kernel_tensor, kernelShape, &bias_tensor,
+                         biasShape, 1, 1, ANEURALNETWORKS_FUSED_NONE, &output_tensor, outputShape,
+                         2 * n);
+      elapsed[n] = measure(winograd, repeat);
+    }
+
+    std::cout << std::left << std::setw(24) << layer.name << std::right << std::fixed
+              << std::setprecision(3) << std::setw(12) << elapsed[0] << std::setw(12)
+              << elapsed[1] << std::setw(12) << elapsed[2] << std::setw(9)
+              << elapsed[0] / std::min(elapsed[1], elapsed[2]) << "x" << std::endl;
+  }
+
+  return 0;
+}
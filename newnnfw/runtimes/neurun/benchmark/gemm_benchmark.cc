@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Compares the packed GEMM of the CPU backend with the Eigen GEMM of tflite::optimized_ops (which
+// the CPU backend used before) for the float convolution and fully connected layers
+//
+// usage: neurun_gemm_benchmark [repeat count (default: 10)]
+//
+// NOTE Set NEURUN_NUM_THREADS to choose the number of threads of the packed GEMM. Eigen runs on a
+//      single thread, so compare with NEURUN_NUM_THREADS=1.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include "tensorflow/contrib/lite/kernels/internal/optimized/optimized_ops.h"
+
+#include "backend/cpu/operand/Tensor.h"
+#include "exec/SchedulingProfile.h"
+#include "kernel/cpu/ConvolutionLayer.h"
+#include "kernel/cpu/FullyConnectedLayer.h"
+#include "kernel/cpu/OperationUtils.h"
+#include "kernel/cpu/PackedGemm.h"
+#include "util/benchmark.h"
+
+using neurun::kernel::cpu::Shape;
+using neurun::kernel::cpu::convertShapeToDims;
+using Tensor = neurun::backend::cpu::operand::Tensor;
+
+namespace
+{
+
+struct ConvLayer
+{
+  const char *name;
+  uint32_t height;
+  uint32_t width;
+  uint32_t depth;
+  uint32_t outDepth;
+  uint32_t kernelSize;
+  uint32_t stride;
+};
+
+// SAME convolutions of MobileNet, ResNet-50 and VGG-16 (1x1 ones do not need im2col)
+const ConvLayer convLayers[] = {{"mobilenet/conv_0", 224, 224, 3, 32, 3, 2},
+                                 {"mobilenet/conv_pw_3", 56, 56, 128, 128, 1, 1},
+                                 {"mobilenet/conv_pw_7", 14, 14, 512, 512, 1, 1},
+                                 {"resnet50/res3_b_2a", 28, 28, 512, 128, 1, 1},
+                                 {"resnet50/res4_b_2b", 14, 14, 256, 256, 3, 1},
+                                 {"vgg16/conv3_2", 56, 56, 256, 256, 3, 1},
+                                 {"vgg16/conv5_2", 14, 14, 512, 512, 3, 1}};
+
+struct FCLayer
+{
+  const char *name;
+  uint32_t batches;
+  uint32_t inputSize;
+  uint32_t units;
+};
+
+// NOTE 'xN' is a batch of N inputs
+const FCLayer fcLayers[] = {{"mobilenet/logits", 1, 1024, 1001},
+                            {"inception3/logits", 1, 2048, 1001},
+                            {"vgg16/fc7", 1, 4096, 4096},
+                            {"vgg16/fc7 x8", 8, 4096, 4096},
+                            {"mobilenet/logits x32", 32, 1024, 1001}};
+
+Shape makeShape(std::vector<uint32_t> dimensions)
+{
+  Shape shape;
+  shape.type = OperandType::TENSOR_FLOAT32;
+  shape.dimensions = dimensions;
+  shape.scale = 0.0f;
+  shape.offset = 0;
+  return shape;
+}
+
+std::vector<float> sequence(uint32_t size, uint32_t period)
+{
+  std::vector<float> values(size);
+  for (uint32_t n = 0; n < size; ++n)
+  {
+    values[n] = static_cast<float>(n % period) / period - 0.5f;
+  }
+  return values;
+}
+
+// Padding at the top (or left) of a SAME convolution
+//
+// NOTE Padding at the bottom (or right) may be larger by 1
+uint32_t samePadding(uint32_t in, uint32_t out, uint32_t kernel, uint32_t stride)
+{
+  return (std::max((out - 1) * stride + kernel, in) - in) / 2;
+}
+
+// Average milliseconds of 'fn' over 'repeat' runs after a warm-up run
+double measure(const std::function<void(void)> &fn, int repeat)
+{
+  fn();
+
+  std::chrono::microseconds elapsed{0};
+
+  for (int n = 0; n < repeat; ++n)
+  {
+    nnfw::util::benchmark::measure(elapsed) << fn;
+  }
+
+  return elapsed.count() / 1000.0 / repeat;
+}
+
+void printHeader(const char *title)
+{
+  std::cout << std::left << std::setw(24) << title << std::right << std::setw(12) << "eigen"
+            << std::setw(12) << "packed" << std::setw(10) << "speedup" << std::endl;
+}
+
+void printResult(const char *name, double eigen, double packed)
+{
+  std::cout << std::left << std::setw(24) << name << std::right << std::fixed
+            << std::setprecision(3) << std::setw(12) << eigen << std::setw(12) << packed
+            << std::setw(9) << eigen / packed << "x" << std::endl;
+}
+
+void benchmarkConv(const ConvLayer &layer, int repeat)
+{
+  const uint32_t outHeight = (layer.height + layer.stride - 1) / layer.stride;
+  const uint32_t outWidth = (layer.width + layer.stride - 1) / layer.stride;
+  const uint32_t patchSize = layer.kernelSize * layer.kernelSize * layer.depth;
+
+  const uint32_t padHeight = samePadding(layer.height, outHeight, layer.kernelSize, layer.stride);
+  const uint32_t padWidth = samePadding(layer.width, outWidth, layer.kernelSize, layer.stride);
+
+  const auto inputShape = makeShape({1, layer.height, layer.width, layer.depth});
+  const auto kernelShape =
+      makeShape({layer.outDepth, layer.kernelSize, layer.kernelSize, layer.depth});
+  const auto biasShape = makeShape({layer.outDepth});
+  const auto outputShape = makeShape({1, outHeight, outWidth, layer.outDepth});
+  const auto im2colShape = makeShape({1, outHeight, outWidth, patchSize});
+
+  auto input = sequence(layer.height * layer.width * layer.depth, 7);
+  auto kernel = sequence(layer.outDepth * patchSize, 5);
+  auto bias = sequence(layer.outDepth, 3);
+  std::vector<float> packed(kernel.size());
+  std::vector<float> im2col(outHeight * outWidth * patchSize);
+  std::vector<float> output(outHeight * outWidth * layer.outDepth);
+
+  // NOTE ConvolutionLayer takes the kernel packed by InitializerGenerator
+  neurun::kernel::cpu::packWeights(kernel.data(), layer.outDepth, patchSize, packed.data());
+
+  Tensor input_tensor{reinterpret_cast<uint8_t *>(input.data())};
+  Tensor packed_tensor{reinterpret_cast<uint8_t *>(packed.data())};
+  Tensor bias_tensor{reinterpret_cast<uint8_t *>(bias.data())};
+  Tensor output_tensor{reinterpret_cast<uint8_t *>(output.data())};
+
+  neurun::kernel::cpu::ConvolutionLayer conv;
+  conv.configure(&input_tensor, inputShape, &packed_tensor, kernelShape, &bias_tensor, biasShape,
+                 padWidth, padWidth, padHeight, padHeight, layer.stride, layer.stride,
+                 ANEURALNETWORKS_FUSED_RELU, &output_tensor, outputShape);
+
+  const double eigen = measure(
+      [&](void) {
+        ::tflite::optimized_ops::Conv(input.data(), convertShapeToDims(inputShape), kernel.data(),
+                                      convertShapeToDims(kernelShape), bias.data(),
+                                      convertShapeToDims(biasShape), layer.stride, layer.stride,
+                                      1, 1, padWidth, padHeight, 0.0f,
+                                      std::numeric_limits<float>::max(), output.data(),
+                                      convertShapeToDims(outputShape), im2col.data(),
+                                      convertShapeToDims(im2colShape));
+      },
+      repeat);
+  const double packed_gemm = measure([&](void) { conv.run(); }, repeat);
+
+  printResult(layer.name, eigen, packed_gemm);
+}
+
+void benchmarkFC(const FCLayer &layer, int repeat)
+{
+  const auto inputShape = makeShape({layer.batches, layer.inputSize});
+  const auto weightsShape = makeShape({layer.units, layer.inputSize});
+  const auto biasShape = makeShape({layer.units});
+  const auto outputShape = makeShape({layer.batches, layer.units});
+
+  auto input = sequence(layer.batches * layer.inputSize, 7);
+  auto weights = sequence(layer.units * layer.inputSize, 5);
+  auto bias = sequence(layer.units, 3);
+  std::vector<float> packed(weights.size());
+  std::vector<float> output(layer.batches * layer.units);
+
+  // NOTE FullyConnectedLayer takes the weights packed by InitializerGenerator
+  neurun::kernel::cpu::packWeights(weights.data(), layer.units, layer.inputSize, packed.data());
+
+  Tensor input_tensor{reinterpret_cast<uint8_t *>(input.data())};
+  Tensor packed_tensor{reinterpret_cast<uint8_t *>(packed.data())};
+  Tensor bias_tensor{reinterpret_cast<uint8_t *>(bias.data())};
+  Tensor output_tensor{reinterpret_cast<uint8_t *>(output.data())};
+
+  neurun::kernel::cpu::FullyConnectedLayer fc;
+  fc.configure(&input_tensor, inputShape, &packed_tensor, weightsShape, &bias_tensor, biasShape,
+               ANEURALNETWORKS_FUSED_RELU, &output_tensor, outputShape);
+
+  const double eigen = measure(
+      [&](void) {
+        ::tflite::optimized_ops::FullyConnected(
+            input.data(), convertShapeToDims(inputShape), weights.data(),
+            convertShapeToDims(weightsShape), bias.data(), convertShapeToDims(biasShape), 0.0f,
+            std::numeric_limits<float>::max(), output.data(), convertShapeToDims(outputShape));
+      },
+      repeat);
+  const double packed_gemm = measure([&](void) { fc.run(); }, repeat);
+
+  printResult(layer.name, eigen, packed_gemm);
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+  const int repeat = (argc > 1) ? std::atoi(argv[1]) : 10;
+
+  // Kernels run on the threads of the default profile, as they do in the runtime
+  using neurun::exec::SchedulingProfile;
+  SchedulingProfile::Scope scope{SchedulingProfile::get(SchedulingProfile::defaultPreference())};
+
+  printHeader("conv2d");
+  for (const auto &layer : convLayers)
+  {
+    benchmarkConv(layer, repeat);
+  }
+
+  printHeader("fully connected");
+  for (const auto &layer : fcLayers)
+  {
+    benchmarkFC(layer, repeat);
+  }
+
+  return 0;
+}
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+// Compares the scheduling profiles (see exec/SchedulingProfile.h) on the 3x3 convolutions of
+// ResNet-50, which are run one after another as in an inference
+//
+// usage: neurun_preference_benchmark [repeat count (default: 10)]
+//
+// NOTE 'cpu' is the CPU time of the process per inference, which includes the time that workers
+//      spend on spinning
+
+#include <chrono>
+#include <cstdlib>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "backend/cpu/operand/Tensor.h"
+#include "exec/SchedulingProfile.h"
+#include "kernel/cpu/WinogradConvolutionLayer.h"
+#include "util/benchmark.h"
+
+using neurun::exec::SchedulingProfile;
+using neurun::kernel::cpu::Shape;
+using Tensor = neurun::backend::cpu::operand::Tensor;
+
+namespace
+{
+
+struct Layer
+{
+  const char *name;
+  uint32_t height;
+  uint32_t width;
+  uint32_t depth;
+};
+
+// 3x3 stride-1 SAME convolutions of ResNet-50
+const Layer layers[] = {{"resnet50/res2_b", 56, 56, 64},
+                        {"resnet50/res3_b", 28, 28, 128},
+                        {"resnet50/res4_b", 14, 14, 256},
+                        {"resnet50/res5_b", 7, 7, 512}};
+
+Shape makeShape(std::vector<uint32_t> dimensions)
+{
+  Shape shape;
+  shape.type = OperandType::TENSOR_FLOAT32;
+  shape.dimensions = dimensions;
+  shape.scale = 0.0f;
+  shape.offset = 0;
+  return shape;
+}
+
+std::vector<float> sequence(uint32_t size, uint32_t period)
+{
+  std::vector<float> values(size);
+  for (uint32_t n = 0; n < size; ++n)
+  {
+    values[n] = static_cast<float>(n % period) / period - 0.5f;
+  }
+  return values;
+}
+
+// Buffers and the function of a layer
+struct Stage
+{
+  Stage(const Layer &layer)
+      : input(sequence(layer.height * layer.width * layer.depth, 7)),
+        kernel(sequence(layer.depth * 9 * layer.depth, 5)), bias(sequence(layer.depth, 3)),
+        output(input.size()), input_tensor{reinterpret_cast<uint8_t *>(input.data())},
+        kernel_tensor{reinterpret_cast<uint8_t *>(kernel.data())},
+        bias_tensor{reinterpret_cast<uint8_t *>(bias.data())},
+        output_tensor{reinterpret_cast<uint8_t *>(output.data())}
+  {
+    const auto featureShape = makeShape({1, layer.height, layer.width, layer.depth});
+    const auto kernelShape = makeShape({layer.depth, 3, 3, layer.depth});
+    const auto biasShape = makeShape({layer.depth});
+
+    // NOTE The tile is chosen for the current profile
+    const auto tile =
+        neurun::kernel::cpu::WinogradConvolutionLayer::selectTile(layer.height, layer.width);
+
+    fn.configure(&input_tensor, featureShape, &kernel_tensor, kernelShape, &bias_tensor,
+                 biasShape, 1, 1, ANEURALNETWORKS_FUSED_NONE, &output_tensor, featureShape, tile);
+    fn.prepare();
+  }
+
+  std::vector<float> input;
+  std::vector<float> kernel;
+  std::vector<float> bias;
+  std::vector<float> output;
+
+  Tensor input_tensor;
+  Tensor kernel_tensor;
+  Tensor bias_tensor;
+  Tensor output_tensor;
+
+  neurun::kernel::cpu::WinogradConvolutionLayer fn;
+};
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+  const int repeat = (argc > 1) ? std::atoi(argv[1]) : 10;
+
+  using Preference = SchedulingProfile::Preference;
+
+  const Preference preferences[] = {Preference::LOW_POWER, Preference::FAST_SINGLE_ANSWER,
+                                    Preference::SUSTAINED_SPEED};
+
+  std::cout << std::left << std::setw(20) << "profile" << std::right << std::setw(10) << "threads"
+            << std::setw(12) << "wall (ms)" << std::setw(12) << "cpu (ms)" << std::endl;
+
+  for (const auto preference : preferences)
+  {
+    const auto &profile = SchedulingProfile::get(preference);
+
+    SchedulingProfile::Scope scope{profile};
+
+    std::vector<std::unique_ptr<Stage>> stages;
+    for (const auto &layer : layers)
+    {
+      stages.emplace_back(new Stage{layer});
+    }
+
+    auto inference = [&](void) {
+      for (auto &stage : stages)
+      {
+        stage->fn.run();
+      }
+    };
+
+    // Warm-up
+    inference();
+
+    std::chrono::microseconds elapsed{0};
+    const auto cpu_begin = std::clock();
+
+    for (int n = 0; n < repeat; ++n)
+    {
+      nnfw::util::benchmark::measure(elapsed) << inference;
+    }
+
+    const double cpu = 1000.0 * (std::clock() - cpu_begin) / CLOCKS_PER_SEC / repeat;
+
+    std::cout << std::left << std::setw(20) << profile.name() << std::right << std::setw(10)
+              << profile.threads() << std::fixed << std::setprecision(3) << std::setw(12)
+              << elapsed.count() / 1000.0 / repeat << std::setw(12) << cpu << std::endl;
+  }
+
+  return 0;
+}
@@ -65,8 +65,8 @@ BackendManager::BackendManager(const neurun::graph::operand::Set &operands)
     auto acl_initializer_gen = std::make_shared<InitializerGenerator>(operands);
     auto acl_stage_gen = std::make_shared<StageGenerator>(operands, acl_tensor_builder);
 
-    // TODO Do not use magic string for backend id
-    _gen_map["acl_cl"] = {acl_backend_initializer, acl_initializer_gen, acl_stage_gen};
+    _gen_map[acl_backend_initializer->id()] = {acl_backend_initializer, acl_initializer_gen,
+                                               acl_stage_gen};
   }
 
   // Add CPU backend
@@ -77,12 +77,24 @@ BackendManager::BackendManager(const neurun::graph::operand::Set &operands)
     auto cpu_initializer_gen = std::make_shared<InitializerGenerator>(operands);
     auto cpu_stage_gen = std::make_shared<StageGenerator>(operands, cpu_tensor_builder);
 
-    // TODO Do not use magic string for backend id
-    _gen_map["cpu"] = {cpu_backend_initializer, cpu_initializer_gen, cpu_stage_gen};
+    _gen_map[cpu_backend_initializer->id()] = {cpu_backend_initializer, cpu_initializer_gen,
+                                               cpu_stage_gen};
   }
 }
 
 Backend BackendManager::get(const std::string &key) { return _gen_map.at(key); }
 
+std::vector<std::string> BackendManager::keys(void) const
+{
+  std::vector<std::string> keys;
+
+  for (const auto &entry : _gen_map)
+  {
+    keys.emplace_back(entry.first);
+  }
+
+  return keys;
+}
+
 } // namespace backend
 } // namespace neurun
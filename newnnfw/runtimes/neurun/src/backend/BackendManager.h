@@ -19,6 +19,8 @@
 
 #include <memory>
 #include <map>
+#include <string>
+#include <vector>
 
 #include "graph/operand/Set.h"
 
@@ -62,6 +64,8 @@ public:
   BackendManager(const neurun::graph::operand::Set &operands);
 
   Backend get(const std::string &key);
+  // Keys of all the available backends
+  std::vector<std::string> keys(void) const;
 
 private:
   std::map<std::string, Backend> _gen_map;
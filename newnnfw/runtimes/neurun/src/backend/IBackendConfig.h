@@ -17,6 +17,8 @@
 #ifndef __INTERNAL_IBACKEND_CONFIG_H__
 #define __INTERNAL_IBACKEND_CONFIG_H__
 
+#include <string>
+
 #include "graph/operand/Layout.h"
 
 namespace neurun
@@ -29,8 +31,14 @@ struct IBackendConfig
   virtual ~IBackendConfig() = default;
 
   virtual void initialize() = 0;
+  // Key of this backend in BackendManager
+  virtual std::string id() = 0;
   // NOTE Assume backend has only one type of operand layout
   virtual graph::operand::Layout getOperandLayout() = 0;
+  // Whether the stages of this backend may run concurrently with each other
+  virtual bool supportConcurrentExecution() = 0;
+  // Wait until the functions of this backend that have been run complete
+  virtual void sync() = 0;
 };
 
 } // namespace backend
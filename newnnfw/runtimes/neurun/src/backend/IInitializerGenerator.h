@@ -20,6 +20,7 @@
 #include "arm_compute/core/ITensor.h"
 
 #include "graph/operation/Conv2D.h"
+#include "graph/operation/DepthwiseConv2D.h"
 #include "graph/operation/FullyConnected.h"
 
 using Initializer = std::function<void(::arm_compute::ITensor &)>;
@@ -34,9 +35,13 @@ struct IInitializerGenerator
   virtual ~IInitializerGenerator() = default;
 
   virtual Initializer generateWeight(const graph::operation::Conv2D::Implicit::Node &node) = 0;
+  virtual Initializer
+  generateWeight(const graph::operation::DepthwiseConv2D::Implicit::Node &node) = 0;
   virtual Initializer generateWeight(const graph::operation::FullyConnected::Node &node) = 0;
 
   virtual Initializer generateBias(const graph::operation::Conv2D::Implicit::Node &node) = 0;
+  virtual Initializer
+  generateBias(const graph::operation::DepthwiseConv2D::Implicit::Node &node) = 0;
   virtual Initializer generateBias(const graph::operation::FullyConnected::Node &node) = 0;
 };
 
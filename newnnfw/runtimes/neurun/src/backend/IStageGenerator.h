@@ -24,6 +24,7 @@
 
 #include "backend/ITensorBuilder.h"
 #include "graph/operation/Conv2D.h"
+#include "graph/operation/DepthwiseConv2D.h"
 #include "graph/operation/MaxPool2D.h"
 #include "graph/operation/AvgPool2D.h"
 #include "graph/operation/Concat.h"
@@ -31,6 +32,7 @@
 #include "graph/operation/Reshape.h"
 #include "graph/operation/Softmax.h"
 #include "graph/operation/NOP.h"
+#include "graph/operation/Permute.h"
 
 struct IExecutionBuilder
 {
@@ -53,6 +55,7 @@ struct IStageGenerator
   virtual std::shared_ptr<ITensorBuilder> tensor_builder() = 0;
 
   virtual Stage generate(const graph::operation::Conv2D::Implicit::Node &node) = 0;
+  virtual Stage generate(const graph::operation::DepthwiseConv2D::Implicit::Node &node) = 0;
   virtual Stage generate(const graph::operation::MaxPool2D::Implicit::Node &node) = 0;
   virtual Stage generate(const graph::operation::AvgPool2D::Implicit::Node &node) = 0;
   virtual Stage generate(const graph::operation::Concat::Node &node) = 0;
@@ -60,6 +63,7 @@ struct IStageGenerator
   virtual Stage generate(const graph::operation::Reshape::Node &node) = 0;
   virtual Stage generate(const graph::operation::Softmax::Node &node) = 0;
   virtual Stage generate(const graph::operation::NOP::Node &node) = 0;
+  virtual Stage generate(const graph::operation::Permute::Node &node) = 0;
 };
 
 } // namespace backend
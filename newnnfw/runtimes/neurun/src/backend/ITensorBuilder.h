@@ -18,9 +18,11 @@
 #define __INTERNAL_ITENSOR_BUILDER_H__
 
 #include <map>
+#include <memory>
 #include <arm_compute/core/TensorInfo.h>
 
 #include "graph/operand/Index.h"
+#include "backend/IObject.h"
 #include "codegen/Plan.h"
 
 namespace neurun
@@ -32,10 +34,22 @@ struct ITensorBuilder
 {
   virtual ~ITensorBuilder(void) = default;
   virtual void mark(const ::neurun::graph::operand::Index &ind) = 0;
-  // TODO Add an interface for adding subsumption info
+  // Lifetime of a marked operand over the linear order
+  virtual void notifyFirstUse(const ::neurun::graph::operand::Index &ind) = 0;
+  virtual void notifyLastUse(const ::neurun::graph::operand::Index &ind) = 0;
+  // Whether a marked operand may live in the tensor of another one (see 'alias')
+  virtual bool supportAliasing(void) const = 0;
+  // Lets 'ind' live at 'offset' bytes of the tensor of 'parent' instead of having its own memory
+  virtual void alias(const ::neurun::graph::operand::Index &ind,
+                     const ::neurun::graph::operand::Index &parent, size_t offset) = 0;
   virtual void prepare(codegen::Plan &plan,
                        const std::map<int, ::arm_compute::TensorInfo> &tensor_info_ctx) = 0;
   virtual void allocate(void) = 0;
+  // Bytes of the tensor buffers that 'prepare' and 'allocate' have allocated so far
+  virtual size_t allocatedBytes(void) const = 0;
+  // Object of a prepared tensor, for the stages that access the tensors of other backends
+  virtual std::shared_ptr<backend::operand::IObject>
+  wrapTensor(const ::neurun::graph::operand::Index &ind) = 0;
 };
 
 } // namespace backend
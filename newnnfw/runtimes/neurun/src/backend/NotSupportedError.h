@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NEURUN_BACKEND_NOT_SUPPORTED_ERROR_H__
+#define __NEURUN_BACKEND_NOT_SUPPORTED_ERROR_H__
+
+#include <stdexcept>
+
+namespace neurun
+{
+namespace backend
+{
+
+// Thrown by a backend for an operation (or an operand type) that it does not support, yet
+//
+// NOTE BackendCalibrator catches this (and only this) to rule the backend out for the operation
+class NotSupportedError : public std::runtime_error
+{
+public:
+  using std::runtime_error::runtime_error;
+};
+
+} // namespace backend
+} // namespace neurun
+
+#endif // __NEURUN_BACKEND_NOT_SUPPORTED_ERROR_H__
@@ -16,6 +16,8 @@
 
 #include <arm_compute/runtime/CL/CLScheduler.h>
 
+#include <mutex>
+
 #include "backend/acl_cl/BackendConfig.h"
 
 namespace neurun
@@ -25,7 +27,16 @@ namespace backend
 namespace acl_cl
 {
 
-void BackendConfig::initialize() { arm_compute::CLScheduler::get().default_init(); }
+void BackendConfig::initialize()
+{
+  // NOTE Every BackendManager initializes its backends, and initializing CLScheduler again would
+  //      replace the context and the queue that the existing CL tensors and functions use
+  static std::once_flag once;
+
+  std::call_once(once, [](void) { arm_compute::CLScheduler::get().default_init(); });
+}
+
+void BackendConfig::sync() { arm_compute::CLScheduler::get().sync(); }
 
 } // namespace acl_cl
 } // namespace backend
@@ -35,7 +35,11 @@ public:
   }
 
   virtual void initialize() override;
+  virtual std::string id() override { return "acl_cl"; }
   virtual graph::operand::Layout getOperandLayout() { return graph::operand::Layout::NCHW; }
+  // NOTE CLScheduler and the functions which share its queue are not thread-safe
+  virtual bool supportConcurrentExecution() override { return false; }
+  virtual void sync() override;
 };
 
 } // namespace acl_cl
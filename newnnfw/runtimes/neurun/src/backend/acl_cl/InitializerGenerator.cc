@@ -39,20 +39,17 @@ InitializerGenerator::generateWeight(const graph::operation::Conv2D::Implicit::N
 {
   const ::neurun::graph::operand::Index ker_index{node.getInputs().at(1)};
 
-  const auto ker_shape = _ctx.at(ker_index).shape().asKernel();
-  auto ker_base = _ctx.at(ker_index).data().base();
-  auto ker_size = _ctx.at(ker_index).data().size();
+  return generateKernel(ker_index);
+}
 
-  return [ker_shape, ker_base, ker_size](::arm_compute::ITensor &tensor) {
-    const ::internal::nnapi::kernel::Reader<float> from{ker_shape, ker_base, ker_size};
-    ::internal::arm_compute::kernel::View<float> into{&tensor};
+Initializer
+InitializerGenerator::generateWeight(const graph::operation::DepthwiseConv2D::Implicit::Node &node)
+{
+  // NOTE DepthwiseConv2D kernel is of shape [1, KER_H, KER_W, IFM_C * MULTIPLIER], which is
+  //      initialized in the same way as a Conv2D kernel with a single filter
+  const ::neurun::graph::operand::Index ker_index{node.getInputs().at(1)};
 
-    ::nnfw::util::kernel::iterate(ker_shape)
-        << [&](uint32_t nth, uint32_t ch, uint32_t row, uint32_t col) {
-             const auto value = from.at(nth, ch, row, col);
-             into.at(nth, ch, row, col) = value;
-           };
-  };
+  return generateKernel(ker_index);
 }
 
 Initializer InitializerGenerator::generateWeight(const graph::operation::FullyConnected::Node &node)
@@ -95,8 +92,21 @@ Initializer InitializerGenerator::generateWeight(const graph::operation::FullyCo
 
 Initializer InitializerGenerator::generateBias(const graph::operation::Conv2D::Implicit::Node &node)
 {
-  // TODO Refactor so we can reuse the common code
+  const ::neurun::graph::operand::Index bias_index{node.getInputs().at(2)};
 
+  return generateBias(bias_index);
+}
+
+Initializer
+InitializerGenerator::generateBias(const graph::operation::DepthwiseConv2D::Implicit::Node &node)
+{
+  const ::neurun::graph::operand::Index bias_index{node.getInputs().at(2)};
+
+  return generateBias(bias_index);
+}
+
+Initializer InitializerGenerator::generateBias(const graph::operation::FullyConnected::Node &node)
+{
   const ::neurun::graph::operand::Index bias_index{node.getInputs().at(2)};
 
   auto bias_base = _ctx.at(bias_index).data().base();
@@ -117,10 +127,26 @@ Initializer InitializerGenerator::generateBias(const graph::operation::Conv2D::I
   };
 }
 
-Initializer InitializerGenerator::generateBias(const graph::operation::FullyConnected::Node &node)
+Initializer InitializerGenerator::generateKernel(const ::neurun::graph::operand::Index &ker_index)
 {
-  const ::neurun::graph::operand::Index bias_index{node.getInputs().at(2)};
+  const auto ker_shape = _ctx.at(ker_index).shape().asKernel();
+  auto ker_base = _ctx.at(ker_index).data().base();
+  auto ker_size = _ctx.at(ker_index).data().size();
+
+  return [ker_shape, ker_base, ker_size](::arm_compute::ITensor &tensor) {
+    const ::internal::nnapi::kernel::Reader<float> from{ker_shape, ker_base, ker_size};
+    ::internal::arm_compute::kernel::View<float> into{&tensor};
 
+    ::nnfw::util::kernel::iterate(ker_shape)
+        << [&](uint32_t nth, uint32_t ch, uint32_t row, uint32_t col) {
+             const auto value = from.at(nth, ch, row, col);
+             into.at(nth, ch, row, col) = value;
+           };
+  };
+}
+
+Initializer InitializerGenerator::generateBias(const ::neurun::graph::operand::Index &bias_index)
+{
   auto bias_base = _ctx.at(bias_index).data().base();
   const auto bias_size = _ctx.at(bias_index).shape().asVector();
 
@@ -34,11 +34,18 @@ public:
   InitializerGenerator(const neurun::graph::operand::Set &ctx);
 
   Initializer generateWeight(const graph::operation::Conv2D::Implicit::Node &node) override;
+  Initializer
+  generateWeight(const graph::operation::DepthwiseConv2D::Implicit::Node &node) override;
   Initializer generateWeight(const graph::operation::FullyConnected::Node &node) override;
 
   Initializer generateBias(const graph::operation::Conv2D::Implicit::Node &node) override;
+  Initializer generateBias(const graph::operation::DepthwiseConv2D::Implicit::Node &node) override;
   Initializer generateBias(const graph::operation::FullyConnected::Node &node) override;
 
+private:
+  Initializer generateKernel(const ::neurun::graph::operand::Index &ker_index);
+  Initializer generateBias(const ::neurun::graph::operand::Index &bias_index);
+
 private:
   const neurun::graph::operand::Set &_ctx;
 };
@@ -38,6 +38,7 @@ public:
   virtual std::shared_ptr<ITensorBuilder> tensor_builder() override { return _tensor_builder; }
 
   virtual Stage generate(const graph::operation::Conv2D::Implicit::Node &node) override;
+  virtual Stage generate(const graph::operation::DepthwiseConv2D::Implicit::Node &node) override;
   virtual Stage generate(const graph::operation::MaxPool2D::Implicit::Node &node) override;
   virtual Stage generate(const graph::operation::AvgPool2D::Implicit::Node &node) override;
   virtual Stage generate(const graph::operation::Concat::Node &node) override;
@@ -45,6 +46,7 @@ public:
   virtual Stage generate(const graph::operation::Reshape::Node &node) override;
   virtual Stage generate(const graph::operation::Softmax::Node &node) override;
   virtual Stage generate(const graph::operation::NOP::Node &node) override;
+  virtual Stage generate(const graph::operation::Permute::Node &node) override;
 
 private:
   const neurun::graph::operand::Set &_ctx;
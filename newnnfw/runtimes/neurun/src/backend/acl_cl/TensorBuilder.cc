@@ -17,6 +17,7 @@
 #include "backend/acl_cl/TensorBuilder.h"
 
 #include <cassert>
+#include <stdexcept>
 
 #include "operand/Object.h"
 
@@ -39,6 +40,25 @@ void TensorBuilder::mark(const ::neurun::graph::operand::Index &ind)
   _inds.insert(ind);
 }
 
+void TensorBuilder::notifyFirstUse(const ::neurun::graph::operand::Index &)
+{
+  // TODO Use ACL memory manager to reuse memory of the dead tensors
+}
+
+void TensorBuilder::notifyLastUse(const ::neurun::graph::operand::Index &)
+{
+  // TODO Use ACL memory manager to reuse memory of the dead tensors
+}
+
+// TODO Support aliasing with CLSubTensor
+bool TensorBuilder::supportAliasing(void) const { return false; }
+
+void TensorBuilder::alias(const ::neurun::graph::operand::Index &,
+                          const ::neurun::graph::operand::Index &, size_t)
+{
+  throw std::runtime_error{"Aliasing is not supported"};
+}
+
 void TensorBuilder::prepare(codegen::Plan &plan,
                             const std::map<int, ::arm_compute::TensorInfo> &tensor_info_ctx)
 {
@@ -65,9 +85,18 @@ void TensorBuilder::allocate(void)
   {
     auto tensor = tensor_entry.second;
     tensor->allocator()->allocate();
+    _allocated_bytes += tensor->info()->total_size();
   }
 }
 
+size_t TensorBuilder::allocatedBytes(void) const { return _allocated_bytes; }
+
+std::shared_ptr<backend::operand::IObject>
+TensorBuilder::wrapTensor(const ::neurun::graph::operand::Index &ind)
+{
+  return std::make_shared<operand::Object>(_tensors.at(ind));
+}
+
 std::shared_ptr<::arm_compute::CLTensor>
 TensorBuilder::at(const ::neurun::graph::operand::Index &ind)
 {
@@ -39,15 +39,24 @@ public:
   TensorBuilder();
 
   virtual void mark(const ::neurun::graph::operand::Index &ind) override;
+  virtual void notifyFirstUse(const ::neurun::graph::operand::Index &ind) override;
+  virtual void notifyLastUse(const ::neurun::graph::operand::Index &ind) override;
+  virtual bool supportAliasing(void) const override;
+  virtual void alias(const ::neurun::graph::operand::Index &ind,
+                     const ::neurun::graph::operand::Index &parent, size_t offset) override;
   virtual void prepare(codegen::Plan &plan,
                        const std::map<int, ::arm_compute::TensorInfo> &tensor_info_ctx) override;
   virtual void allocate(void) override;
+  virtual size_t allocatedBytes(void) const override;
+  virtual std::shared_ptr<backend::operand::IObject>
+  wrapTensor(const ::neurun::graph::operand::Index &ind) override;
 
   std::shared_ptr<::arm_compute::CLTensor> at(const ::neurun::graph::operand::Index &ind);
 
 private:
   std::unordered_set<graph::operand::Index> _inds;
   std::unordered_map<graph::operand::Index, std::shared_ptr<::arm_compute::CLTensor>> _tensors;
+  size_t _allocated_bytes = 0;
 };
 
 } // namespace acl_cl
@@ -28,6 +28,11 @@ void BackendConfig::initialize()
   // DO NOTHING
 }
 
+void BackendConfig::sync()
+{
+  // DO NOTHING
+}
+
 } // namespace cpu
 } // namespace backend
 } // namespace neurun
@@ -35,7 +35,10 @@ public:
   }
 
   virtual void initialize() override;
+  virtual std::string id() override { return "cpu"; }
   virtual graph::operand::Layout getOperandLayout() { return graph::operand::Layout::NHWC; }
+  virtual bool supportConcurrentExecution() override { return true; }
+  virtual void sync() override;
 };
 
 } // namespace cpu
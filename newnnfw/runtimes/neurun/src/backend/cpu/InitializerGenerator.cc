@@ -16,6 +16,11 @@
 
 #include "InitializerGenerator.h"
 
+#include <cassert>
+
+#include "backend/NotSupportedError.h"
+#include "kernel/cpu/PackedGemm.h"
+#include "kernel/cpu/WinogradConvolutionLayer.h"
 #include "internal/nnapi/kernel/Reader.h"
 #include "internal/nnapi/kernel/View.h"
 #include "util/kernel/IndexIterator.h"
@@ -38,21 +43,37 @@ Initializer
 InitializerGenerator::generateWeight(const graph::operation::Conv2D::Implicit::Node &node)
 {
   const ::neurun::graph::operand::Index ker_index{node.getInputs().at(1)};
+  const ::neurun::graph::operand::Index vstride_index{node.param().vstride_index};
+  const ::neurun::graph::operand::Index hstride_index{node.param().hstride_index};
 
+  const auto ker_type = _ctx.at(ker_index).typeInfo().type();
   const auto ker_shape = _ctx.at(ker_index).shape().asKernel();
-  auto ker_base = _ctx.at(ker_index).data().base();
-  auto ker_size = _ctx.at(ker_index).data().size();
 
-  return [ker_shape, ker_base, ker_size](::arm_compute::ITensor &tensor) {
-    const ::internal::nnapi::kernel::Reader<float> from{ker_shape, ker_base, ker_size};
-    ::internal::nnapi::kernel::View<float> into{&tensor};
+  // NOTE A Winograd convolution transforms its kernel from NHWC order by itself
+  if (::neurun::kernel::cpu::WinogradConvolutionLayer::isSupported(
+          ker_type, ker_shape.H, ker_shape.W, _ctx.at(vstride_index).asScalar<int32_t>(),
+          _ctx.at(hstride_index).asScalar<int32_t>()))
+  {
+    return generateKernel(ker_index);
+  }
 
-    ::nnfw::util::kernel::iterate(ker_shape)
-        << [&](uint32_t nth, uint32_t ch, uint32_t row, uint32_t col) {
-             const auto value = from.at(nth, ch, row, col);
-             into.at(nth, row, col, ch) = value;
-           };
-  };
+  if (ker_type == ::neurun::graph::operand::DataType::TENSOR_FLOAT32)
+  {
+    // NOTE A NHWC kernel is a matrix of [KER_N, KER_H * KER_W * KER_C]
+    return generatePackedWeight(ker_index, ker_shape.N, ker_shape.H * ker_shape.W * ker_shape.C);
+  }
+
+  return generateKernel(ker_index);
+}
+
+Initializer
+InitializerGenerator::generateWeight(const graph::operation::DepthwiseConv2D::Implicit::Node &node)
+{
+  // NOTE DepthwiseConv2D kernel is of shape [1, KER_H, KER_W, IFM_C * MULTIPLIER], which is
+  //      initialized in the same way as a Conv2D kernel with a single filter
+  const ::neurun::graph::operand::Index ker_index{node.getInputs().at(1)};
+
+  return generateKernel(ker_index);
 }
 
 Initializer InitializerGenerator::generateWeight(const graph::operation::FullyConnected::Node &node)
@@ -73,30 +94,8 @@ Initializer InitializerGenerator::generateWeight(const graph::operation::FullyCo
   {
     case ::neurun::graph::operand::DataType::TENSOR_FLOAT32:
     {
-      return [num_output, ifm_shape, weight_base, weight_size](::arm_compute::ITensor &tensor) {
-        const ::nnfw::util::kernel::Shape ker_shape{num_output, ifm_shape.C, ifm_shape.H,
-                                                    ifm_shape.W};
-        const ::internal::nnapi::kernel::Reader<float> from{ker_shape, weight_base, weight_size};
-
-        ::nnfw::util::kernel::iterate(ker_shape)
-            << [&](uint32_t nth, uint32_t ch, uint32_t row, uint32_t col) {
-                 const auto value = from.at(nth, ch, row, col);
-
-                 uint32_t offset = 0;
-
-                 // NNAPI uses NHWC ordering
-                 offset += nth * ifm_shape.H * ifm_shape.W * ifm_shape.C;
-                 offset += row * ifm_shape.W * ifm_shape.C;
-                 offset += col * ifm_shape.C;
-                 offset += ch;
-
-                 const ::arm_compute::Coordinates coordinate{offset};
-
-                 auto into = reinterpret_cast<float *>(tensor.ptr_to_element(coordinate));
-
-                 *into = value;
-               };
-      };
+      return generatePackedWeight(weight_index, num_output,
+                                  ifm_shape.C * ifm_shape.H * ifm_shape.W);
     }
     case ::neurun::graph::operand::DataType::TENSOR_QUANT8_ASYMM:
     {
@@ -125,39 +124,95 @@ Initializer InitializerGenerator::generateWeight(const graph::operation::FullyCo
     }
     default:
     {
-      throw std::runtime_error("Not supported weight type");
+      throw NotSupportedError("Not supported weight type");
     }
   }
 }
 
 Initializer InitializerGenerator::generateBias(const graph::operation::Conv2D::Implicit::Node &node)
 {
-  // TODO Refactor so we can reuse the common code
+  const ::neurun::graph::operand::Index bias_index{node.getInputs().at(2)};
 
+  return generateBias(bias_index);
+}
+
+Initializer
+InitializerGenerator::generateBias(const graph::operation::DepthwiseConv2D::Implicit::Node &node)
+{
   const ::neurun::graph::operand::Index bias_index{node.getInputs().at(2)};
 
-  auto bias_base = _ctx.at(bias_index).data().base();
-  const auto bias_size = _ctx.at(bias_index).shape().asVector();
+  return generateBias(bias_index);
+}
 
-  return [bias_base, bias_size](::arm_compute::ITensor &tensor) {
-    for (int32_t n = 0; n < bias_size; ++n)
-    {
-      const ::arm_compute::Coordinates coordinate{n};
+Initializer InitializerGenerator::generateBias(const graph::operation::FullyConnected::Node &node)
+{
+  const ::neurun::graph::operand::Index bias_index{node.getInputs().at(2)};
 
-      float *into = reinterpret_cast<float *>(tensor.ptr_to_element(coordinate));
+  return generateBias(bias_index);
+}
+
+Initializer InitializerGenerator::generateKernel(const ::neurun::graph::operand::Index &ker_index)
+{
+  const auto ker_shape = _ctx.at(ker_index).shape().asKernel();
+  auto ker_base = _ctx.at(ker_index).data().base();
+  auto ker_size = _ctx.at(ker_index).data().size();
+  auto ker_type = _ctx.at(ker_index).typeInfo().type();
 
-      const float *from = reinterpret_cast<const float *>(bias_base) + n;
-      const auto value = *from;
+  switch (ker_type)
+  {
+    case ::neurun::graph::operand::DataType::TENSOR_FLOAT32:
+    {
+      return [ker_shape, ker_base, ker_size](::arm_compute::ITensor &tensor) {
+        const ::internal::nnapi::kernel::Reader<float> from{ker_shape, ker_base, ker_size};
+        ::internal::nnapi::kernel::View<float> into{&tensor};
 
-      *into = value;
+        ::nnfw::util::kernel::iterate(ker_shape)
+            << [&](uint32_t nth, uint32_t ch, uint32_t row, uint32_t col) {
+                 const auto value = from.at(nth, ch, row, col);
+                 into.at(nth, row, col, ch) = value;
+               };
+      };
     }
-  };
+    case ::neurun::graph::operand::DataType::TENSOR_QUANT8_ASYMM:
+    {
+      return [ker_shape, ker_base, ker_size](::arm_compute::ITensor &tensor) {
+        const ::internal::nnapi::kernel::Reader<uint8_t> from{ker_shape, ker_base, ker_size};
+        ::internal::nnapi::kernel::View<uint8_t> into{&tensor};
+
+        ::nnfw::util::kernel::iterate(ker_shape)
+            << [&](uint32_t nth, uint32_t ch, uint32_t row, uint32_t col) {
+                 const auto value = from.at(nth, ch, row, col);
+                 into.at(nth, row, col, ch) = value;
+               };
+      };
+    }
+    default:
+    {
+      throw NotSupportedError("Not supported weight type");
+    }
+  }
 }
 
-Initializer InitializerGenerator::generateBias(const graph::operation::FullyConnected::Node &node)
+Initializer
+InitializerGenerator::generatePackedWeight(const ::neurun::graph::operand::Index &weight_index,
+                                           uint32_t units, uint32_t depth)
 {
-  const ::neurun::graph::operand::Index bias_index{node.getInputs().at(2)};
+  auto weight_base = _ctx.at(weight_index).data().base();
+
+  assert(_ctx.at(weight_index).data().size() == units * depth * sizeof(float));
+
+  // NOTE NNAPI weights are already row-major of [units, depth] in NHWC order, and CPU tensors
+  //      are dense, so weights are packed from and into flat buffers
+  return [weight_base, units, depth](::arm_compute::ITensor &tensor) {
+    assert(tensor.info()->total_size() == units * depth * sizeof(float));
 
+    ::neurun::kernel::cpu::packWeights(reinterpret_cast<const float *>(weight_base), units, depth,
+                                       reinterpret_cast<float *>(tensor.buffer()));
+  };
+}
+
+Initializer InitializerGenerator::generateBias(const ::neurun::graph::operand::Index &bias_index)
+{
   auto bias_base = _ctx.at(bias_index).data().base();
   auto bias_type = _ctx.at(bias_index).typeInfo().type();
   const auto bias_size = _ctx.at(bias_index).shape().asVector();
@@ -180,16 +235,16 @@ Initializer InitializerGenerator::generateBias(const graph::operation::FullyConn
         }
       };
     }
-    case ::neurun::graph::operand::DataType::TENSOR_QUANT8_ASYMM:
+    case ::neurun::graph::operand::DataType::TENSOR_INT32:
     {
       return [bias_base, bias_size](::arm_compute::ITensor &tensor) {
         for (int32_t n = 0; n < bias_size; ++n)
         {
           const ::arm_compute::Coordinates coordinate{n};
 
-          uint8_t *into = reinterpret_cast<uint8_t *>(tensor.ptr_to_element(coordinate));
+          int32_t *into = reinterpret_cast<int32_t *>(tensor.ptr_to_element(coordinate));
 
-          const uint8_t *from = reinterpret_cast<const uint8_t *>(bias_base) + n;
+          const int32_t *from = reinterpret_cast<const int32_t *>(bias_base) + n;
           const auto value = *from;
 
           *into = value;
@@ -198,7 +253,7 @@ Initializer InitializerGenerator::generateBias(const graph::operation::FullyConn
     }
     default:
     {
-      throw std::runtime_error("Not supported bias type");
+      throw NotSupportedError("Not supported bias type");
     }
   }
 }
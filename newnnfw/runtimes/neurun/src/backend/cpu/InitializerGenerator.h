@@ -34,11 +34,21 @@ public:
   InitializerGenerator(const neurun::graph::operand::Set &ctx);
 
   Initializer generateWeight(const graph::operation::Conv2D::Implicit::Node &node) override;
+  Initializer
+  generateWeight(const graph::operation::DepthwiseConv2D::Implicit::Node &node) override;
   Initializer generateWeight(const graph::operation::FullyConnected::Node &node) override;
 
   Initializer generateBias(const graph::operation::Conv2D::Implicit::Node &node) override;
+  Initializer generateBias(const graph::operation::DepthwiseConv2D::Implicit::Node &node) override;
   Initializer generateBias(const graph::operation::FullyConnected::Node &node) override;
 
+private:
+  Initializer generateKernel(const ::neurun::graph::operand::Index &ker_index);
+  // Packs the weights of shape [units, depth] for the GEMM of CPU kernels (FLOAT32 only)
+  Initializer generatePackedWeight(const ::neurun::graph::operand::Index &weight_index,
+                                   uint32_t units, uint32_t depth);
+  Initializer generateBias(const ::neurun::graph::operand::Index &bias_index);
+
 private:
   const neurun::graph::operand::Set &_ctx;
 };
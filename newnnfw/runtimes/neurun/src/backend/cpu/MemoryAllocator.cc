@@ -14,4 +14,26 @@
  * limitations under the License.
  */
 
-//#include "internal/cpu/MemoryAllocator.h"
+#include "MemoryAllocator.h"
+
+namespace neurun
+{
+namespace backend
+{
+namespace cpu
+{
+
+constexpr size_t MemoryAllocator::ALIGNMENT;
+
+MemoryAllocator::MemoryAllocator(size_t capacity)
+    : _memory{new uint8_t[capacity + ALIGNMENT]}, _base{nullptr}, _capacity{capacity}
+{
+  const auto addr = reinterpret_cast<uintptr_t>(_memory.get());
+  const auto aligned = (addr + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+
+  _base = _memory.get() + (aligned - addr);
+}
+
+} // namespace cpu
+} // namespace backend
+} // namespace neurun
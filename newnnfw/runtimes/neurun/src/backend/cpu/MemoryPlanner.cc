@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MemoryPlanner.h"
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <stdexcept>
+
+#include "MemoryAllocator.h"
+#include "util/EnvVar.h"
+
+namespace
+{
+
+// NOTE An empty block also takes space so that every live block has its own offset
+size_t align(size_t size)
+{
+  const auto alignment = neurun::backend::cpu::MemoryAllocator::ALIGNMENT;
+  return (std::max<size_t>(size, 1) + alignment - 1) / alignment * alignment;
+}
+
+} // namespace
+
+namespace neurun
+{
+namespace backend
+{
+namespace cpu
+{
+
+void BumpPlanner::claim(const graph::operand::Index &ind, size_t size)
+{
+  assert(_plans.find(ind) == _plans.end());
+
+  _plans[ind] = Block{_capacity, size};
+  _capacity += align(size);
+}
+
+void BumpPlanner::release(const graph::operand::Index &)
+{
+  // DO NOTHING
+}
+
+void FitPlanner::claim(const graph::operand::Index &ind, size_t size)
+{
+  assert(_plans.find(ind) == _plans.end());
+
+  const auto aligned_size = align(size);
+
+  size_t offset = 0;
+
+  // Offset of the gap which is chosen, and its size
+  size_t chosen_offset = 0;
+  size_t chosen_size = std::numeric_limits<size_t>::max();
+  bool found = false;
+
+  for (const auto &live : _live)
+  {
+    const auto gap = live.first - offset;
+
+    if ((gap >= aligned_size) && (gap < chosen_size))
+    {
+      chosen_offset = offset;
+      chosen_size = gap;
+      found = true;
+
+      if (_policy == Policy::FirstFit)
+      {
+        break;
+      }
+    }
+
+    offset = std::max(offset, live.first + align(_plans.at(live.second).size));
+  }
+
+  if (!found)
+  {
+    // Place after the last live block
+    chosen_offset = offset;
+  }
+
+  _plans[ind] = Block{chosen_offset, size};
+  _live.emplace(chosen_offset, ind);
+  _capacity = std::max(_capacity, chosen_offset + aligned_size);
+}
+
+void FitPlanner::release(const graph::operand::Index &ind)
+{
+  const auto &block = _plans.at(ind);
+
+  auto it = _live.find(block.offset);
+  assert((it != _live.end()) && (it->second == ind));
+
+  _live.erase(it);
+}
+
+std::unique_ptr<IMemoryPlanner> createMemoryPlanner(void)
+{
+  const auto name = nnfw::util::EnvVar{"NEURUN_CPU_MEMORY_PLANNER"}.asString("FirstFit");
+
+  if (name == "FirstFit")
+  {
+    return std::unique_ptr<IMemoryPlanner>{new FitPlanner{FitPlanner::Policy::FirstFit}};
+  }
+  else if (name == "BestFit")
+  {
+    return std::unique_ptr<IMemoryPlanner>{new FitPlanner{FitPlanner::Policy::BestFit}};
+  }
+  else if (name == "Bump")
+  {
+    return std::unique_ptr<IMemoryPlanner>{new BumpPlanner};
+  }
+
+  throw std::runtime_error{"Unknown memory planner: " + name};
+}
+
+} // namespace cpu
+} // namespace backend
+} // namespace neurun
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NEURUN_BACKEND_CPU_MEMORY_PLANNER_H__
+#define __NEURUN_BACKEND_CPU_MEMORY_PLANNER_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <unordered_map>
+
+#include "graph/operand/Index.h"
+
+namespace neurun
+{
+namespace backend
+{
+namespace cpu
+{
+
+// Region of the arena assigned to an operand
+struct Block
+{
+  size_t offset;
+  size_t size;
+};
+
+using MemoryPlans = std::unordered_map<graph::operand::Index, Block>;
+
+// Assigns an offset of the arena to each operand while it is alive
+struct IMemoryPlanner
+{
+  virtual ~IMemoryPlanner() = default;
+
+  virtual void claim(const graph::operand::Index &ind, size_t size) = 0;
+  virtual void release(const graph::operand::Index &ind) = 0;
+
+  // The size of arena which covers every claimed block
+  virtual size_t capacity(void) const = 0;
+  virtual const MemoryPlans &plans(void) const = 0;
+};
+
+// Places every block after the previous one, that is, nothing is reused
+class BumpPlanner final : public IMemoryPlanner
+{
+public:
+  BumpPlanner() : _capacity{0}
+  {
+    // DO NOTHING
+  }
+
+public:
+  void claim(const graph::operand::Index &ind, size_t size) override;
+  void release(const graph::operand::Index &ind) override;
+
+public:
+  size_t capacity(void) const override { return _capacity; }
+  const MemoryPlans &plans(void) const override { return _plans; }
+
+private:
+  size_t _capacity;
+  MemoryPlans _plans;
+};
+
+// Places a block on a free gap between the live blocks
+//
+//   - FirstFit takes the lowest gap that is large enough
+//   - BestFit takes the smallest gap that is large enough
+//
+// A block is placed at the end of the live blocks if there is no such gap.
+class FitPlanner final : public IMemoryPlanner
+{
+public:
+  enum class Policy
+  {
+    FirstFit,
+    BestFit
+  };
+
+public:
+  FitPlanner(Policy policy) : _policy{policy}, _capacity{0}
+  {
+    // DO NOTHING
+  }
+
+public:
+  void claim(const graph::operand::Index &ind, size_t size) override;
+  void release(const graph::operand::Index &ind) override;
+
+public:
+  size_t capacity(void) const override { return _capacity; }
+  const MemoryPlans &plans(void) const override { return _plans; }
+
+private:
+  Policy _policy;
+  size_t _capacity;
+  MemoryPlans _plans;
+  // Live blocks ordered by their offset
+  std::map<size_t, graph::operand::Index> _live;
+};
+
+// Creates the planner named by NEURUN_CPU_MEMORY_PLANNER (FirstFit, BestFit or Bump)
+std::unique_ptr<IMemoryPlanner> createMemoryPlanner(void);
+
+} // namespace cpu
+} // namespace backend
+} // namespace neurun
+
+#endif // __NEURUN_BACKEND_CPU_MEMORY_PLANNER_H__
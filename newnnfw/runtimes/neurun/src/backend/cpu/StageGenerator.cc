@@ -21,13 +21,17 @@
 #include "internal/Padding.h"
 #include "kernel/cpu/OperationUtils.h"
 #include "kernel/cpu/ConvolutionLayer.h"
+#include "kernel/cpu/WinogradConvolutionLayer.h"
+#include "kernel/cpu/DepthwiseConvolutionLayer.h"
 #include "kernel/cpu/AvgPoolLayer.h"
 #include "kernel/cpu/MaxPoolLayer.h"
 #include "kernel/cpu/ConcatLayer.h"
 #include "kernel/cpu/FullyConnectedLayer.h"
 #include "kernel/cpu/ReshapeLayer.h"
+#include "kernel/cpu/PermuteLayer.h"
 #include "kernel/cpu/SoftMaxLayer.h"
 
+#include "graph/operation/LowerInfo.h"
 #include "logging.h"
 
 #include "support/nnapi/Utils.h"
@@ -115,19 +119,138 @@ Stage StageGenerator::generate(const graph::operation::Conv2D::Implicit::Node &n
 
   auto tensors = _tensor_builder;
 
+  // NOTE InitializerGenerator keeps the kernel of a Winograd convolution in NHWC order, and the
+  //      layer transforms it at prepare()
+  if (::neurun::kernel::cpu::WinogradConvolutionLayer::isSupported(
+          param.ker_shape.type, param.ker_shape.dimensions[1], param.ker_shape.dimensions[2],
+          stride.vertical, stride.horizontal))
+  {
+    const auto tile = ::neurun::kernel::cpu::WinogradConvolutionLayer::selectTile(
+        param.ofm_shape.dimensions[1], param.ofm_shape.dimensions[2]);
+
+    VERBOSE(Conv2D) << "generate CPU Winograd F(" << tile << "x" << tile << ", 3x3) Conv2D"
+                    << std::endl;
+
+    return [tensors, param, tile](IExecutionBuilder &builder) {
+      auto ofm_alloc = tensors->at(::neurun::graph::operand::Index{param.ofm_index}).get();
+      auto ifm_alloc = tensors->at(::neurun::graph::operand::Index{param.ifm_index}).get();
+      auto ker_alloc = tensors->at(::neurun::graph::operand::Index{param.ker_index}).get();
+      auto bias_alloc = tensors->at(::neurun::graph::operand::Index{param.bias_index}).get();
+
+      std::unique_ptr<::neurun::kernel::cpu::WinogradConvolutionLayer> fn{
+          new ::neurun::kernel::cpu::WinogradConvolutionLayer};
+
+      fn->configure(ifm_alloc, param.ifm_shape, ker_alloc, param.ker_shape, bias_alloc,
+                    param.bias_shape, param.padding.left, param.padding.top, param.activation,
+                    ofm_alloc, param.ofm_shape, tile);
+
+      builder.append(std::move(fn));
+    };
+  }
+
   return [tensors, param](IExecutionBuilder &builder) {
-    auto ofm_alloc = tensors->at(::neurun::graph::operand::Index{param.ofm_index});
-    auto ifm_alloc = tensors->at(::neurun::graph::operand::Index{param.ifm_index});
-    auto ker_alloc = tensors->at(::neurun::graph::operand::Index{param.ker_index});
-    auto bias_alloc = tensors->at(::neurun::graph::operand::Index{param.bias_index});
+    auto ofm_alloc = tensors->at(::neurun::graph::operand::Index{param.ofm_index}).get();
+    auto ifm_alloc = tensors->at(::neurun::graph::operand::Index{param.ifm_index}).get();
+    auto ker_alloc = tensors->at(::neurun::graph::operand::Index{param.ker_index}).get();
+    auto bias_alloc = tensors->at(::neurun::graph::operand::Index{param.bias_index}).get();
 
     std::unique_ptr<::neurun::kernel::cpu::ConvolutionLayer> fn{
         new ::neurun::kernel::cpu::ConvolutionLayer};
 
-    fn->configure(ifm_alloc->buffer(), param.ifm_shape, ker_alloc->buffer(), param.ker_shape,
-                  bias_alloc->buffer(), param.bias_shape, param.padding.left, param.padding.right,
-                  param.padding.top, param.padding.bottom, param.stride.horizontal,
-                  param.stride.vertical, param.activation, ofm_alloc->buffer(), param.ofm_shape);
+    fn->configure(ifm_alloc, param.ifm_shape, ker_alloc, param.ker_shape, bias_alloc,
+                  param.bias_shape, param.padding.left, param.padding.right, param.padding.top,
+                  param.padding.bottom, param.stride.horizontal, param.stride.vertical,
+                  param.activation, ofm_alloc, param.ofm_shape);
+
+    builder.append(std::move(fn));
+  };
+}
+
+Stage StageGenerator::generate(const graph::operation::DepthwiseConv2D::Implicit::Node &node)
+{
+  VERBOSE(DepthwiseConv2D) << "generate CPU DepthwiseConv2D" << std::endl;
+
+  const ::neurun::graph::operand::Index ofm_index{node.getOutputs().at(0)};
+  const ::neurun::graph::operand::Index ifm_index{node.getInputs().at(0)};
+  const ::neurun::graph::operand::Index ker_index{node.getInputs().at(1)};
+  const ::neurun::graph::operand::Index bias_index{node.getInputs().at(2)};
+
+  const ::neurun::graph::operand::Index vstride_index{node.param().vstride_index};
+  const ::neurun::graph::operand::Index hstride_index{node.param().hstride_index};
+
+  const ::neurun::graph::operand::Index padding_index{node.param().padding_index};
+  const ::neurun::graph::operand::Index multiplier_index{node.param().multiplier_index};
+  const ::neurun::graph::operand::Index activation_index{node.param().activation_index};
+
+  const PaddingCode padding_type =
+      static_cast<PaddingCode>(_ctx.at(padding_index).asScalar<int32_t>());
+
+  assert((ANEURALNETWORKS_PADDING_SAME == padding_type) ||
+         (ANEURALNETWORKS_PADDING_VALID == padding_type));
+
+  ::internal::Stride stride;
+
+  stride.vertical = _ctx.at(vstride_index).asScalar<int32_t>();
+  stride.horizontal = _ctx.at(hstride_index).asScalar<int32_t>();
+
+  // Construct operation parameters
+  struct Param
+  {
+    int ofm_index;
+    int ifm_index;
+    int ker_index;
+    int bias_index;
+
+    ::neurun::kernel::cpu::Shape ofm_shape;
+    ::neurun::kernel::cpu::Shape ifm_shape;
+    ::neurun::kernel::cpu::Shape ker_shape;
+    ::neurun::kernel::cpu::Shape bias_shape;
+
+    ::internal::Padding padding;
+    ::internal::Stride stride;
+
+    uint32_t multiplier;
+    FuseCode activation;
+  };
+
+  Param param;
+
+  param.ofm_index = ofm_index.asInt();
+  param.ifm_index = ifm_index.asInt();
+  param.ker_index = ker_index.asInt();
+  param.bias_index = bias_index.asInt();
+
+  param.ofm_shape = ::neurun::kernel::cpu::getShape(_ctx.at(ofm_index));
+  param.ifm_shape = ::neurun::kernel::cpu::getShape(_ctx.at(ifm_index));
+  param.ker_shape = ::neurun::kernel::cpu::getShape(_ctx.at(ker_index));
+  param.bias_shape = ::neurun::kernel::cpu::getShape(_ctx.at(bias_index));
+
+  param.stride = stride;
+  param.padding = (padding_type == ANEURALNETWORKS_PADDING_SAME)
+                      ? ::internal::same_padding(_ctx.at(ifm_index).shape().asFeature(),
+                                                 _ctx.at(ofm_index).shape().asFeature(), stride,
+                                                 _ctx.at(ker_index).shape().asKernel().W,
+                                                 _ctx.at(ker_index).shape().asKernel().H)
+                      : ::internal::valid_padding();
+
+  param.multiplier = _ctx.at(multiplier_index).asScalar<int32_t>();
+  param.activation = static_cast<FuseCode>(_ctx.at(activation_index).asScalar<int32_t>());
+
+  auto tensors = _tensor_builder;
+
+  return [tensors, param](IExecutionBuilder &builder) {
+    auto ofm_alloc = tensors->at(::neurun::graph::operand::Index{param.ofm_index}).get();
+    auto ifm_alloc = tensors->at(::neurun::graph::operand::Index{param.ifm_index}).get();
+    auto ker_alloc = tensors->at(::neurun::graph::operand::Index{param.ker_index}).get();
+    auto bias_alloc = tensors->at(::neurun::graph::operand::Index{param.bias_index}).get();
+
+    std::unique_ptr<::neurun::kernel::cpu::DepthwiseConvolutionLayer> fn{
+        new ::neurun::kernel::cpu::DepthwiseConvolutionLayer};
+
+    fn->configure(ifm_alloc, param.ifm_shape, ker_alloc, param.ker_shape, bias_alloc,
+                  param.bias_shape, param.padding.left, param.padding.right, param.padding.top,
+                  param.padding.bottom, param.stride.horizontal, param.stride.vertical,
+                  param.multiplier, param.activation, ofm_alloc, param.ofm_shape);
 
     builder.append(std::move(fn));
   };
@@ -220,9 +343,9 @@ Stage StageGenerator::generate(const graph::operation::MaxPool2D::Implicit::Node
     std::unique_ptr<::neurun::kernel::cpu::MaxPoolLayer> fn{
         new ::neurun::kernel::cpu::MaxPoolLayer};
 
-    fn->configure(ifm_alloc->buffer(), param.ifm_shape, param.padding.left, param.padding.right,
+    fn->configure(ifm_alloc, param.ifm_shape, param.padding.left, param.padding.right,
                   param.padding.top, param.padding.bottom, param.stride.horizontal,
-                  param.stride.vertical, param.kw, param.kh, param.activation, ofm_alloc->buffer(),
+                  param.stride.vertical, param.kw, param.kh, param.activation, ofm_alloc,
                   param.ofm_shape);
 
     builder.append(std::move(fn));
@@ -320,9 +443,9 @@ Stage StageGenerator::generate(const graph::operation::AvgPool2D::Implicit::Node
     std::unique_ptr<::neurun::kernel::cpu::AvgPoolLayer> fn{
         new ::neurun::kernel::cpu::AvgPoolLayer};
 
-    fn->configure(ifm_alloc->buffer(), param.ifm_shape, param.padding.left, param.padding.right,
+    fn->configure(ifm_alloc, param.ifm_shape, param.padding.left, param.padding.right,
                   param.padding.top, param.padding.bottom, param.stride.horizontal,
-                  param.stride.vertical, param.kw, param.kh, param.activation, ofm_alloc->buffer(),
+                  param.stride.vertical, param.kw, param.kh, param.activation, ofm_alloc,
                   param.ofm_shape);
 
     builder.append(std::move(fn));
@@ -368,17 +491,15 @@ Stage StageGenerator::generate(const graph::operation::Concat::Node &node)
   return [tensors, param](IExecutionBuilder &builder) {
     auto output_alloc = tensors->at(::neurun::graph::operand::Index{param.output_index}).get();
 
-    std::vector<const uint8_t *> input_buffers;
+    std::vector<const ::arm_compute::ITensor *> input_allocs;
     for (auto ifm_ind : param.input_indexes)
     {
-      input_buffers.emplace_back(
-          tensors->at(::neurun::graph::operand::Index{ifm_ind}).get()->buffer());
+      input_allocs.emplace_back(tensors->at(::neurun::graph::operand::Index{ifm_ind}).get());
     }
 
     std::unique_ptr<::neurun::kernel::cpu::ConcatLayer> fn{new ::neurun::kernel::cpu::ConcatLayer};
 
-    fn->configure(input_buffers, param.ifm_shapes, param.axis, output_alloc->buffer(),
-                  param.ofm_shape);
+    fn->configure(input_allocs, param.ifm_shapes, param.axis, output_alloc, param.ofm_shape);
 
     builder.append(std::move(fn));
   };
@@ -435,9 +556,8 @@ Stage StageGenerator::generate(const graph::operation::FullyConnected::Node &nod
     std::unique_ptr<::neurun::kernel::cpu::FullyConnectedLayer> fn{
         new ::neurun::kernel::cpu::FullyConnectedLayer};
 
-    fn->configure(input_alloc->buffer(), param.ifm_shape, weight_alloc->buffer(),
-                  param.weight_shape, bias_alloc->buffer(), param.bias_shape, param.activation,
-                  output_alloc->buffer(), param.ofm_shape);
+    fn->configure(input_alloc, param.ifm_shape, weight_alloc, param.weight_shape, bias_alloc,
+                  param.bias_shape, param.activation, output_alloc, param.ofm_shape);
 
     builder.append(std::move(fn));
   };
@@ -474,7 +594,7 @@ Stage StageGenerator::generate(const graph::operation::Reshape::Node &node)
     std::unique_ptr<::neurun::kernel::cpu::ReshapeLayer> fn{
         new ::neurun::kernel::cpu::ReshapeLayer};
 
-    fn->configure(input_alloc->buffer(), param.ifm_shape, output_alloc->buffer(), param.ofm_shape);
+    fn->configure(input_alloc, param.ifm_shape, output_alloc, param.ofm_shape);
 
     builder.append(std::move(fn));
   };
@@ -518,8 +638,7 @@ Stage StageGenerator::generate(const graph::operation::Softmax::Node &node)
     std::unique_ptr<::neurun::kernel::cpu::SoftMaxLayer> fn{
         new ::neurun::kernel::cpu::SoftMaxLayer};
 
-    fn->configure(input_alloc->buffer(), param.ifm_shape, param.scale, output_alloc->buffer(),
-                  param.ofm_shape);
+    fn->configure(input_alloc, param.ifm_shape, param.scale, output_alloc, param.ofm_shape);
 
     builder.append(std::move(fn));
   };
@@ -531,6 +650,49 @@ Stage StageGenerator::generate(const graph::operation::NOP::Node & /* node */)
   return nullptr;
 }
 
+Stage StageGenerator::generate(const graph::operation::Permute::Node &node)
+{
+  VERBOSE(Permute) << "generate CPU Permute" << std::endl;
+
+  const ::neurun::graph::operand::Index output_index{node.getOutputs().at(0)};
+  const ::neurun::graph::operand::Index input_index{node.getInputs().at(0)};
+
+  struct Param
+  {
+    int output_index;
+    int input_index;
+
+    ::neurun::kernel::cpu::Shape shape;
+    ::neurun::graph::operation::Permute::Type type;
+  };
+
+  Param param;
+
+  param.output_index = output_index.asInt();
+  param.input_index = input_index.asInt();
+
+  param.shape = ::neurun::kernel::cpu::getShape(_ctx.at(output_index));
+  param.type = node.param().type;
+
+  // NOTE The input and the output are in the tensors of the backends around this Permute
+  auto input_tensors = node.lower_info()->input_backend().tensor_builder();
+  auto output_tensors = node.lower_info()->output_backend().tensor_builder();
+
+  return [input_tensors, output_tensors, param](IExecutionBuilder &builder) {
+    auto output_object =
+        output_tensors->wrapTensor(::neurun::graph::operand::Index{param.output_index});
+    auto input_object =
+        input_tensors->wrapTensor(::neurun::graph::operand::Index{param.input_index});
+
+    std::unique_ptr<::neurun::kernel::cpu::PermuteLayer> fn{
+        new ::neurun::kernel::cpu::PermuteLayer};
+
+    fn->configure(input_object, output_object, param.shape, param.type);
+
+    builder.append(std::move(fn));
+  };
+}
+
 } // namespace neurun
 } // namespace backend
 } // namespace cpu
@@ -19,6 +19,8 @@
 #include <cassert>
 
 #include "operand/Object.h"
+#include "MemoryPlanner.h"
+#include "logging.h"
 
 namespace neurun
 {
@@ -39,6 +41,32 @@ void TensorBuilder::mark(const ::neurun::graph::operand::Index &ind)
   _inds.insert(ind);
 }
 
+void TensorBuilder::notifyFirstUse(const ::neurun::graph::operand::Index &ind)
+{
+  assert(_inds.find(ind) != _inds.end());
+
+  _lifetimes.emplace_back(ind, true);
+}
+
+void TensorBuilder::notifyLastUse(const ::neurun::graph::operand::Index &ind)
+{
+  assert(_inds.find(ind) != _inds.end());
+
+  _lifetimes.emplace_back(ind, false);
+}
+
+bool TensorBuilder::supportAliasing(void) const { return true; }
+
+void TensorBuilder::alias(const ::neurun::graph::operand::Index &ind,
+                          const ::neurun::graph::operand::Index &parent, size_t offset)
+{
+  assert(_tensors.size() == 0);
+  assert(_inds.find(ind) != _inds.end() && _inds.find(parent) != _inds.end());
+  assert(_aliases.find(ind) == _aliases.end());
+
+  _aliases.emplace(ind, std::make_pair(parent, offset));
+}
+
 void TensorBuilder::prepare(codegen::Plan &plan,
                             const std::map<int, ::arm_compute::TensorInfo> &tensor_info_ctx)
 {
@@ -48,21 +76,109 @@ void TensorBuilder::prepare(codegen::Plan &plan,
   {
     ::neurun::graph::operand::Index ind{ind_int};
     auto tensor = std::make_shared<operand::Tensor>(tensor_info_ctx.at(ind.asInt()));
-    // TODO Fix allocation here. When Tensor object is created the memory for tensor is also
-    //      allocated, and this must be fixed.
     plan.operands().set(ind, std::make_shared<operand::Object>(tensor));
     _tensors[ind] = tensor;
   }
+
+  // Operand that owns the memory of each operand, and the offset in it
+  auto root_of = [&](const ::neurun::graph::operand::Index &ind) {
+    uint32_t root = ind.value();
+    size_t offset = 0;
+
+    for (auto it = _aliases.find(ind); it != _aliases.end(); it = _aliases.find(it->second.first))
+    {
+      root = it->second.first.value();
+      offset += it->second.second;
+    }
+
+    return std::make_pair(::neurun::graph::operand::Index{root}, offset);
+  };
+
+  // An owner is alive from the first use to the last use of any operand in its memory. Operands
+  // that are never released keep their owners alive until the end.
+  std::unordered_map<::neurun::graph::operand::Index, uint32_t> pending_uses;
+  std::unordered_map<::neurun::graph::operand::Index, uint32_t> last_uses;
+
+  for (uint32_t pos = 0; pos < _lifetimes.size(); ++pos)
+  {
+    const auto root = root_of(_lifetimes[pos].first).first;
+
+    if (_lifetimes[pos].second)
+    {
+      pending_uses[root] += 1;
+    }
+    else
+    {
+      pending_uses[root] -= 1;
+      last_uses[root] = pos;
+    }
+  }
+
+  // Pack the operands whose lifetimes do not overlap into the same region
+  auto mem_planner = createMemoryPlanner();
+
+  size_t naive_size = 0;
+  std::unordered_set<::neurun::graph::operand::Index> claimed;
+
+  for (uint32_t pos = 0; pos < _lifetimes.size(); ++pos)
+  {
+    const auto &ind = _lifetimes[pos].first;
+    const auto root = root_of(ind).first;
+
+    if (_lifetimes[pos].second)
+    {
+      naive_size += _tensors.at(ind)->info()->total_size();
+
+      if (claimed.insert(root).second)
+      {
+        mem_planner->claim(root, _tensors.at(root)->info()->total_size());
+      }
+    }
+    else if ((pending_uses.at(root) == 0) && (last_uses.at(root) == pos))
+    {
+      mem_planner->release(root);
+    }
+  }
+
+  assert(mem_planner->plans().size() + _aliases.size() == _tensors.size());
+
+  // NOTE CPU kernels take raw buffer pointers when stages are processed, which happens before
+  //      'allocate', so the buffers are assigned here.
+  _mem_alloc = std::make_shared<MemoryAllocator>(mem_planner->capacity());
+
+  for (const auto &entry : _tensors)
+  {
+    const auto root = root_of(entry.first);
+    const auto &block = mem_planner->plans().at(root.first);
+
+    assert(root.second + entry.second->info()->total_size() <= block.size);
+    entry.second->setBuffer(_mem_alloc->base() + block.offset + root.second);
+  }
+
+  VERBOSE(MemoryPlanner) << "CPU tensors: " << _tensors.size() << " (" << _aliases.size()
+                         << " aliased), planned " << _mem_alloc->capacity() << " bytes (naive "
+                         << naive_size << " bytes)" << std::endl;
 }
 
 void TensorBuilder::allocate(void)
 {
   assert(_inds.size() == _tensors.size());
 
-  // NOTE For now nothing to do. Allocation is done in prepare stage, which is wrong
+  // NOTE For now nothing to do. The arena is allocated in prepare stage
   //      See also: comment in `prepare()`
 }
 
+size_t TensorBuilder::allocatedBytes(void) const
+{
+  return (_mem_alloc == nullptr) ? 0 : _mem_alloc->capacity();
+}
+
+std::shared_ptr<backend::operand::IObject>
+TensorBuilder::wrapTensor(const ::neurun::graph::operand::Index &ind)
+{
+  return std::make_shared<operand::Object>(_tensors.at(ind));
+}
+
 std::shared_ptr<operand::Tensor> TensorBuilder::at(const ::neurun::graph::operand::Index &ind)
 {
   return _tensors.at(ind);
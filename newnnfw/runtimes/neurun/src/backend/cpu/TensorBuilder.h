@@ -19,9 +19,11 @@
 
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include "backend/ITensorBuilder.h"
 #include "backend/cpu/operand/Tensor.h"
+#include "backend/cpu/MemoryAllocator.h"
 #include "graph/operand/Index.h"
 
 namespace neurun
@@ -39,15 +41,28 @@ public:
   TensorBuilder();
 
   virtual void mark(const ::neurun::graph::operand::Index &ind) override;
+  virtual void notifyFirstUse(const ::neurun::graph::operand::Index &ind) override;
+  virtual void notifyLastUse(const ::neurun::graph::operand::Index &ind) override;
+  virtual bool supportAliasing(void) const override;
+  virtual void alias(const ::neurun::graph::operand::Index &ind,
+                     const ::neurun::graph::operand::Index &parent, size_t offset) override;
   virtual void prepare(codegen::Plan &plan,
                        const std::map<int, ::arm_compute::TensorInfo> &tensor_info_ctx) override;
   virtual void allocate(void) override;
+  virtual size_t allocatedBytes(void) const override;
+  virtual std::shared_ptr<backend::operand::IObject>
+  wrapTensor(const ::neurun::graph::operand::Index &ind) override;
 
   std::shared_ptr<operand::Tensor> at(const ::neurun::graph::operand::Index &ind);
 
 private:
   std::unordered_set<graph::operand::Index> _inds;
+  // Lifetime notifications in the linear order ('true' for first use)
+  std::vector<std::pair<graph::operand::Index, bool>> _lifetimes;
+  // Operand whose tensor each aliased operand lives in, and the offset in bytes
+  std::unordered_map<graph::operand::Index, std::pair<graph::operand::Index, size_t>> _aliases;
   std::unordered_map<graph::operand::Index, std::shared_ptr<operand::Tensor>> _tensors;
+  std::shared_ptr<MemoryAllocator> _mem_alloc;
 };
 
 } // namespace cpu
@@ -34,11 +34,10 @@ class Tensor : public ::arm_compute::ITensor
 public:
   Tensor() = default;
 
+  // NOTE The buffer is assigned later by TensorBuilder
   Tensor(::arm_compute::TensorInfo info) : _info(info)
   {
-    // TODO Do not allocate buffer here. This tensor is just an abstract Tensor object for cpu.
-    uint32_t size = _info.total_size(); // NOTE This size may not be accurate
-    _buffer = new uint8_t[size];        // NOTE The allocated buffer is never deallocated.
+    // DO NOTHING
   }
 
   Tensor(uint8_t *buffer) : _buffer(buffer)
@@ -0,0 +1,264 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BackendCalibrator.h"
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <unordered_set>
+#include <vector>
+
+#include "backend/BackendManager.h"
+#include "backend/IBackendConfig.h"
+#include "backend/NotSupportedError.h"
+#include "codegen/IPlanBuilder.h"
+#include "codegen/PlanBuilder.h"
+#include "codegen/Planner.h"
+#include "graph/operation/LowerInfo.h"
+#include "graph/operation/Permute.h"
+#include "kernel/cpu/PermuteLayer.h"
+#include "nnfw/std/memory.h"
+#include "util/EnvVar.h"
+
+#include "logging.h"
+
+namespace
+{
+
+using namespace neurun;
+
+// Collects the shape constraints, initializers and stages that Planner generates for an operation
+class OperationPlanBuilder final : public codegen::IPlanBuilder
+{
+public:
+  void addShapeConstr(const graph::operand::Index &ind,
+                      const ::arm_compute::TensorInfo &info) override
+  {
+    tensor_info_ctx[ind.asInt()] = info;
+  }
+
+  void addInitializer(const graph::operand::Index &ind, const Initializer &initializer) override
+  {
+    initializer_ctx[ind.asInt()] = initializer;
+  }
+
+  void addStage(const graph::operation::Node &, const Stage &stage) override
+  {
+    stages.emplace_back(stage);
+  }
+
+public:
+  std::map<int, ::arm_compute::TensorInfo> tensor_info_ctx;
+  std::map<int, Initializer> initializer_ctx;
+  std::vector<Stage> stages;
+};
+
+// NOTE The number of runs is read from NEURUN_CALIBRATION_REPEAT (default: 5)
+uint32_t repeat(void)
+{
+  static const int value = nnfw::util::EnvVar{"NEURUN_CALIBRATION_REPEAT"}.asInt(5);
+  return static_cast<uint32_t>(std::max(value, 1));
+}
+
+// Returns the shortest time (in microseconds) that 'fn' takes over the runs after a warm-up run
+double shortest(const std::function<void(void)> &fn)
+{
+  using namespace std::chrono;
+
+  // NOTE The first run of a function may include one-off work such as OpenCL kernel compilation
+  fn();
+
+  double best = codegen::BackendCalibrator::kUnsupported;
+
+  for (uint32_t n = 0; n < repeat(); ++n)
+  {
+    const auto begin = steady_clock::now();
+    fn();
+    const auto end = steady_clock::now();
+
+    best = std::min(best, duration<double, std::micro>(end - begin).count());
+  }
+
+  return best;
+}
+
+void fillZero(::arm_compute::ITensor &tensor)
+{
+  std::memset(tensor.buffer(), 0, tensor.info()->total_size());
+}
+
+} // namespace
+
+namespace neurun
+{
+namespace codegen
+{
+
+constexpr double BackendCalibrator::kUnsupported;
+
+double BackendCalibrator::measure(const graph::operation::Index &index, const std::string &key)
+{
+  auto &node = _graph.operations().at(index);
+  const auto &operands = _graph.operands();
+
+  // NOTE A new BackendManager is used to get tensor builders that have nothing marked
+  backend::BackendManager manager{operands};
+  auto backend = manager.get(key);
+
+  node.lower_info(nnfw::make_unique<graph::operation::LowerInfo>(backend));
+
+  std::unordered_set<graph::operand::Index> indexes;
+  for (const auto &ind : node.getInputs())
+  {
+    indexes.insert(ind);
+  }
+  for (const auto &ind : node.getOutputs())
+  {
+    indexes.insert(ind);
+  }
+
+  try
+  {
+    OperationPlanBuilder builder;
+    node.accept(Planner{operands, builder});
+
+    auto tensor_builder = backend.tensor_builder();
+    for (const auto &ind : indexes)
+    {
+      tensor_builder->mark(ind);
+      tensor_builder->notifyFirstUse(ind);
+    }
+
+    // NOTE This plan has no model as it is never given to an execution
+    Plan plan{nullptr};
+
+    tensor_builder->prepare(plan, builder.tensor_info_ctx);
+
+    ExecutionBuilder execution_builder{plan};
+    for (const auto &stage : builder.stages)
+    {
+      stage(execution_builder);
+    }
+
+    tensor_builder->allocate();
+
+    // Fill weights, and clear the other operands so that garbage values (e.g. NaN) do not
+    // affect the measurement
+    for (const auto &ind : indexes)
+    {
+      auto it = builder.initializer_ctx.find(ind.asInt());
+
+      for (auto object : plan.operands().at(ind))
+      {
+        if (it != builder.initializer_ctx.end())
+        {
+          object->access(it->second);
+        }
+        else
+        {
+          object->access(fillZero);
+        }
+      }
+    }
+
+    _tensor_info_ctx.insert(builder.tensor_info_ctx.begin(), builder.tensor_info_ctx.end());
+
+    const auto &operations = plan.operations();
+    const auto config = backend.config();
+
+    const auto elapsed = shortest([&](void) {
+      for (uint32_t n = 0; n < operations.size(); ++n)
+      {
+        operations.at(n).run();
+      }
+      config->sync();
+    });
+
+    VERBOSE(BackendCalibrator) << "Operation #" << index.value() << " on " << key << ": "
+                               << elapsed << " us" << std::endl;
+
+    return elapsed;
+  }
+  catch (const backend::NotSupportedError &e)
+  {
+    // NOTE Other errors are not caught, as they are not about which backend is faster
+    VERBOSE(BackendCalibrator) << "Operation #" << index.value() << " on " << key
+                               << ": not supported (" << e.what() << ")" << std::endl;
+
+    return kUnsupported;
+  }
+}
+
+double BackendCalibrator::measurePermute(const graph::operand::Index &index,
+                                         const std::string &from, const std::string &to)
+{
+  auto it = _tensor_info_ctx.find(index.asInt());
+
+  // NOTE An operand stays where it is within a backend
+  if (from == to || it == _tensor_info_ctx.end())
+  {
+    return 0.0;
+  }
+
+  const std::map<int, ::arm_compute::TensorInfo> tensor_info_ctx{*it};
+
+  backend::BackendManager manager{_graph.operands()};
+  const auto source = manager.get(from);
+  const auto target = manager.get(to);
+
+  // NOTE This plan has no model as it is never given to an execution
+  Plan plan{nullptr};
+
+  for (const auto &backend : {source, target})
+  {
+    auto tensor_builder = backend.tensor_builder();
+
+    tensor_builder->mark(index);
+    tensor_builder->notifyFirstUse(index);
+    tensor_builder->prepare(plan, tensor_info_ctx);
+    tensor_builder->allocate();
+  }
+
+  const auto &objects = plan.operands().at(index);
+  assert(objects.size() == 2);
+
+  objects.at(0)->access(fillZero);
+
+  const auto &object = _graph.operands().at(index);
+  const auto type = graph::operation::Permute::typeOf(object.shape(),
+                                                      source.config()->getOperandLayout(),
+                                                      target.config()->getOperandLayout());
+
+  kernel::cpu::PermuteLayer permute;
+  permute.configure(objects.at(0), objects.at(1), kernel::cpu::getShape(object), type);
+
+  const auto elapsed = shortest([&](void) {
+    permute.run();
+    source.config()->sync();
+    target.config()->sync();
+  });
+
+  VERBOSE(BackendCalibrator) << "Operand #" << index.value() << " from " << from << " to " << to
+                             << ": " << elapsed << " us" << std::endl;
+
+  return elapsed;
+}
+
+} // namespace codegen
+} // namespace neurun
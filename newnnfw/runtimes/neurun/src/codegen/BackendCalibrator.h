@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NEURUN_CODEGEN_BACKEND_CALIBRATOR_H__
+#define __NEURUN_CODEGEN_BACKEND_CALIBRATOR_H__
+
+#include <map>
+#include <string>
+
+#include <arm_compute/core/TensorInfo.h>
+
+#include "graph/Graph.h"
+
+namespace neurun
+{
+namespace codegen
+{
+
+// Measures how long it takes to run each operation on each backend, and to move an operand from
+// a backend to another, by building and running a plan for a single operation
+class BackendCalibrator
+{
+public:
+  // Cost of an operation that a backend does not support
+  static constexpr double kUnsupported = 1e30;
+
+public:
+  BackendCalibrator(graph::Graph &graph) : _graph(graph)
+  {
+    // DO NOTHING
+  }
+
+public:
+  // Returns the time (in microseconds) that an operation takes on a backend
+  //
+  // NOTE This overwrites the LowerInfo of the operation
+  double measure(const graph::operation::Index &index, const std::string &backend);
+  // Returns the time (in microseconds) that it takes to move an operand between backends
+  //
+  // NOTE The operand should be used by an operation that has been measured
+  double measurePermute(const graph::operand::Index &index, const std::string &from,
+                        const std::string &to);
+
+private:
+  graph::Graph &_graph;
+  // Shapes of the operands of the measured operations
+  std::map<int, ::arm_compute::TensorInfo> _tensor_info_ctx;
+};
+
+} // namespace codegen
+} // namespace neurun
+
+#endif // __NEURUN_CODEGEN_BACKEND_CALIBRATOR_H__
@@ -16,12 +16,396 @@
 
 #include "BackendResolver.h"
 
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "backend/IInitializerGenerator.h"
+#include "backend/IStageGenerator.h"
+#include "codegen/BackendCalibrator.h"
+#include "codegen/Hasher.h"
+#include "codegen/LatencyModel.h"
+#include "util/EnvVar.h"
+
+#include "logging.h"
+
+namespace
+{
+
+using namespace neurun;
+
+using Assignment = codegen::LatencyModel::Assignment;
+
+// Hashes what the backend assignment of a model depends on
+//
+// NOTE Constant values are not hashed except small ones (e.g. strides, paddings) as they do not
+//      change the latency of operations
+uint64_t hash(const graph::Graph &graph, const std::vector<graph::operation::Index> &operations)
+{
+  codegen::Hasher hasher;
+
+  auto update_operand = [&](const graph::operand::Index &index) {
+    const auto &object = graph.operands().at(index);
+    const auto &shape = object.shape();
+
+    hasher.update(static_cast<int32_t>(object.typeInfo().type()));
+    hasher.update(object.typeInfo().scale());
+    hasher.update(object.typeInfo().offset());
+    for (uint32_t axis = 0; axis < shape.rank(); ++axis)
+    {
+      hasher.update(shape.dim(axis));
+    }
+    if (object.isConstant() && object.data().size() <= 64)
+    {
+      hasher.update(object.data().base(), object.data().size());
+    }
+  };
+
+  for (const auto &index : operations)
+  {
+    const auto &node = graph.operations().at(index);
+
+    hasher.update(std::string{typeid(node).name()});
+    for (const auto &ind : node.getInputs())
+    {
+      update_operand(ind);
+    }
+    for (const auto &ind : node.getOutputs())
+    {
+      update_operand(ind);
+    }
+  }
+
+  return hasher.value();
+}
+
+// NOTE The directory is read from NEURUN_BACKEND_PROFILE_DIR. Assignments are neither saved nor
+//      loaded unless it is set, as a shared directory (e.g. /tmp) lets others plant a profile.
+std::string profilePath(uint64_t key)
+{
+  const auto dir = nnfw::util::EnvVar{"NEURUN_BACKEND_PROFILE_DIR"}.asString("");
+
+  if (dir.empty())
+  {
+    return "";
+  }
+
+  char name[64];
+  std::snprintf(name, sizeof(name), "/neurun_backend_%016llx.txt",
+                static_cast<unsigned long long>(key));
+
+  return dir + name;
+}
+
+bool load(const std::string &path, const std::vector<graph::operation::Index> &operations,
+          const std::vector<std::string> &keys, Assignment &assignment)
+{
+  std::ifstream file{path};
+
+  if (!file)
+  {
+    return false;
+  }
+
+  // Each line has an operation index and the key of its backend
+  std::unordered_map<uint32_t, std::string> entries;
+
+  std::string line;
+  while (std::getline(file, line))
+  {
+    std::istringstream iss{line};
+    uint32_t index;
+    std::string key;
+
+    if (iss >> index >> key)
+    {
+      entries[index] = key;
+    }
+  }
+
+  Assignment loaded(operations.size());
+
+  for (uint32_t n = 0; n < operations.size(); ++n)
+  {
+    auto it = entries.find(operations[n].value());
+    if (it == entries.end())
+    {
+      return false;
+    }
+
+    auto key = std::find(keys.begin(), keys.end(), it->second);
+    if (key == keys.end())
+    {
+      return false;
+    }
+
+    loaded[n] = key - keys.begin();
+  }
+
+  assignment = loaded;
+
+  return true;
+}
+
+void save(const std::string &path, const std::vector<graph::operation::Index> &operations,
+          const std::vector<std::string> &keys, const Assignment &assignment)
+{
+  std::ostringstream oss;
+
+  for (uint32_t n = 0; n < operations.size(); ++n)
+  {
+    oss << operations[n].value() << " " << keys[assignment[n]] << std::endl;
+  }
+
+  const auto content = oss.str();
+
+  // NOTE The assignment is written to a new temporary file (created with O_EXCL by mkstemp) and
+  //      then renamed, so that others never read a partial one nor redirect the write
+  std::vector<char> tmp_path(path.begin(), path.end());
+  const std::string suffix{".XXXXXX"};
+  tmp_path.insert(tmp_path.end(), suffix.begin(), suffix.end());
+  tmp_path.push_back('\0');
+
+  const int fd = mkstemp(tmp_path.data());
+
+  bool saved = (fd != -1);
+
+  for (size_t offset = 0; saved && offset < content.size();)
+  {
+    const auto written = write(fd, content.data() + offset, content.size() - offset);
+
+    if (written < 0)
+    {
+      saved = false;
+      break;
+    }
+
+    offset += written;
+  }
+
+  if (fd != -1)
+  {
+    saved = (close(fd) == 0) && saved;
+    saved = saved && (std::rename(tmp_path.data(), path.c_str()) == 0);
+
+    if (!saved)
+    {
+      std::remove(tmp_path.data());
+    }
+  }
+
+  if (!saved)
+  {
+    VERBOSE(BackendResolver) << "Failed to save backend assignment to " << path << std::endl;
+  }
+}
+
+Assignment calibrate(graph::Graph &graph, const std::vector<graph::operation::Index> &operations,
+                     const std::vector<std::string> &keys)
+{
+  const auto &operands = graph.operands();
+
+  codegen::BackendCalibrator calibrator{graph};
+  codegen::LatencyModel model(operations.size());
+
+  std::unordered_map<graph::operation::Index, uint32_t> positions;
+
+  for (uint32_t n = 0; n < operations.size(); ++n)
+  {
+    positions[operations[n]] = n;
+
+    for (const auto &key : keys)
+    {
+      model.exec[n].emplace_back(calibrator.measure(operations[n], key));
+    }
+  }
+
+  // Measure the cost of moving each operand that an operation passes to other operations
+  std::vector<graph::operand::Index> passed;
+
+  for (uint32_t n = 0; n < operations.size(); ++n)
+  {
+    for (const auto &ind : graph.operations().at(operations[n]).getOutputs())
+    {
+      passed.emplace_back(ind);
+    }
+  }
+
+  for (const auto &ind : passed)
+  {
+    const auto &object = operands.at(ind);
+
+    codegen::LatencyModel::Edge edge;
+
+    edge.def = positions.at(object.getDef().list().front());
+    for (const auto &use : object.getUses().list())
+    {
+      auto it = positions.find(use);
+      if (it != positions.end())
+      {
+        edge.uses.emplace_back(it->second);
+      }
+    }
+
+    if (edge.uses.empty())
+    {
+      continue;
+    }
+
+    edge.permute.resize(keys.size(), std::vector<double>(keys.size(), 0.0));
+    for (uint32_t from = 0; from < keys.size(); ++from)
+    {
+      for (uint32_t to = 0; to < keys.size(); ++to)
+      {
+        if (from != to)
+        {
+          edge.permute[from][to] = calibrator.measurePermute(ind, keys[from], keys[to]);
+        }
+      }
+    }
+
+    model.addEdge(std::move(edge));
+  }
+
+  for (uint32_t b = 0; b < keys.size(); ++b)
+  {
+    VERBOSE(BackendResolver) << "Estimated latency on " << keys[b] << " only: "
+                             << model.total(Assignment(operations.size(), b)) << " us"
+                             << std::endl;
+  }
+
+  return model.search(keys.size());
+}
+
+} // namespace
+
 namespace neurun
 {
 namespace codegen
 {
 
-// NOT IMPLEMENTED
+BackendResolver::BackendResolver(
+    graph::Graph &graph, const std::unordered_map<graph::operation::Index, std::string> &backends)
+{
+  _backend_manager = std::make_shared<backend::BackendManager>(graph.operands());
+
+  const auto &backend_all_str =
+      ::nnfw::util::EnvVar{std::string("OP_BACKEND_ALLOPS")}.asString("none");
+  if (backend_all_str.compare("none") != 0 && backend_all_str.compare("auto") != 0)
+  {
+    VERBOSE(BackendResolver) << "Use backend for all ops: " << backend_all_str << std::endl;
+#define OP(InternalName, NnApiName)                                   \
+  {                                                                   \
+    auto backend = _backend_manager->get(backend_all_str);            \
+    _gen_map[typeid(graph::operation::InternalName::Node)] = backend; \
+  }
+#include "graph/operation/Op.lst"
+#undef OP
+  }
+  else
+  {
+#define OP(InternalName, NnApiName)                                                               \
+  {                                                                                               \
+    const auto &backend_str =                                                                     \
+        ::nnfw::util::EnvVar{std::string("OP_BACKEND_") + #NnApiName}.asString("acl_cl");         \
+    auto backend = _backend_manager->get(backend_str);                                            \
+    VERBOSE(BackendResolver) << "backend for " << #NnApiName << ": " << backend_str << std::endl; \
+    _gen_map[typeid(graph::operation::InternalName::Node)] = backend;                             \
+  }
+
+#include "graph/operation/Op.lst"
+#undef OP
+  }
+
+  if (!backends.empty())
+  {
+    const auto keys = _backend_manager->keys();
+
+    for (const auto &entry : backends)
+    {
+      if (std::find(keys.begin(), keys.end(), entry.second) != keys.end())
+      {
+        _node_map[entry.first] = _backend_manager->get(entry.second);
+      }
+    }
+  }
+  // NOTE Set OP_BACKEND_ALLOPS as "auto" to assign backends by profiling operations on every
+  //      backend. The backends above are used for the operations that cannot be profiled.
+  else if (backend_all_str.compare("auto") == 0)
+  {
+    assignByProfile(graph);
+  }
+}
+
+const backend::Backend &BackendResolver::getBackend(const graph::operation::Index &index,
+                                                    const graph::operation::Node &node)
+{
+  auto it = _node_map.find(index);
+  if (it != _node_map.end())
+  {
+    return it->second;
+  }
+
+  return _gen_map[typeid(node)];
+}
+
+void BackendResolver::assignByProfile(graph::Graph &graph)
+{
+  const auto keys = _backend_manager->keys();
+
+  // Operations that some backend may run
+  std::vector<graph::operation::Index> operations;
+
+  graph.operations().iterate(
+      [&](const graph::operation::Index &index, const graph::operation::Node &node) {
+        if (_gen_map.find(typeid(node)) != _gen_map.end())
+        {
+          operations.emplace_back(index);
+        }
+      });
+
+  std::sort(operations.begin(), operations.end(),
+            [](const graph::operation::Index &lhs, const graph::operation::Index &rhs) {
+              return lhs.value() < rhs.value();
+            });
+
+  const auto path = profilePath(hash(graph, operations));
+
+  Assignment assignment;
+
+  if (!path.empty() && load(path, operations, keys, assignment))
+  {
+    VERBOSE(BackendResolver) << "Load backend assignment from " << path << std::endl;
+  }
+  else
+  {
+    VERBOSE(BackendResolver) << "Calibrate backends: " << operations.size() << " operations"
+                             << std::endl;
+
+    assignment = calibrate(graph, operations, keys);
+
+    if (!path.empty())
+    {
+      save(path, operations, keys, assignment);
+    }
+  }
+
+  for (uint32_t n = 0; n < operations.size(); ++n)
+  {
+    const auto &key = keys[assignment[n]];
+
+    VERBOSE(BackendResolver) << "backend for operation #" << operations[n].value() << ": " << key
+                             << std::endl;
+    _node_map[operations[n]] = _backend_manager->get(key);
+  }
+}
 
 } // namespace codegen
 } // namespace neurun
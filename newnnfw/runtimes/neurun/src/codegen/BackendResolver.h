@@ -17,15 +17,12 @@
 #ifndef __NEURUN_CODEGEN_BACKEND_RESOLVER_H__
 #define __NEURUN_CODEGEN_BACKEND_RESOLVER_H__
 
-#include <set>
+#include <string>
 #include <unordered_map>
 #include <typeindex>
 
-#include "logging.h"
-#include "util/EnvVar.h"
 #include "backend/BackendManager.h"
-#include "backend/IInitializerGenerator.h"
-#include "backend/IStageGenerator.h"
+#include "graph/Graph.h"
 
 namespace neurun
 {
@@ -35,44 +32,23 @@ namespace codegen
 class BackendResolver
 {
 public:
-  BackendResolver(const neurun::graph::operand::Set &operands)
-  {
-    _backend_manager = std::make_shared<backend::BackendManager>(operands);
-
-    const auto &backend_all_str =
-        ::nnfw::util::EnvVar{std::string("OP_BACKEND_ALLOPS")}.asString("none");
-    if (backend_all_str.compare("none") != 0)
-    {
-      VERBOSE(BackendResolver) << "Use backend for all ops: " << backend_all_str << std::endl;
-#define OP(InternalName, NnApiName)                                   \
-  {                                                                   \
-    auto backend = _backend_manager->get(backend_all_str);            \
-    _gen_map[typeid(graph::operation::InternalName::Node)] = backend; \
-  }
-#include "graph/operation/Op.lst"
-#undef OP
-    }
-    else
-    {
-#define OP(InternalName, NnApiName)                                                               \
-  {                                                                                               \
-    const auto &backend_str =                                                                     \
-        ::nnfw::util::EnvVar{std::string("OP_BACKEND_") + #NnApiName}.asString("acl_cl");         \
-    auto backend = _backend_manager->get(backend_str);                                            \
-    VERBOSE(BackendResolver) << "backend for " << #NnApiName << ": " << backend_str << std::endl; \
-    _gen_map[typeid(graph::operation::InternalName::Node)] = backend;                             \
-  }
-
-#include "graph/operation/Op.lst"
-#undef OP
-    }
-  }
+  // NOTE 'backends' gives the backends of some operations (e.g. from a cached plan), which take
+  //      priority over the other ways of assignment
+  BackendResolver(graph::Graph &graph,
+                  const std::unordered_map<graph::operation::Index, std::string> &backends = {});
 
 public:
-  const backend::Backend &getBackend(const std::type_index &type) { return _gen_map[type]; }
+  const backend::Backend &getBackend(const graph::operation::Index &index,
+                                     const graph::operation::Node &node);
+  backend::Backend getBackend(const std::string &key) { return _backend_manager->get(key); }
+
+private:
+  void assignByProfile(graph::Graph &graph);
 
 private:
   std::unordered_map<std::type_index, backend::Backend> _gen_map;
+  // Backends assigned to each operation by profiling or given explicitly
+  std::unordered_map<graph::operation::Index, backend::Backend> _node_map;
   std::shared_ptr<backend::BackendManager> _backend_manager;
 };
 
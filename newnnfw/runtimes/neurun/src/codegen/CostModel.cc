@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "CostModel.h"
+
+#include "graph/operand/Set.h"
+
+namespace
+{
+
+uint64_t elements(const neurun::graph::operand::Object &object)
+{
+  const auto &shape = object.shape();
+
+  uint64_t count = 1;
+
+  for (uint32_t axis = 0; axis < shape.rank(); ++axis)
+  {
+    count *= shape.dim(axis);
+  }
+
+  return count;
+}
+
+} // namespace
+
+namespace neurun
+{
+namespace codegen
+{
+
+nnfw::util::profiling::OperationCost CostModel::estimate(const graph::operation::Node &node)
+{
+  _cost = nnfw::util::profiling::OperationCost{0, 0, 0, 0, 0};
+
+  for (const auto &index : node.getInputs())
+  {
+    const auto &object = _ctx.at(index);
+
+    if (object.isConstant())
+    {
+      _cost.weight_bytes += object.operandSize();
+    }
+    else
+    {
+      _cost.input_bytes += object.operandSize();
+    }
+  }
+
+  for (const auto &index : node.getOutputs())
+  {
+    _cost.output_bytes += _ctx.at(index).operandSize();
+  }
+
+  node.accept(std::move(*this));
+
+  return _cost;
+}
+
+void CostModel::visit(const graph::operation::Conv2D::Implicit::Node &node)
+{
+  const auto ofm_index = node.getOutputs().at(0);
+  const auto ker_index = node.getInputs().at(1);
+
+  const auto ker_shape = _ctx.at(ker_index).shape().asKernel();
+
+  // Each output element accumulates a KER_H x KER_W x IFM_C window
+  _cost.macs = elements(_ctx.at(ofm_index)) * ker_shape.H * ker_shape.W * ker_shape.C;
+}
+
+void CostModel::visit(const graph::operation::DepthwiseConv2D::Implicit::Node &node)
+{
+  const auto ofm_index = node.getOutputs().at(0);
+  const auto ker_index = node.getInputs().at(1);
+
+  // NOTE DepthwiseConv2D kernel is of shape [1, KER_H, KER_W, IFM_C * MULTIPLIER]
+  const auto ker_shape = _ctx.at(ker_index).shape().asKernel();
+
+  _cost.macs = elements(_ctx.at(ofm_index)) * ker_shape.H * ker_shape.W;
+}
+
+void CostModel::visit(const graph::operation::MaxPool2D::Implicit::Node &node)
+{
+  const auto ofm_index = node.getOutputs().at(0);
+
+  const ::neurun::graph::operand::Index kh_index{node.param().kh_index};
+  const ::neurun::graph::operand::Index kw_index{node.param().kw_index};
+
+  const int32_t kh = _ctx.at(kh_index).asScalar<int32_t>();
+  const int32_t kw = _ctx.at(kw_index).asScalar<int32_t>();
+
+  // A comparison per element of a window
+  _cost.ops = elements(_ctx.at(ofm_index)) * kh * kw;
+}
+
+void CostModel::visit(const graph::operation::AvgPool2D::Implicit::Node &node)
+{
+  const auto ofm_index = node.getOutputs().at(0);
+
+  const ::neurun::graph::operand::Index kh_index{node.param().kh_index};
+  const ::neurun::graph::operand::Index kw_index{node.param().kw_index};
+
+  const int32_t kh = _ctx.at(kh_index).asScalar<int32_t>();
+  const int32_t kw = _ctx.at(kw_index).asScalar<int32_t>();
+
+  // An addition per element of a window
+  _cost.ops = elements(_ctx.at(ofm_index)) * kh * kw;
+}
+
+void CostModel::visit(const graph::operation::Concat::Node &)
+{
+  // DO NOTHING
+}
+
+void CostModel::visit(const graph::operation::Reshape::Node &)
+{
+  // DO NOTHING
+}
+
+void CostModel::visit(const graph::operation::FullyConnected::Node &node)
+{
+  const auto output_index = node.getOutputs().at(0);
+  const auto weight_index = node.getInputs().at(1);
+
+  // NOTE Weight is of shape [NUM_UNITS, INPUT_SIZE]
+  const auto input_size = _ctx.at(weight_index).shape().dim(1);
+
+  _cost.macs = elements(_ctx.at(output_index)) * input_size;
+}
+
+void CostModel::visit(const graph::operation::Softmax::Node &node)
+{
+  const auto output_index = node.getOutputs().at(0);
+
+  // max, exp(x - max), sum and division per element
+  _cost.ops = elements(_ctx.at(output_index)) * 4;
+}
+
+void CostModel::visit(const graph::operation::NOP::Node &)
+{
+  // DO NOTHING
+}
+
+void CostModel::visit(const graph::operation::Permute::Node &)
+{
+  // DO NOTHING
+}
+
+} // namespace codegen
+} // namespace neurun
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NEURUN_CODEGEN_COST_MODEL_H__
+#define __NEURUN_CODEGEN_COST_MODEL_H__
+
+#include "graph/operation/NodeVisitor.h"
+#include "util/profiling/Roofline.h"
+
+namespace neurun
+{
+namespace graph
+{
+namespace operand
+{
+class Set;
+} // namespace operand
+} // namespace graph
+} // namespace neurun
+
+namespace neurun
+{
+namespace codegen
+{
+
+// Estimates the arithmetic work and the memory traffic of a node from the shapes of its operands
+//
+// NOTE Every input and output is counted as read or written once, and constant inputs are
+//      counted as weights
+class CostModel : public graph::operation::NodeVisitor
+{
+public:
+  CostModel(const neurun::graph::operand::Set &ctx) : _ctx{ctx}, _cost{0, 0, 0, 0, 0}
+  {
+    // DO NOTHING
+  }
+
+public:
+  nnfw::util::profiling::OperationCost estimate(const graph::operation::Node &node);
+
+public:
+  virtual void visit(const graph::operation::Conv2D::Implicit::Node &) override;
+  virtual void visit(const graph::operation::DepthwiseConv2D::Implicit::Node &) override;
+  virtual void visit(const graph::operation::MaxPool2D::Implicit::Node &) override;
+  virtual void visit(const graph::operation::AvgPool2D::Implicit::Node &) override;
+  virtual void visit(const graph::operation::Concat::Node &) override;
+  virtual void visit(const graph::operation::Reshape::Node &) override;
+  virtual void visit(const graph::operation::FullyConnected::Node &) override;
+  virtual void visit(const graph::operation::Softmax::Node &) override;
+  virtual void visit(const graph::operation::NOP::Node &) override;
+  virtual void visit(const graph::operation::Permute::Node &) override;
+
+private:
+  const neurun::graph::operand::Set &_ctx;
+  nnfw::util::profiling::OperationCost _cost;
+};
+
+} // namespace codegen
+} // namespace neurun
+
+#endif // __NEURUN_CODEGEN_COST_MODEL_H__
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NEURUN_CODEGEN_HASHER_H__
+#define __NEURUN_CODEGEN_HASHER_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace neurun
+{
+namespace codegen
+{
+
+// FNV-1a hash over byte sequences
+class Hasher
+{
+public:
+  void update(const void *data, size_t size)
+  {
+    auto bytes = reinterpret_cast<const uint8_t *>(data);
+    for (size_t n = 0; n < size; ++n)
+    {
+      _value = (_value ^ bytes[n]) * 1099511628211ULL;
+    }
+  }
+
+  template <typename T> void update(const T &value) { update(&value, sizeof(T)); }
+
+  void update(const std::string &str) { update(str.data(), str.size()); }
+
+public:
+  uint64_t value(void) const { return _value; }
+
+private:
+  uint64_t _value = 14695981039346656037ULL;
+};
+
+} // namespace codegen
+} // namespace neurun
+
+#endif // __NEURUN_CODEGEN_HASHER_H__
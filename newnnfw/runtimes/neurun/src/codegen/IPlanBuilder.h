@@ -20,6 +20,7 @@
 #include "arm_compute/core/TensorInfo.h"
 #include "backend/IStageGenerator.h"
 #include "backend/IInitializerGenerator.h"
+#include "graph/operation/Node.h"
 
 namespace neurun
 {
@@ -34,7 +35,7 @@ struct IPlanBuilder
                               const ::arm_compute::TensorInfo &info) = 0;
   virtual void addInitializer(const ::neurun::graph::operand::Index &ind,
                               const Initializer &initializer) = 0;
-  virtual void addStage(const Stage &) = 0;
+  virtual void addStage(const graph::operation::Node &node, const Stage &) = 0;
 };
 
 } // namespace codegen
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "LatencyModel.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "logging.h"
+
+namespace neurun
+{
+namespace codegen
+{
+
+void LatencyModel::addEdge(Edge &&edge)
+{
+  const uint32_t n = _edges.size();
+
+  _edges_of[edge.def].emplace_back(n);
+  for (auto use : edge.uses)
+  {
+    auto &edges = _edges_of[use];
+    if (std::find(edges.begin(), edges.end(), n) == edges.end())
+    {
+      edges.emplace_back(n);
+    }
+  }
+
+  _edges.emplace_back(std::move(edge));
+}
+
+double LatencyModel::total(const Assignment &assignment) const
+{
+  double cost = 0.0;
+
+  for (uint32_t n = 0; n < exec.size(); ++n)
+  {
+    cost += exec[n][assignment[n]];
+  }
+  for (const auto &edge : _edges)
+  {
+    cost += permute(edge, assignment);
+  }
+
+  return cost;
+}
+
+double LatencyModel::local(uint32_t operation, const Assignment &assignment) const
+{
+  double cost = exec[operation][assignment[operation]];
+
+  for (auto n : _edges_of[operation])
+  {
+    cost += permute(_edges[n], assignment);
+  }
+
+  return cost;
+}
+
+LatencyModel::Assignment LatencyModel::search(uint32_t backend_count) const
+{
+  const uint32_t operation_count = exec.size();
+
+  std::vector<Assignment> starts;
+
+  for (uint32_t b = 0; b < backend_count; ++b)
+  {
+    starts.emplace_back(operation_count, b);
+  }
+
+  Assignment fastest(operation_count);
+  for (uint32_t n = 0; n < operation_count; ++n)
+  {
+    fastest[n] = std::min_element(exec[n].begin(), exec[n].end()) - exec[n].begin();
+  }
+  starts.emplace_back(fastest);
+
+  Assignment best;
+  double best_cost = std::numeric_limits<double>::max();
+
+  for (auto assignment : starts)
+  {
+    bool improved = true;
+
+    while (improved)
+    {
+      improved = false;
+
+      for (uint32_t n = 0; n < operation_count; ++n)
+      {
+        for (uint32_t b = 0; b < backend_count; ++b)
+        {
+          const auto current = assignment[n];
+          if (b == current)
+          {
+            continue;
+          }
+
+          const auto before = local(n, assignment);
+          assignment[n] = b;
+          const auto after = local(n, assignment);
+
+          if (after < before)
+          {
+            improved = true;
+          }
+          else
+          {
+            assignment[n] = current;
+          }
+        }
+      }
+    }
+
+    const auto cost = total(assignment);
+    if (cost < best_cost)
+    {
+      best = assignment;
+      best_cost = cost;
+    }
+  }
+
+  VERBOSE(LatencyModel) << "Estimated latency: " << best_cost << " us" << std::endl;
+
+  return best;
+}
+
+double LatencyModel::permute(const Edge &edge, const Assignment &assignment) const
+{
+  const auto from = assignment[edge.def];
+
+  // NOTE An operand is moved once for each backend that uses it
+  std::vector<bool> moved(edge.permute.size(), false);
+  double cost = 0.0;
+
+  for (auto use : edge.uses)
+  {
+    const auto to = assignment[use];
+    if (to != from && !moved[to])
+    {
+      cost += edge.permute[from][to];
+      moved[to] = true;
+    }
+  }
+
+  return cost;
+}
+
+} // namespace codegen
+} // namespace neurun
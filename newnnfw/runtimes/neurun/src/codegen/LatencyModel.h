@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NEURUN_CODEGEN_LATENCY_MODEL_H__
+#define __NEURUN_CODEGEN_LATENCY_MODEL_H__
+
+#include <cstdint>
+#include <vector>
+
+namespace neurun
+{
+namespace codegen
+{
+
+// Estimates the latency of a plan from the time each operation takes on each backend, and the
+// time it takes to move operands across backend boundaries
+class LatencyModel
+{
+public:
+  // Backend (position in the backend keys) of each operation (position in the operation list)
+  using Assignment = std::vector<uint32_t>;
+
+  // An operand that an operation passes to other operations
+  struct Edge
+  {
+    uint32_t def;
+    std::vector<uint32_t> uses;
+    // Time to move the operand from a backend (1st) to another (2nd)
+    std::vector<std::vector<double>> permute;
+  };
+
+public:
+  LatencyModel(uint32_t operation_count) : exec(operation_count), _edges_of(operation_count)
+  {
+    // DO NOTHING
+  }
+
+public:
+  void addEdge(Edge &&edge);
+
+public:
+  double total(const Assignment &assignment) const;
+  // Part of the total cost that depends on the backend of an operation
+  double local(uint32_t operation, const Assignment &assignment) const;
+
+public:
+  // Searches for the assignment of the lowest cost
+  //
+  // Starting from assignments that use one backend for all and from the one that uses the fastest
+  // backend for each operation, this keeps moving an operation to another backend as long as it
+  // reduces the total cost, and returns the best local optimum.
+  Assignment search(uint32_t backend_count) const;
+
+private:
+  double permute(const Edge &edge, const Assignment &assignment) const;
+
+public:
+  // Time that each operation (1st) takes on each backend (2nd)
+  std::vector<std::vector<double>> exec;
+
+private:
+  std::vector<Edge> _edges;
+  std::vector<std::vector<uint32_t>> _edges_of;
+};
+
+} // namespace codegen
+} // namespace neurun
+
+#endif // __NEURUN_CODEGEN_LATENCY_MODEL_H__
@@ -17,9 +17,13 @@
 #ifndef __NEURUN_CODEGEN_PLAN_H__
 #define __NEURUN_CODEGEN_PLAN_H__
 
+#include <mutex>
+
 #include "graph/Graph.h"
 #include "codegen/operand/Context.h"
 #include "codegen/operation/Sequence.h"
+#include "codegen/operation/Dataflow.h"
+#include "exec/SchedulingProfile.h"
 
 namespace neurun
 {
@@ -29,7 +33,9 @@ namespace codegen
 class Plan
 {
 public:
-  Plan(const std::shared_ptr<neurun::graph::Graph> &model) : _model(model)
+  Plan(const std::shared_ptr<neurun::graph::Graph> &model)
+      : _model(model),
+        _profile(&exec::SchedulingProfile::get(exec::SchedulingProfile::defaultPreference()))
   {
     // DO NOTHING
   }
@@ -46,10 +52,26 @@ public:
   operation::Sequence &operations(void) { return _ops; }
   const operation::Sequence &operations(void) const { return _ops; }
 
+public:
+  operation::Dataflow &dataflow(void) { return _dataflow; }
+  const operation::Dataflow &dataflow(void) const { return _dataflow; }
+
+public:
+  // NOTE The profile is used both to compile (e.g. to choose kernels) and to execute the plan
+  const exec::SchedulingProfile &profile(void) const { return *_profile; }
+  void profile(const exec::SchedulingProfile &profile) { _profile = &profile; }
+
+public:
+  // NOTE Executions of a plan should be serialized as they share tensors
+  std::mutex &execution_mutex(void) const { return _execution_mutex; }
+
 private:
   std::shared_ptr<neurun::graph::Graph> _model;
   operand::Context _operands;
   operation::Sequence _ops;
+  operation::Dataflow _dataflow;
+  const exec::SchedulingProfile *_profile;
+  mutable std::mutex _execution_mutex;
 };
 
 } // namespace codegen
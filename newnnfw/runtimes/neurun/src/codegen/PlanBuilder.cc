@@ -16,6 +16,70 @@
 
 #include "PlanBuilder.h"
 
+#include <functional>
+#include <sstream>
+#include <typeinfo>
+#include <unordered_map>
+
+#include "backend/IBackendConfig.h"
+#include "codegen/CostModel.h"
+#include "exec/Profiler.h"
+#include "graph/operation/LowerInfo.h"
+#include "graph/operation/NodeVisitor.h"
+#include "util/profiling/PhaseReport.h"
+
+namespace
+{
+
+const char *name(const neurun::graph::operation::Node &node)
+{
+  using namespace neurun::graph::operation;
+
+#define OP(InternalName, NnApiName)             \
+  if (typeid(node) == typeid(InternalName::Node)) \
+  {                                               \
+    return #NnApiName;                            \
+  }
+#include "graph/operation/Op.lst"
+#undef OP
+
+  if (typeid(node) == typeid(Permute::Node))
+  {
+    return "PERMUTE";
+  }
+
+  return "NOP";
+}
+
+// Shapes of the inputs and the outputs of a node (e.g. "1x7x7x64, 10x1x1x64, 10 -> 1x1x1x10")
+std::string shapes(const neurun::graph::Graph &model, const neurun::graph::operation::Node &node)
+{
+  std::stringstream ss;
+
+  auto append = [&](const neurun::graph::operand::IndexSet &indexes) {
+    bool first = true;
+    for (const auto &index : indexes)
+    {
+      ss << (first ? "" : ", ");
+      first = false;
+
+      const auto &shape = model.operands().at(index).shape();
+      for (uint32_t axis = 0; axis < shape.rank(); ++axis)
+      {
+        ss << (axis == 0 ? "" : "x") << shape.dim(axis);
+      }
+    }
+  };
+
+  append(node.getInputs());
+  ss << " -> ";
+  append(node.getOutputs());
+
+  return ss.str();
+}
+
+} // namespace
+
 namespace neurun
 {
 namespace codegen
@@ -33,32 +97,126 @@ void PlanBuilder::addInitializer(const ::neurun::graph::operand::Index &ind,
   _initializer_ctx[ind.asInt()] = initializer;
 }
 
-void PlanBuilder::addStage(const Stage &stage) { _stages.emplace_back(stage); }
+void PlanBuilder::addStage(const graph::operation::Node &node, const Stage &stage)
+{
+  _stages.emplace_back(&node, stage);
+}
 
-void PlanBuilder::finalize(const backend::TensorBuilderSet &tensor_builders)
+void PlanBuilder::finalize(const backend::TensorBuilderSet &tensor_builders, PlanCache &cache)
 {
+  using nnfw::util::profiling::ScopedPhase;
+
+  auto report = &_plan.model().report();
+
+  // Bytes of tensor buffers that all backends have allocated
+  auto allocated_bytes = [&tensor_builders](void) {
+    uint64_t bytes = 0;
+    for (const auto &tensor_builder : tensor_builders)
+    {
+      bytes += tensor_builder->allocatedBytes();
+    }
+    return bytes;
+  };
+
   // Prepare tensors
-  for (auto &tensor_builder : tensor_builders)
   {
-    tensor_builder->prepare(_plan, _tensor_info_ctx);
+    ScopedPhase phase{report, "prepare"};
+
+    for (auto &tensor_builder : tensor_builders)
+    {
+      tensor_builder->prepare(_plan, _tensor_info_ctx);
+    }
   }
 
+  // NOTE Some backends (e.g. CPU) allocate their buffers at 'prepare'
+  const auto prepared_bytes = allocated_bytes();
+  report->allocate("prepare", prepared_bytes);
+
   // Process Stage
   ExecutionBuilder execution_builder{_plan};
 
+  const auto &model = _plan.model();
+  auto &dataflow = _plan.dataflow();
+
+  CostModel cost_model{model.operands()};
+
+  // Block index of the stage that each node has generated
+  std::unordered_map<const graph::operation::Node *, uint32_t> blocks;
+
+  // Connect 'block' with the blocks which define the operands that 'node' reads
+  //
+  // NOTE A node without stage (e.g. NOP) is looked through
+  std::function<void(const graph::operation::Node &, uint32_t)> connect =
+      [&](const graph::operation::Node &node, uint32_t block) {
+        for (const auto &input : node.getInputs())
+        {
+          for (const auto &def : model.operands().at(input).getDef().list())
+          {
+            const auto &producer = model.operations().at(def);
+            auto it = blocks.find(&producer);
+
+            if (it != blocks.end())
+            {
+              dataflow.connect(it->second, block);
+            }
+            else
+            {
+              connect(producer, block);
+            }
+          }
+        }
+      };
+
   for (const auto &stage : _stages)
   {
-    stage(execution_builder);
+    const auto &node = *stage.first;
+
+    const auto begin = _plan.operations().size();
+    {
+      // NOTE Backends configure their kernels here (e.g. ACL configure)
+      ScopedPhase phase{report, "stages"};
+      ScopedPhase node_phase{report, std::string{"stages/"} + name(node)};
+      stage.second(execution_builder);
+    }
+    const auto end = _plan.operations().size();
+
+    // NOTE A stage is serial if it touches the tensors of a backend that cannot run concurrently
+    const auto &lower_info = *node.lower_info();
+    const bool serial = !lower_info.backend().config()->supportConcurrentExecution() ||
+                        !lower_info.input_backend().config()->supportConcurrentExecution() ||
+                        !lower_info.output_backend().config()->supportConcurrentExecution();
+
+    // NOTE Operations are registered only while the profiler is enabled, as the profiler keeps
+    //      them as long as it lives
+    const auto profile_id =
+        exec::Profiler::enabled()
+            ? exec::Profiler::get().addOperation(name(node), lower_info.backend().config()->id(),
+                                                 shapes(model, node), cost_model.estimate(node))
+            : exec::Profiler::NO_OPERATION;
+
+    const auto block = dataflow.append(begin, end, serial, profile_id);
+
+    connect(node, block);
+
+    blocks[&node] = block;
   }
 
   // TODO Add code for CPU/ACL tensor allocation
   // Allocate Tensor Memory for cl_tensors
-  for (auto &tensor_builder : tensor_builders)
   {
-    tensor_builder->allocate();
+    ScopedPhase phase{report, "allocate"};
+
+    for (auto &tensor_builder : tensor_builders)
+    {
+      tensor_builder->allocate();
+    }
   }
 
+  report->allocate("allocate", allocated_bytes() - prepared_bytes);
+
   // Fill weight/bias
+  ScopedPhase initialize_phase{report, "initialize"};
+
   for (auto it = _initializer_ctx.begin(); it != _initializer_ctx.end(); ++it)
   {
     const ::neurun::graph::operand::Index operand_index{it->first};
@@ -66,9 +224,19 @@ void PlanBuilder::finalize(const backend::TensorBuilderSet &tensor_builders)
 
     for (auto object : objects)
     {
-      object->access(it->second);
+      if (!cache.restore(operand_index, *object))
+      {
+        object->access(it->second);
+        cache.store(operand_index, object);
+      }
     }
   }
+
+  // Let functions prepare what they derive from constants (e.g. reshaped weights) ahead of run
+  for (uint32_t n = 0; n < _plan.operations().size(); ++n)
+  {
+    _plan.operations().at(n).prepare();
+  }
 }
 
 } // namepsace codegen
@@ -19,6 +19,7 @@
 
 #include "IPlanBuilder.h"
 #include "codegen/Plan.h"
+#include "codegen/PlanCache.h"
 #include "backend/IStageGenerator.h"
 #include "backend/ITensorBuilder.h"
 
@@ -62,11 +63,12 @@ public:
                       const Initializer &initializer) override;
 
 public:
-  void addStage(const Stage &stage) override;
+  void addStage(const graph::operation::Node &node, const Stage &stage) override;
 
 public:
   // TODO Remove the argument `tensor_builders`
-  void finalize(const backend::TensorBuilderSet &tensor_builders);
+  // NOTE Constant tensors are filled from 'cache' if it has them, and stored to 'cache' otherwise
+  void finalize(const backend::TensorBuilderSet &tensor_builders, PlanCache &cache);
 
 public:
   const std::map<int, ::arm_compute::TensorInfo> &tensor_info_ctx() { return _tensor_info_ctx; }
@@ -77,7 +79,7 @@ private:
 private:
   std::map<int, ::arm_compute::TensorInfo> _tensor_info_ctx;
   std::map<int, Initializer> _initializer_ctx;
-  std::vector<Stage> _stages;
+  std::vector<std::pair<const graph::operation::Node *, Stage>> _stages;
 };
 
 } // namepsace codegen
@@ -0,0 +1,561 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "PlanCache.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+#include <typeinfo>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "backend/IBackendConfig.h"
+#include "codegen/Hasher.h"
+#include "exec/SchedulingProfile.h"
+#include "graph/operation/LowerInfo.h"
+#include "kernel/cpu/WinogradConvolutionLayer.h"
+#include "util/EnvVar.h"
+
+#include "logging.h"
+
+namespace
+{
+
+// Plan file format (in the byte order of the host)
+//
+//   Header      : magic[8], version(u32), byte order mark(u32), key(u64)
+//   Backends    : count(u32), { operation(u32), backend id(string) } * count
+//   Order       : count(u32), { operation(u32) } * count
+//   Blobs       : count(u32), { operand(u32), object type(string), layout(u64),
+//                               offset(u64), size(u64) } * count
+//   Data        : contents of blobs, each aligned by BLOB_ALIGNMENT from the beginning of file
+//
+// where a string is written as its length(u32) followed by its characters.
+const char MAGIC[8] = {'N', 'R', 'N', 'P', 'L', 'A', 'N', '\0'};
+// NOTE Bump VERSION whenever backends change how they convert constants
+const uint32_t VERSION = 3;
+const uint32_t BYTE_ORDER_MARK = 0x01020304;
+const uint64_t BLOB_ALIGNMENT = 64;
+
+std::string planPath(uint64_t key)
+{
+  const auto dir = nnfw::util::EnvVar{"NEURUN_PLAN_CACHE_DIR"}.asString("");
+
+  if (dir.empty())
+  {
+    return "";
+  }
+
+  char name[64];
+  std::snprintf(name, sizeof(name), "/neurun_plan_%016llx.bin",
+                static_cast<unsigned long long>(key));
+
+  return dir + name;
+}
+
+uint64_t hash(const neurun::graph::Graph &graph)
+{
+  using namespace neurun::graph;
+
+  neurun::codegen::Hasher hasher;
+
+  hasher.update(VERSION);
+
+  // Backend settings that decide the assignment
+  hasher.update(nnfw::util::EnvVar{"OP_BACKEND_ALLOPS"}.asString("none"));
+#define OP(InternalName, NnApiName) \
+  hasher.update(nnfw::util::EnvVar{std::string("OP_BACKEND_") + #NnApiName}.asString("acl_cl"));
+#include "graph/operation/Op.lst"
+#undef OP
+  // CPU backend settings that decide how constants are converted
+  hasher.update(neurun::kernel::cpu::WinogradConvolutionLayer::mode());
+  // Linearization strategy that decides the operation order
+  hasher.update(nnfw::util::EnvVar{"NEURUN_LINEARIZE"}.asString("DFS"));
+  // Scheduling profile that decides kernels (e.g. Winograd tiles)
+  hasher.update(std::string{neurun::exec::SchedulingProfile::current().name()});
+
+  graph.operands().iterate([&](const operand::Index &index, const operand::Object &object) {
+    const auto &shape = object.shape();
+
+    hasher.update(index.value());
+    hasher.update(static_cast<int32_t>(object.typeInfo().type()));
+    hasher.update(object.typeInfo().scale());
+    hasher.update(object.typeInfo().offset());
+    hasher.update(shape.rank());
+    for (uint32_t axis = 0; axis < shape.rank(); ++axis)
+    {
+      hasher.update(shape.dim(axis));
+    }
+    if (object.isConstant())
+    {
+      hasher.update(object.data().base(), object.data().size());
+    }
+  });
+
+  graph.operations().iterate([&](const operation::Index &index, const operation::Node &node) {
+    hasher.update(index.value());
+    hasher.update(std::string{typeid(node).name()});
+    for (const auto &ind : node.getInputs())
+    {
+      hasher.update(ind.value());
+    }
+    for (const auto &ind : node.getOutputs())
+    {
+      hasher.update(ind.value());
+    }
+  });
+
+  for (const auto &ind : graph.getInputs())
+  {
+    hasher.update(ind.value());
+  }
+  for (const auto &ind : graph.getOutputs())
+  {
+    hasher.update(ind.value());
+  }
+
+  return hasher.value();
+}
+
+// Summary of the memory layout of a tensor, which should match for the contents to be reused
+uint64_t layoutOf(const ::arm_compute::ITensor &tensor)
+{
+  const auto info = tensor.info();
+
+  neurun::codegen::Hasher hasher;
+
+  hasher.update(static_cast<int32_t>(info->data_type()));
+  hasher.update(static_cast<uint64_t>(info->num_dimensions()));
+  for (size_t axis = 0; axis < info->num_dimensions(); ++axis)
+  {
+    hasher.update(static_cast<uint64_t>(info->dimension(axis)));
+  }
+  hasher.update(static_cast<uint64_t>(info->total_size()));
+
+  return hasher.value();
+}
+
+// Bounds-checked reader over the mapped plan file
+class Reader
+{
+public:
+  Reader(const uint8_t *base, size_t size) : _base{base}, _size{size}
+  {
+    // DO NOTHING
+  }
+
+public:
+  template <typename T> bool read(T &value)
+  {
+    if (_size - _pos < sizeof(T))
+    {
+      return false;
+    }
+    std::memcpy(&value, _base + _pos, sizeof(T));
+    _pos += sizeof(T);
+    return true;
+  }
+
+  bool read(std::string &str)
+  {
+    uint32_t len = 0;
+    if (!read(len) || _size - _pos < len)
+    {
+      return false;
+    }
+    str.assign(reinterpret_cast<const char *>(_base + _pos), len);
+    _pos += len;
+    return true;
+  }
+
+private:
+  const uint8_t *_base;
+  size_t _size;
+  size_t _pos = 0;
+};
+
+class Writer
+{
+public:
+  Writer(std::ostream &os) : _os(os)
+  {
+    // DO NOTHING
+  }
+
+public:
+  template <typename T> void write(const T &value)
+  {
+    _os.write(reinterpret_cast<const char *>(&value), sizeof(T));
+  }
+
+  void write(const std::string &str)
+  {
+    write(static_cast<uint32_t>(str.size()));
+    _os.write(str.data(), str.size());
+  }
+
+private:
+  std::ostream &_os;
+};
+
+// Writes all 'size' bytes of 'data' to 'fd'
+bool writeAll(int fd, const void *data, size_t size)
+{
+  const auto bytes = reinterpret_cast<const char *>(data);
+
+  for (size_t offset = 0; offset < size;)
+  {
+    const auto written = write(fd, bytes + offset, size - offset);
+
+    if (written < 0)
+    {
+      return false;
+    }
+
+    offset += written;
+  }
+
+  return true;
+}
+
+uint64_t align(uint64_t offset)
+{
+  return (offset + BLOB_ALIGNMENT - 1) / BLOB_ALIGNMENT * BLOB_ALIGNMENT;
+}
+
+} // namespace
+
+namespace neurun
+{
+namespace codegen
+{
+
+PlanCache::PlanCache(const graph::Graph &graph) : _key{hash(graph)}, _path{planPath(_key)}
+{
+  graph.operations().iterate(
+      [&](const graph::operation::Index &index, const graph::operation::Node &) {
+        _model_operations.insert(index);
+      });
+}
+
+PlanCache::~PlanCache()
+{
+  if (_base != nullptr)
+  {
+    munmap(_base, _size);
+  }
+}
+
+bool PlanCache::load(void)
+{
+  if (_path.empty())
+  {
+    return false;
+  }
+
+  int fd = open(_path.c_str(), O_RDONLY);
+  if (fd < 0)
+  {
+    return false;
+  }
+
+  // NOTE Blobs of the file are copied into the model as they are, so the file should be one that
+  //      only this user could have written
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size == 0)
+  {
+    close(fd);
+    return false;
+  }
+
+  if (!S_ISREG(st.st_mode) || st.st_uid != geteuid() || (st.st_mode & (S_IWGRP | S_IWOTH)) != 0)
+  {
+    VERBOSE(PlanCache) << "Ignore plan file " << _path
+                       << " which is not a regular file writable only by this user" << std::endl;
+    close(fd);
+    return false;
+  }
+
+  void *base = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+
+  if (base == MAP_FAILED)
+  {
+    return false;
+  }
+
+  _base = reinterpret_cast<uint8_t *>(base);
+  _size = st.st_size;
+
+  if (!parse())
+  {
+    VERBOSE(PlanCache) << "Ignore invalid plan file " << _path << std::endl;
+
+    munmap(_base, _size);
+    _base = nullptr;
+    _size = 0;
+    _backends.clear();
+    _order.clear();
+    _blobs.clear();
+    return false;
+  }
+
+  VERBOSE(PlanCache) << "Load plan from " << _path << ": " << _backends.size() << " backends, "
+                     << _order.size() << " operations, " << _blobs.size() << " blobs" << std::endl;
+
+  return true;
+}
+
+bool PlanCache::parse(void)
+{
+  Reader reader{_base, _size};
+
+  char magic[sizeof(MAGIC)];
+  uint32_t version = 0;
+  uint32_t byte_order_mark = 0;
+  uint64_t key = 0;
+
+  if (!reader.read(magic) || std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0 ||
+      !reader.read(version) || version != VERSION || !reader.read(byte_order_mark) ||
+      byte_order_mark != BYTE_ORDER_MARK || !reader.read(key) || key != _key)
+  {
+    return false;
+  }
+
+  uint32_t count = 0;
+
+  if (!reader.read(count))
+  {
+    return false;
+  }
+  for (uint32_t n = 0; n < count; ++n)
+  {
+    uint32_t operation = 0;
+    std::string backend;
+    if (!reader.read(operation) || !reader.read(backend))
+    {
+      return false;
+    }
+    _backends[graph::operation::Index{operation}] = backend;
+  }
+
+  if (!reader.read(count))
+  {
+    return false;
+  }
+  for (uint32_t n = 0; n < count; ++n)
+  {
+    uint32_t operation = 0;
+    if (!reader.read(operation))
+    {
+      return false;
+    }
+    _order.emplace_back(operation);
+  }
+
+  if (!reader.read(count))
+  {
+    return false;
+  }
+  for (uint32_t n = 0; n < count; ++n)
+  {
+    uint32_t operand = 0;
+    std::string type;
+    Blob blob;
+    if (!reader.read(operand) || !reader.read(type) || !reader.read(blob.layout) ||
+        !reader.read(blob.offset) || !reader.read(blob.size))
+    {
+      return false;
+    }
+    if (blob.offset > _size || blob.size > _size - blob.offset)
+    {
+      return false;
+    }
+    _blobs[BlobKey{operand, type}] = blob;
+  }
+
+  return true;
+}
+
+bool PlanCache::restore(const graph::operand::Index &index,
+                        const backend::operand::IObject &object) const
+{
+  auto it = _blobs.find(BlobKey{index.value(), typeid(object).name()});
+
+  if (it == _blobs.end())
+  {
+    return false;
+  }
+
+  const auto &blob = it->second;
+  bool restored = false;
+
+  object.access([&](::arm_compute::ITensor &tensor) {
+    if (layoutOf(tensor) == blob.layout && tensor.info()->total_size() == blob.size)
+    {
+      std::memcpy(tensor.buffer(), _base + blob.offset, blob.size);
+      restored = true;
+    }
+  });
+
+  return restored;
+}
+
+void PlanCache::record(const graph::Graph &graph, const linear::Linear &linear)
+{
+  // NOTE Operations inserted while lowering (e.g. Permute) are inserted again on a later
+  //      compilation, so only the backends of the model operations are recorded
+  std::unordered_map<const graph::operation::Node *, graph::operation::Index> indexes;
+
+  graph.operations().iterate(
+      [&](const graph::operation::Index &index, const graph::operation::Node &node) {
+        if (_model_operations.find(index) != _model_operations.end())
+        {
+          _backends[index] = node.lower_info()->backend().config()->id();
+        }
+        indexes.emplace(&node, index);
+      });
+
+  _order.clear();
+  linear.iterate(
+      [&](const graph::operation::Node &node) { _order.emplace_back(indexes.at(&node)); });
+}
+
+void PlanCache::store(const graph::operand::Index &index,
+                      const std::shared_ptr<backend::operand::IObject> &object)
+{
+  const auto &ref = *object;
+  _objects[BlobKey{index.value(), typeid(ref).name()}] = object;
+}
+
+bool PlanCache::save(void) const
+{
+  if (_path.empty() || loaded())
+  {
+    return false;
+  }
+
+  // NOTE The plan is written to a new temporary file (created with O_EXCL by mkstemp) and then
+  //      renamed, so that others never map a partial one nor redirect the write
+  std::ostringstream header;
+  Writer writer{header};
+
+  writer.write(MAGIC);
+  writer.write(VERSION);
+  writer.write(BYTE_ORDER_MARK);
+  writer.write(_key);
+
+  writer.write(static_cast<uint32_t>(_backends.size()));
+  for (const auto &entry : _backends)
+  {
+    writer.write(entry.first.value());
+    writer.write(entry.second);
+  }
+
+  writer.write(static_cast<uint32_t>(_order.size()));
+  for (const auto &index : _order)
+  {
+    writer.write(index.value());
+  }
+
+  // Size of the blob table, to find where the data begins
+  uint64_t offset = static_cast<uint64_t>(header.tellp()) + sizeof(uint32_t);
+  for (const auto &entry : _objects)
+  {
+    offset += sizeof(uint32_t) * 2 + entry.first.second.size() + sizeof(uint64_t) * 3;
+  }
+
+  std::vector<std::pair<const backend::operand::IObject *, Blob>> blobs;
+
+  writer.write(static_cast<uint32_t>(_objects.size()));
+  for (const auto &entry : _objects)
+  {
+    const auto tensor = entry.second->ptr();
+
+    Blob blob;
+    blob.layout = layoutOf(*tensor);
+    blob.offset = align(offset);
+    blob.size = tensor->info()->total_size();
+
+    writer.write(entry.first.first);
+    writer.write(entry.first.second);
+    writer.write(blob.layout);
+    writer.write(blob.offset);
+    writer.write(blob.size);
+
+    blobs.emplace_back(entry.second.get(), blob);
+    offset = blob.offset + blob.size;
+  }
+
+  std::vector<char> tmp_path(_path.begin(), _path.end());
+  const std::string suffix{".XXXXXX"};
+  tmp_path.insert(tmp_path.end(), suffix.begin(), suffix.end());
+  tmp_path.push_back('\0');
+
+  const int fd = mkstemp(tmp_path.data());
+
+  if (fd == -1)
+  {
+    return false;
+  }
+
+  const auto content = header.str();
+  bool saved = writeAll(fd, content.data(), content.size());
+  uint64_t written = content.size();
+
+  const std::vector<char> padding(BLOB_ALIGNMENT, '\0');
+
+  for (const auto &entry : blobs)
+  {
+    const auto &blob = entry.second;
+
+    if (!saved)
+    {
+      break;
+    }
+
+    saved = writeAll(fd, padding.data(), blob.offset - written);
+
+    entry.first->access([&](::arm_compute::ITensor &tensor) {
+      saved = saved && writeAll(fd, tensor.buffer(), blob.size);
+    });
+
+    written = blob.offset + blob.size;
+  }
+
+  saved = (close(fd) == 0) && saved;
+  saved = saved && (std::rename(tmp_path.data(), _path.c_str()) == 0);
+
+  if (!saved)
+  {
+    std::remove(tmp_path.data());
+    return false;
+  }
+
+  VERBOSE(PlanCache) << "Save plan to " << _path << std::endl;
+
+  return true;
+}
+
+} // namespace codegen
+} // namespace neurun
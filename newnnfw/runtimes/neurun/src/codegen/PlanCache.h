@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef __NEURUN_CODEGEN_PLAN_CACHE_H__
+#define __NEURUN_CODEGEN_PLAN_CACHE_H__
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "backend/IObject.h"
+#include "graph/Graph.h"
+#include "linear/Linear.h"
+
+namespace neurun
+{
+namespace codegen
+{
+
+// On-disk cache of a compiled plan
+//
+// A plan file keeps what a compilation of the same model produces, so that a later compilation
+// may skip it:
+//
+//   - The backend of each operation (backend resolution and profiling are skipped)
+//   - The linear order of operations
+//   - The contents of constant tensors as their backends have converted them (initializers
+//     are skipped, and tensors are filled from the file mapped in memory)
+//
+// NOTE The cache is enabled only when NEURUN_PLAN_CACHE_DIR is set. Plan files are keyed by a
+//      hash of the model and the backend settings, so a changed model never hits a stale plan.
+//      The directory should be private to the user (e.g. not /tmp), as anyone can compute the key
+//      of a model and a plan file fills weights with its contents. Files that are not regular,
+//      not owned by the user, or writable by others are ignored.
+class PlanCache
+{
+public:
+  // NOTE This should be constructed before the graph is lowered
+  PlanCache(const graph::Graph &graph);
+  ~PlanCache();
+
+public:
+  PlanCache(const PlanCache &) = delete;
+  PlanCache &operator=(const PlanCache &) = delete;
+
+public:
+  uint64_t key(void) const { return _key; }
+  const std::string &path(void) const { return _path; }
+
+public:
+  // Map the plan file of this model. Returns false if there is none or it is not valid.
+  bool load(void);
+  bool loaded(void) const { return _base != nullptr; }
+
+public:
+  // Backend id for each operation of the model (empty if not loaded)
+  const std::unordered_map<graph::operation::Index, std::string> &backends(void) const
+  {
+    return _backends;
+  }
+  // Linear order of operations (empty if not loaded)
+  const std::vector<graph::operation::Index> &order(void) const { return _order; }
+
+public:
+  // Fill 'object' with the cached contents of operand 'index'. Returns false on a miss.
+  bool restore(const graph::operand::Index &index, const backend::operand::IObject &object) const;
+
+public:
+  // Record the result of a compilation to save
+  void record(const graph::Graph &graph, const linear::Linear &linear);
+  void store(const graph::operand::Index &index,
+             const std::shared_ptr<backend::operand::IObject> &object);
+  // Write the recorded plan if it has not been loaded
+  bool save(void) const;
+
+private:
+  struct Blob
+  {
+    uint64_t layout;
+    uint64_t offset;
+    uint64_t size;
+  };
+
+  using BlobKey = std::pair<uint32_t, std::string>;
+
+private:
+  bool parse(void);
+
+private:
+  uint64_t _key;
+  std::string _path;
+  std::unordered_set<graph::operation::Index> _model_operations;
+
+private:
+  // Mapped plan file
+  uint8_t *_base = nullptr;
+  size_t _size = 0;
+
+private:
+  std::unordered_map<graph::operation::Index, std::string> _backends;
+  std::vector<graph::operation::Index> _order;
+  std::map<BlobKey, Blob> _blobs;
+  std::map<BlobKey, std::shared_ptr<backend::operand::IObject>> _objects;
+};
+
+} // namespace codegen
+} // namespace neurun
+
+#endif // __NEURUN_CODEGEN_PLAN_CACHE_H__
@@ -44,10 +44,14 @@ void Planner::visit(const graph::operation::Conv2D::Implicit::Node &node)
   const auto bias_size = _ctx.at(bias_index).shape().asVector();
 
   // Set Shape Constraints
-  _builder.addShapeConstr(ofm_index, ::internal::asTensorInfo(ofm_shape));
-  _builder.addShapeConstr(ifm_index, ::internal::asTensorInfo(ifm_shape));
-  _builder.addShapeConstr(ker_index, ::internal::asTensorInfo(ker_shape));
-  _builder.addShapeConstr(bias_index, ::internal::asTensorInfo(bias_size));
+  _builder.addShapeConstr(ofm_index,
+                          ::internal::asTensorInfo(ofm_shape, _ctx.at(ofm_index).typeInfo()));
+  _builder.addShapeConstr(ifm_index,
+                          ::internal::asTensorInfo(ifm_shape, _ctx.at(ifm_index).typeInfo()));
+  _builder.addShapeConstr(ker_index,
+                          ::internal::asTensorInfo(ker_shape, _ctx.at(ker_index).typeInfo()));
+  _builder.addShapeConstr(bias_index,
+                          ::internal::asTensorInfo(bias_size, _ctx.at(bias_index).typeInfo()));
 
   // backend
   auto backend = node.lower_info()->backend();
@@ -59,7 +63,52 @@ void Planner::visit(const graph::operation::Conv2D::Implicit::Node &node)
 
   // Generate Stage
   auto stage_gen = backend.stage_gen();
-  _builder.addStage(stage_gen->generate(node));
+  _builder.addStage(node, stage_gen->generate(node));
+}
+
+void Planner::visit(const graph::operation::DepthwiseConv2D::Implicit::Node &node)
+{
+  const auto ofm_index = node.getOutputs().at(0);
+
+  const auto ifm_index = node.getInputs().at(0);
+  const auto ker_index = node.getInputs().at(1);
+  const auto bias_index = node.getInputs().at(2);
+
+  const auto ofm_shape = _ctx.at(ofm_index).shape().asFeature();
+  const auto ifm_shape = _ctx.at(ifm_index).shape().asFeature();
+  // NOTE DepthwiseConv2D kernel is of shape [1, KER_H, KER_W, IFM_C * MULTIPLIER]
+  const auto ker_shape = _ctx.at(ker_index).shape().asKernel();
+  const auto bias_size = _ctx.at(bias_index).shape().asVector();
+
+  const auto multiplier =
+      _ctx.at(::neurun::graph::operand::Index{node.param().multiplier_index}).asScalar<int32_t>();
+
+  assert(ker_shape.N == 1);
+  assert(ker_shape.C == bias_size);
+  assert(ker_shape.C == ifm_shape.C * multiplier);
+  assert(ofm_shape.C == ker_shape.C);
+
+  // Set Shape Constraints
+  _builder.addShapeConstr(ofm_index,
+                          ::internal::asTensorInfo(ofm_shape, _ctx.at(ofm_index).typeInfo()));
+  _builder.addShapeConstr(ifm_index,
+                          ::internal::asTensorInfo(ifm_shape, _ctx.at(ifm_index).typeInfo()));
+  _builder.addShapeConstr(ker_index,
+                          ::internal::asTensorInfo(ker_shape, _ctx.at(ker_index).typeInfo()));
+  _builder.addShapeConstr(bias_index,
+                          ::internal::asTensorInfo(bias_size, _ctx.at(bias_index).typeInfo()));
+
+  // backend
+  auto backend = node.lower_info()->backend();
+
+  // Generate Initializers
+  auto init_gen = backend.initializer_gen();
+  _builder.addInitializer(ker_index, init_gen->generateWeight(node));
+  _builder.addInitializer(bias_index, init_gen->generateBias(node));
+
+  // Generate Stage
+  auto stage_gen = backend.stage_gen();
+  _builder.addStage(node, stage_gen->generate(node));
 }
 
 void Planner::visit(const graph::operation::MaxPool2D::Implicit::Node &node)
@@ -71,15 +120,17 @@ void Planner::visit(const graph::operation::MaxPool2D::Implicit::Node &node)
   const auto ifm_shape = _ctx.at(ifm_index).shape().asFeature();
 
   // Set Shape Constraints
-  _builder.addShapeConstr(ofm_index, ::internal::asTensorInfo(ofm_shape));
-  _builder.addShapeConstr(ifm_index, ::internal::asTensorInfo(ifm_shape));
+  _builder.addShapeConstr(ofm_index,
+                          ::internal::asTensorInfo(ofm_shape, _ctx.at(ofm_index).typeInfo()));
+  _builder.addShapeConstr(ifm_index,
+                          ::internal::asTensorInfo(ifm_shape, _ctx.at(ifm_index).typeInfo()));
 
   // backend
   auto backend = node.lower_info()->backend();
 
   // Generate Stage
   auto stage_gen = backend.stage_gen();
-  _builder.addStage(stage_gen->generate(node));
+  _builder.addStage(node, stage_gen->generate(node));
 }
 
 void Planner::visit(const graph::operation::AvgPool2D::Implicit::Node &node)
@@ -91,15 +142,17 @@ void Planner::visit(const graph::operation::AvgPool2D::Implicit::Node &node)
   const auto ifm_shape = _ctx.at(ifm_index).shape().asFeature();
 
   // Set Shape Constraints
-  _builder.addShapeConstr(ofm_index, ::internal::asTensorInfo(ofm_shape));
-  _builder.addShapeConstr(ifm_index, ::internal::asTensorInfo(ifm_shape));
+  _builder.addShapeConstr(ofm_index,
+                          ::internal::asTensorInfo(ofm_shape, _ctx.at(ofm_index).typeInfo()));
+  _builder.addShapeConstr(ifm_index,
+                          ::internal::asTensorInfo(ifm_shape, _ctx.at(ifm_index).typeInfo()));
 
   // backend
   auto backend = node.lower_info()->backend();
 
   // Generate Stage
   auto stage_gen = backend.stage_gen();
-  _builder.addStage(stage_gen->generate(node));
+  _builder.addStage(node, stage_gen->generate(node));
 }
 
 void Planner::visit(const graph::operation::Concat::Node &node)
@@ -116,14 +169,16 @@ void Planner::visit(const graph::operation::Concat::Node &node)
          3);
 
   // Set Shape Constraints (for output)
-  _builder.addShapeConstr(ofm_index, ::internal::asTensorInfo(ofm_shape));
+  _builder.addShapeConstr(ofm_index,
+                          ::internal::asTensorInfo(ofm_shape, _ctx.at(ofm_index).typeInfo()));
 
   // Set Shape Constraints (for input)
   for (const auto &index : node.getInputs())
   {
     const ::neurun::graph::operand::Index ifm_index{index};
     const auto ifm_shape = _ctx.at(ifm_index).shape().asFeature();
-    _builder.addShapeConstr(ifm_index, ::internal::asTensorInfo(ifm_shape));
+    _builder.addShapeConstr(ifm_index,
+                            ::internal::asTensorInfo(ifm_shape, _ctx.at(ifm_index).typeInfo()));
   }
 
   // backend
@@ -131,7 +186,7 @@ void Planner::visit(const graph::operation::Concat::Node &node)
 
   // Generate Stage
   auto stage_gen = backend.stage_gen();
-  _builder.addStage(stage_gen->generate(node));
+  _builder.addStage(node, stage_gen->generate(node));
 }
 
 void Planner::visit(const graph::operation::FullyConnected::Node &node)
@@ -147,25 +202,44 @@ void Planner::visit(const graph::operation::FullyConnected::Node &node)
   const ::neurun::graph::operand::Index activation_index{node.param().activation_index};
 
   assert(_ctx.at(output_index).shape().rank() == 2);
+  const auto batch_size = _ctx.at(output_index).shape().dim(0);
   const auto output_size = _ctx.at(output_index).shape().dim(1);
 
-  // NOTE We assume that input is a feature map
-  // TODO Remove this restriction!
-  const auto ifm_shape = _ctx.at(input_index).shape().asFeature();
-
   assert(_ctx.at(weight_index).shape().rank() == 2);
   const auto num_output = _ctx.at(weight_index).shape().dim(0);
   const auto input_size = _ctx.at(weight_index).shape().dim(1);
-  assert(ifm_shape.C * ifm_shape.H * ifm_shape.W == input_size);
 
   const auto bias_size = _ctx.at(bias_index).shape().asVector();
 
   // Set Shape Constraints
-  _builder.addShapeConstr(output_index, ::internal::asTensorInfo(output_size));
-  _builder.addShapeConstr(input_index, ::internal::asTensorInfo(ifm_shape));
+  // NOTE Each row of output is computed from a row (or a feature map) of input
+  _builder.addShapeConstr(output_index,
+                          ::internal::asTensorInfo(batch_size /*H*/, output_size /*W*/,
+                                                   _ctx.at(output_index).typeInfo()));
+  if (_ctx.at(input_index).shape().rank() == 4)
+  {
+    const auto ifm_shape = _ctx.at(input_index).shape().asFeature();
+    assert(ifm_shape.N == batch_size);
+    assert(ifm_shape.C * ifm_shape.H * ifm_shape.W == input_size);
+
+    _builder.addShapeConstr(input_index,
+                            ::internal::asTensorInfo(ifm_shape, _ctx.at(input_index).typeInfo()));
+  }
+  else
+  {
+    assert(_ctx.at(input_index).shape().rank() == 2);
+    assert(_ctx.at(input_index).shape().dim(0) == batch_size);
+    assert(_ctx.at(input_index).shape().dim(1) == input_size);
+
+    _builder.addShapeConstr(input_index,
+                            ::internal::asTensorInfo(batch_size /*H*/, input_size /*W*/,
+                                                     _ctx.at(input_index).typeInfo()));
+  }
   _builder.addShapeConstr(weight_index,
-                          ::internal::asTensorInfo(num_output /*H*/, input_size /*W*/));
-  _builder.addShapeConstr(bias_index, ::internal::asTensorInfo(bias_size));
+                          ::internal::asTensorInfo(num_output /*H*/, input_size /*W*/,
+                                                   _ctx.at(weight_index).typeInfo()));
+  _builder.addShapeConstr(bias_index,
+                          ::internal::asTensorInfo(bias_size, _ctx.at(bias_index).typeInfo()));
 
   // backend
   auto backend = node.lower_info()->backend();
@@ -177,7 +251,7 @@ void Planner::visit(const graph::operation::FullyConnected::Node &node)
 
   // Generate Stage
   auto stage_gen = backend.stage_gen();
-  _builder.addStage(stage_gen->generate(node));
+  _builder.addStage(node, stage_gen->generate(node));
 }
 
 void Planner::visit(const graph::operation::Reshape::Node &node)
@@ -192,25 +266,28 @@ void Planner::visit(const graph::operation::Reshape::Node &node)
   // 'Feature Map' to 'Vector' reshape
   assert(_ctx.at(input_index).shape().rank() == 4);
   assert(_ctx.at(output_index).shape().rank() == 2);
-  assert(_ctx.at(output_index).shape().dim(0) == 1);
 
   const auto ifm_shape = _ctx.at(input_index).shape().asFeature();
+  const auto batch_size = _ctx.at(output_index).shape().dim(0);
   const auto out_size = _ctx.at(output_index).shape().dim(1);
 
   // NOTE Vector element ordering issue arises when H or W is not 1
+  assert(ifm_shape.N == batch_size);
   assert(ifm_shape.H == 1);
   assert(ifm_shape.W == 1);
   assert((ifm_shape.C * ifm_shape.H * ifm_shape.W) == out_size);
 
-  _builder.addShapeConstr(output_index, ::internal::asTensorInfo(out_size));
-  _builder.addShapeConstr(input_index, ::internal::asTensorInfo(ifm_shape));
+  _builder.addShapeConstr(output_index, ::internal::asTensorInfo(batch_size /*H*/, out_size /*W*/,
+                                                                 _ctx.at(output_index).typeInfo()));
+  _builder.addShapeConstr(input_index,
+                          ::internal::asTensorInfo(ifm_shape, _ctx.at(input_index).typeInfo()));
 
   // backend
   auto backend = node.lower_info()->backend();
 
   // Generate Stage
   auto stage_gen = backend.stage_gen();
-  _builder.addStage(stage_gen->generate(node));
+  _builder.addStage(node, stage_gen->generate(node));
 }
 
 void Planner::visit(const graph::operation::Softmax::Node &node)
@@ -224,21 +301,24 @@ void Planner::visit(const graph::operation::Softmax::Node &node)
 
   // TODO Support 'feature map' input
   assert(_ctx.at(input_index).shape().rank() == 2);
-  assert(_ctx.at(input_index).shape().dim(0) == 1);
   assert(_ctx.at(input_index).shape().dim(0) == _ctx.at(output_index).shape().dim(0));
   assert(_ctx.at(input_index).shape().dim(1) == _ctx.at(output_index).shape().dim(1));
 
+  // NOTE Softmax is computed over each row (one per batch)
+  const uint32_t batch_size = _ctx.at(output_index).shape().dim(0);
   const uint32_t len = _ctx.at(output_index).shape().dim(1);
 
-  _builder.addShapeConstr(output_index, ::internal::asTensorInfo(len));
-  _builder.addShapeConstr(input_index, ::internal::asTensorInfo(len));
+  _builder.addShapeConstr(output_index, ::internal::asTensorInfo(batch_size /*H*/, len /*W*/,
+                                                                 _ctx.at(output_index).typeInfo()));
+  _builder.addShapeConstr(input_index, ::internal::asTensorInfo(batch_size /*H*/, len /*W*/,
+                                                                _ctx.at(input_index).typeInfo()));
 
   // backend
   auto backend = node.lower_info()->backend();
 
   // Generate Stage
   auto stage_gen = backend.stage_gen();
-  _builder.addStage(stage_gen->generate(node));
+  _builder.addStage(node, stage_gen->generate(node));
 }
 
 void Planner::visit(const graph::operation::NOP::Node & /* node */)
@@ -247,7 +327,46 @@ void Planner::visit(const graph::operation::NOP::Node & /* node */)
   // TODO : It's just for graph manipulation test now, it should be added tensor copy stage later.
 }
 
-void Planner::visit(const graph::operation::Permute::Node & /* node */) { throw "NYI"; }
+void Planner::visit(const graph::operation::Permute::Node &node)
+{
+  const ::neurun::graph::operand::Index output_index{node.getOutputs().at(0)};
+  const ::neurun::graph::operand::Index input_index{node.getInputs().at(0)};
+
+  const auto &shape = _ctx.at(output_index).shape();
+  assert(_ctx.at(input_index).shape().rank() == shape.rank());
+
+  // Set Shape Constraints
+  if (shape.rank() == 4)
+  {
+    const auto feature = shape.asFeature();
+
+    _builder.addShapeConstr(output_index,
+                            ::internal::asTensorInfo(feature, _ctx.at(output_index).typeInfo()));
+    _builder.addShapeConstr(input_index,
+                            ::internal::asTensorInfo(feature, _ctx.at(input_index).typeInfo()));
+  }
+  else
+  {
+    // NOTE Operands other than feature maps are vectors in this runtime (See Softmax)
+    assert(shape.rank() == 2);
+
+    const uint32_t batch_size = shape.dim(0);
+    const uint32_t len = shape.dim(1);
+
+    _builder.addShapeConstr(output_index,
+                            ::internal::asTensorInfo(batch_size /*H*/, len /*W*/,
+                                                     _ctx.at(output_index).typeInfo()));
+    _builder.addShapeConstr(input_index, ::internal::asTensorInfo(batch_size /*H*/, len /*W*/,
+                                                                  _ctx.at(input_index).typeInfo()));
+  }
+
+  // backend
+  auto backend = node.lower_info()->backend();
+
+  // Generate Stage
+  auto stage_gen = backend.stage_gen();
+  _builder.addStage(node, stage_gen->generate(node));
+}
 
 } // namespace codegen
 } // namespace neurun
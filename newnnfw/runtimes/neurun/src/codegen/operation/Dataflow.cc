@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Dataflow.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace neurun
+{
+namespace codegen
+{
+namespace operation
+{
+
+uint32_t Dataflow::append(uint32_t begin, uint32_t end, bool serial, uint32_t profile_id)
+{
+  assert(begin <= end);
+
+  _blocks.emplace_back(Block{begin, end, serial, 0, {}, profile_id});
+
+  return _blocks.size() - 1;
+}
+
+void Dataflow::connect(uint32_t from, uint32_t to)
+{
+  // NOTE Blocks are appended in a topological order
+  assert(from < to);
+
+  auto &succs = _blocks.at(from).succs;
+
+  if (std::find(succs.begin(), succs.end(), to) != succs.end())
+  {
+    return;
+  }
+
+  succs.emplace_back(to);
+  _blocks.at(to).pred_count += 1;
+}
+
+} // namespace operation
+} // namespace codegen
+} // namespace neurun
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NEURUN_CODEGEN_OPERATION_DATAFLOW_H__
+#define __NEURUN_CODEGEN_OPERATION_DATAFLOW_H__
+
+#include <stdint.h>
+#include <vector>
+
+namespace neurun
+{
+namespace codegen
+{
+namespace operation
+{
+
+// Dependencies between the stages of a plan
+//
+// Each block covers the range [begin, end) of functions in operation::Sequence which one stage
+// has appended. A block may run as soon as every block in its predecessor list has finished.
+class Dataflow
+{
+public:
+  struct Block
+  {
+    uint32_t begin;
+    uint32_t end;
+    // NOTE Blocks of a backend that cannot run stages concurrently are marked as 'serial'
+    bool serial;
+    uint32_t pred_count;
+    std::vector<uint32_t> succs;
+    // Operation of the block, which is registered to exec::Profiler
+    uint32_t profile_id;
+  };
+
+public:
+  uint32_t size(void) const { return _blocks.size(); }
+
+public:
+  uint32_t append(uint32_t begin, uint32_t end, bool serial, uint32_t profile_id);
+  void connect(uint32_t from, uint32_t to);
+
+public:
+  const Block &at(uint32_t n) const { return _blocks.at(n); }
+
+private:
+  std::vector<Block> _blocks;
+};
+
+} // namespace operation
+} // namespace codegen
+} // namespace neurun
+
+#endif // __NEURUN_CODEGEN_OPERATION_DATAFLOW_H__
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DataflowExecutor.h"
+#include "Profiler.h"
+
+#include <atomic>
+#include <exception>
+
+namespace
+{
+
+struct Context
+{
+  Context(const neurun::codegen::Plan &plan, neurun::exec::ThreadPool &pool)
+      : plan(plan), pool(pool), refs(new std::atomic<uint32_t>[plan.dataflow().size()]),
+        remaining{plan.dataflow().size()}, done{false}, failed{false}
+  {
+    const auto &dataflow = plan.dataflow();
+
+    for (uint32_t n = 0; n < dataflow.size(); ++n)
+    {
+      refs[n] = dataflow.at(n).pred_count;
+    }
+  }
+
+  const neurun::codegen::Plan &plan;
+  neurun::exec::ThreadPool &pool;
+
+  // # of unfinished predecessors for each block
+  std::unique_ptr<std::atomic<uint32_t>[]> refs;
+  // # of unfinished blocks
+  std::atomic<uint32_t> remaining;
+
+  std::mutex serial_mutex;
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  bool done;
+
+  std::atomic<bool> failed;
+  std::exception_ptr error;
+};
+
+void execute(const std::shared_ptr<Context> &ctx, uint32_t index)
+{
+  const auto &block = ctx->plan.dataflow().at(index);
+  const auto &operations = ctx->plan.operations();
+
+  // Skip the remaining blocks once some block has failed, but keep counting them
+  if (!ctx->failed)
+  {
+    try
+    {
+      std::unique_lock<std::mutex> serial_lock{ctx->serial_mutex, std::defer_lock};
+
+      if (block.serial)
+      {
+        serial_lock.lock();
+      }
+
+      neurun::exec::profile(
+          [&](neurun::exec::Profiler &profiler) {
+            return profiler.beginOperation(block.profile_id);
+          },
+          [&] {
+            for (uint32_t n = block.begin; n < block.end; ++n)
+            {
+              operations.at(n).run();
+            }
+          });
+    }
+    catch (...)
+    {
+      std::lock_guard<std::mutex> lock{ctx->mutex};
+      if (!ctx->failed.exchange(true))
+      {
+        ctx->error = std::current_exception();
+      }
+    }
+  }
+
+  for (auto succ : block.succs)
+  {
+    if (ctx->refs[succ].fetch_sub(1) == 1)
+    {
+      ctx->pool.submit([ctx, succ] { execute(ctx, succ); });
+    }
+  }
+
+  if (ctx->remaining.fetch_sub(1) == 1)
+  {
+    std::lock_guard<std::mutex> lock{ctx->mutex};
+    ctx->done = true;
+    ctx->cv.notify_all();
+  }
+}
+
+} // namespace
+
+namespace neurun
+{
+namespace exec
+{
+
+void DataflowExecutor::run(void)
+{
+  const auto &dataflow = _plan.dataflow();
+
+  if (dataflow.size() == 0)
+  {
+    return;
+  }
+
+  auto ctx = std::make_shared<Context>(_plan, _pool);
+
+  for (uint32_t n = 0; n < dataflow.size(); ++n)
+  {
+    if (dataflow.at(n).pred_count == 0)
+    {
+      _pool.submit([ctx, n] { execute(ctx, n); });
+    }
+  }
+
+  std::unique_lock<std::mutex> lock{ctx->mutex};
+  ctx->cv.wait(lock, [&ctx] { return ctx->done; });
+
+  if (ctx->error)
+  {
+    std::rethrow_exception(ctx->error);
+  }
+}
+
+} // namespace exec
+} // namespace neurun
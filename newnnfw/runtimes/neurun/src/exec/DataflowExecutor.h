@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NEURUN_EXEC_DATAFLOW_EXECUTOR_H__
+#define __NEURUN_EXEC_DATAFLOW_EXECUTOR_H__
+
+#include "codegen/Plan.h"
+#include "exec/ThreadPool.h"
+
+#include "util/EnvVar.h"
+
+namespace neurun
+{
+namespace exec
+{
+
+// Runs the functions of a plan as their inputs become ready
+//
+// Independent blocks (e.g. conv towers of an inception module) are dispatched to different
+// workers of the thread pool, while blocks connected in codegen::operation::Dataflow keep their
+// order. Blocks marked as 'serial' never run at the same time.
+class DataflowExecutor
+{
+public:
+  DataflowExecutor(const codegen::Plan &plan, ThreadPool &pool) : _plan{plan}, _pool{pool}
+  {
+    // DO NOTHING
+  }
+
+public:
+  void run(void);
+
+public:
+  // NOTE Set NEURUN_EXECUTOR as "Dataflow" to run a plan with this executor
+  static bool enabled(void)
+  {
+    static const bool value =
+        (nnfw::util::EnvVar{"NEURUN_EXECUTOR"}.asString("Linear") == "Dataflow");
+    return value;
+  }
+
+private:
+  const codegen::Plan &_plan;
+  ThreadPool &_pool;
+};
+
+} // namespace exec
+} // namespace neurun
+
+#endif // __NEURUN_EXEC_DATAFLOW_EXECUTOR_H__
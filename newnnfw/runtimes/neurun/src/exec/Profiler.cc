@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Profiler.h"
+
+#include <fstream>
+#include <set>
+
+#include "util/EnvVar.h"
+
+#include "logging.h"
+
+namespace
+{
+
+// # of events that the ring buffer of each thread keeps
+const uint32_t max_events = 1 << 14;
+
+const char *operation_tag = "Operation";
+const char *input_tag = "Input";
+const char *output_tag = "Output";
+
+} // namespace
+
+namespace neurun
+{
+namespace exec
+{
+
+constexpr uint32_t Profiler::NO_OPERATION;
+
+std::atomic<bool> Profiler::_enabled{false};
+
+Profiler &Profiler::get(void)
+{
+  static Profiler profiler;
+  return profiler;
+}
+
+Profiler::Profiler()
+    : _tracer{max_events}, _trace_path{nnfw::util::EnvVar{"NEURUN_PROFILE_TRACE"}.asString("")}
+{
+  if (!_trace_path.empty())
+  {
+    start();
+  }
+}
+
+Profiler::~Profiler()
+{
+  if (!_trace_path.empty())
+  {
+    stop(_trace_path);
+  }
+}
+
+void Profiler::start(void)
+{
+  _tracer.start();
+  _enabled = true;
+}
+
+bool Profiler::stop(const std::string &path)
+{
+  _enabled = false;
+  _tracer.stop();
+
+  std::ofstream file{path};
+
+  if (file.is_open())
+  {
+    write(file);
+  }
+
+  std::ofstream roofline{path + ".roofline.txt"};
+
+  if (roofline.is_open())
+  {
+    writeRoofline(roofline);
+  }
+
+  _tracer.clear();
+
+  if (!file.good())
+  {
+    VERBOSE(Profiler) << "Failed to write the trace to " << path << std::endl;
+    return false;
+  }
+
+  VERBOSE(Profiler) << "Write the trace to " << path << std::endl;
+  return true;
+}
+
+uint32_t Profiler::addOperation(const char *name, const std::string &backend,
+                                const std::string &shapes,
+                                const nnfw::util::profiling::OperationCost &cost)
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+
+  _operations.emplace_back(Operation{name, backend, shapes, cost});
+
+  return _operations.size() - 1;
+}
+
+uint64_t Profiler::beginOperation(uint32_t id)
+{
+  // NOTE The tag is looked up when events are written, as '_operations' may grow meanwhile
+  return _tracer.begin(operation_tag, nnfw::util::profiling::EventType::OPERATOR_INVOKE_EVENT, id);
+}
+
+uint64_t Profiler::beginInput(uint32_t index)
+{
+  return _tracer.begin(input_tag, nnfw::util::profiling::EventType::DEFAULT, index);
+}
+
+uint64_t Profiler::beginOutput(uint32_t index)
+{
+  return _tracer.begin(output_tag, nnfw::util::profiling::EventType::DEFAULT, index);
+}
+
+void Profiler::end(uint64_t handle) { _tracer.end(handle); }
+
+void Profiler::write(std::ostream &os) const
+{
+  using nnfw::util::profiling::EventType;
+
+  const auto events = _tracer.collect();
+
+  std::lock_guard<std::mutex> lock{_mutex};
+
+  // Events are shown in a row per thread
+  std::set<uint32_t> threads;
+
+  os << "{\"traceEvents\": [";
+
+  bool first = true;
+
+  for (const auto &event : events)
+  {
+    // Skip the events which have not ended
+    if (event.end_timestamp_us == 0)
+    {
+      continue;
+    }
+
+    os << (first ? "\n" : ",\n");
+    first = false;
+
+    threads.insert(event.thread);
+
+    const bool is_operation = (event.event_type == EventType::OPERATOR_INVOKE_EVENT);
+    const bool is_registered = is_operation && (event.event_metadata < _operations.size());
+    const char *name = is_registered ? _operations.at(event.event_metadata).name : event.tag;
+
+    os << "  {\"name\": \"" << name << "\", \"ph\": \"X\", \"pid\": 0";
+    os << ", \"tid\": " << event.thread;
+    os << ", \"ts\": " << event.begin_timestamp_us;
+    os << ", \"dur\": " << event.end_timestamp_us - event.begin_timestamp_us;
+
+    if (is_registered)
+    {
+      const auto &operation = _operations.at(event.event_metadata);
+
+      os << ", \"cat\": \"operation\"";
+      os << ", \"args\": {\"backend\": \"" << operation.backend << "\", \"shapes\": \""
+         << operation.shapes << "\", \"macs\": " << operation.cost.macs
+         << ", \"bytes\": " << operation.cost.bytes() << "}}";
+    }
+    else if (is_operation)
+    {
+      os << ", \"cat\": \"operation\"}";
+    }
+    else
+    {
+      os << ", \"cat\": \"io\"";
+      os << ", \"args\": {\"index\": " << event.event_metadata << "}}";
+    }
+  }
+
+  // Name the rows
+  for (const auto thread : threads)
+  {
+    os << (first ? "\n" : ",\n");
+    first = false;
+
+    os << "  {\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 0, \"tid\": " << thread
+       << ", \"args\": {\"name\": \"thread " << thread << "\"}}";
+  }
+
+  os << "\n]}\n";
+}
+
+void Profiler::writeRoofline(std::ostream &os) const
+{
+  using nnfw::util::profiling::EventType;
+
+  const auto events = _tracer.collect();
+
+  std::lock_guard<std::mutex> lock{_mutex};
+
+  // # of runs and their total time for each operation
+  std::vector<uint64_t> calls(_operations.size(), 0);
+  std::vector<uint64_t> elapsed_us(_operations.size(), 0);
+
+  for (const auto &event : events)
+  {
+    if (event.end_timestamp_us != 0 && event.event_type == EventType::OPERATOR_INVOKE_EVENT &&
+        event.event_metadata < _operations.size())
+    {
+      calls.at(event.event_metadata) += 1;
+      elapsed_us.at(event.event_metadata) += event.end_timestamp_us - event.begin_timestamp_us;
+    }
+  }
+
+  const double peak_gflops = nnfw::util::EnvVar{"NEURUN_PEAK_GFLOPS"}.asInt(0);
+  const double peak_gbps = nnfw::util::EnvVar{"NEURUN_PEAK_GBPS"}.asInt(0);
+
+  nnfw::util::profiling::Roofline roofline{peak_gflops, peak_gbps};
+
+  for (uint32_t id = 0; id < _operations.size(); ++id)
+  {
+    const auto &operation = _operations.at(id);
+    const auto name = std::to_string(id) + " " + operation.name + " (" + operation.backend + ")";
+
+    roofline.add(name, operation.cost, calls.at(id), elapsed_us.at(id));
+  }
+
+  roofline.report(os);
+}
+
+} // namespace exec
+} // namespace neurun
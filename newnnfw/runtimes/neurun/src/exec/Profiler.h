@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NEURUN_EXEC_PROFILER_H__
+#define __NEURUN_EXEC_PROFILER_H__
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "util/profiling/Roofline.h"
+#include "util/profiling/Tracer.h"
+
+namespace neurun
+{
+namespace exec
+{
+
+// Records when operations run and when inputs/outputs are copied, and writes them as Chrome
+// trace events (JSON, see chrome://tracing)
+//
+// Each thread keeps its events in a ring buffer, so only the latest ones remain once it is full.
+// The metadata of an operation event is the id that 'addOperation' has returned, and that of an
+// input/output event is the index of the input/output.
+//
+// NOTE Set NEURUN_PROFILE_TRACE as a file path to record events from the start and to write them
+//      to the file at exit. ANeuralNetworksProfiler_startEx/stopEx do the same at any time.
+//
+// A roofline report (see nnfw::util::profiling::Roofline) is written next to the trace, with
+// ".roofline.txt" appended to its path. NEURUN_PEAK_GFLOPS and NEURUN_PEAK_GBPS give the peaks
+// of the machine to the report.
+class Profiler
+{
+public:
+  static Profiler &get(void);
+
+public:
+  // NOTE This is the only check on the execution path while the profiler is disabled
+  static bool enabled(void) { return _enabled.load(std::memory_order_relaxed); }
+
+public:
+  void start(void);
+  // Stops recording, and writes the recorded events to 'path'
+  bool stop(const std::string &path);
+
+public:
+  // Id of an operation that has not been registered
+  static constexpr uint32_t NO_OPERATION = 0xFFFFFFFF;
+
+public:
+  // Registers an operation of a plan that events refer to, and returns its id
+  //
+  // NOTE 'name' should remain valid while the profiler lives
+  // NOTE Plans register their operations only if they are compiled while the profiler is enabled.
+  //      Events of the other plans are written without the name and the cost of operations.
+  uint32_t addOperation(const char *name, const std::string &backend, const std::string &shapes,
+                        const nnfw::util::profiling::OperationCost &cost);
+
+public:
+  // NOTE An event should end on the thread that has begun it
+  uint64_t beginOperation(uint32_t id);
+  uint64_t beginInput(uint32_t index);
+  uint64_t beginOutput(uint32_t index);
+  void end(uint64_t handle);
+
+public:
+  void write(std::ostream &os) const;
+  void writeRoofline(std::ostream &os) const;
+
+private:
+  Profiler();
+  ~Profiler();
+
+private:
+  struct Operation
+  {
+    const char *name;
+    std::string backend;
+    std::string shapes;
+    nnfw::util::profiling::OperationCost cost;
+  };
+
+private:
+  static std::atomic<bool> _enabled;
+
+private:
+  nnfw::util::profiling::Tracer _tracer;
+  // NOTE Plans may be built on several threads
+  mutable std::mutex _mutex;
+  std::vector<Operation> _operations;
+  // File that NEURUN_PROFILE_TRACE gives
+  std::string _trace_path;
+};
+
+// Runs 'fn', which is recorded as the event that 'begin' starts if the profiler is enabled
+template <typename Begin, typename Fn> void profile(Begin begin, Fn fn)
+{
+  if (!Profiler::enabled())
+  {
+    fn();
+    return;
+  }
+
+  auto &profiler = Profiler::get();
+  const auto handle = begin(profiler);
+  fn();
+  profiler.end(handle);
+}
+
+} // namespace exec
+} // namespace neurun
+
+#endif // __NEURUN_EXEC_PROFILER_H__
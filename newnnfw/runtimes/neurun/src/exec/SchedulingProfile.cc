@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "SchedulingProfile.h"
+
+#include <algorithm>
+#include <cassert>
+#include <thread>
+
+#include <sched.h>
+
+#include "util/EnvVar.h"
+
+#include "logging.h"
+
+namespace
+{
+
+// The profile that the current thread works with (nullptr means the default one)
+thread_local const neurun::exec::SchedulingProfile *current_profile = nullptr;
+
+uint32_t cores(void)
+{
+  return std::max(std::thread::hardware_concurrency(), 1u);
+}
+
+uint32_t maxThreads(void)
+{
+  const int count = nnfw::util::EnvVar{"NEURUN_NUM_THREADS"}.asInt(static_cast<int>(cores()));
+  return static_cast<uint32_t>(count > 0 ? count : 1);
+}
+
+// Pins the calling thread to a core
+//
+// NOTE Big cores usually have larger numbers on big.LITTLE systems, so threads are pinned from
+//      the last core
+void pinToCore(uint32_t index, uint32_t threads)
+{
+  const uint32_t count = cores();
+  const uint32_t core = (count - std::min(threads, count) + index) % count;
+
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(core, &set);
+
+  if (sched_setaffinity(0, sizeof(set), &set) != 0)
+  {
+    VERBOSE(SchedulingProfile) << "Failed to pin a worker to core " << core << std::endl;
+  }
+}
+
+} // namespace
+
+namespace neurun
+{
+namespace exec
+{
+
+const SchedulingProfile &SchedulingProfile::get(Preference preference)
+{
+  switch (preference)
+  {
+    case Preference::LOW_POWER:
+    {
+      static const SchedulingProfile profile{Preference::LOW_POWER};
+      return profile;
+    }
+    case Preference::FAST_SINGLE_ANSWER:
+    {
+      static const SchedulingProfile profile{Preference::FAST_SINGLE_ANSWER};
+      return profile;
+    }
+    case Preference::SUSTAINED_SPEED:
+    {
+      static const SchedulingProfile profile{Preference::SUSTAINED_SPEED};
+      return profile;
+    }
+    default:
+      throw std::runtime_error{"Unknown preference"};
+  }
+}
+
+const SchedulingProfile &SchedulingProfile::current(void)
+{
+  if (current_profile == nullptr)
+  {
+    return get(Preference::FAST_SINGLE_ANSWER);
+  }
+
+  return *current_profile;
+}
+
+SchedulingProfile::Preference SchedulingProfile::defaultPreference(void)
+{
+  const auto name = nnfw::util::EnvVar{"NEURUN_PREFERENCE"}.asString("FAST_SINGLE_ANSWER");
+
+  if (name == "LOW_POWER")
+  {
+    return Preference::LOW_POWER;
+  }
+  if (name == "SUSTAINED_SPEED")
+  {
+    return Preference::SUSTAINED_SPEED;
+  }
+
+  return Preference::FAST_SINGLE_ANSWER;
+}
+
+SchedulingProfile::Scope::Scope(const SchedulingProfile &profile)
+    : _prev{current_profile}, _prev_scheduler{kernel::cpu::setCurrentScheduler(&profile)}
+{
+  current_profile = &profile;
+}
+
+SchedulingProfile::Scope::~Scope()
+{
+  current_profile = _prev;
+  kernel::cpu::setCurrentScheduler(_prev_scheduler);
+}
+
+SchedulingProfile::SchedulingProfile(Preference preference)
+    : _preference{preference}, _threads{1}, _spin{false}, _pin{false}, _winograd_tile{0}
+{
+  const uint32_t max_threads = maxThreads();
+
+  switch (preference)
+  {
+    case Preference::LOW_POWER:
+      _threads = std::max(max_threads / 4, 1u);
+      _winograd_tile = 2;
+      break;
+    case Preference::FAST_SINGLE_ANSWER:
+      _threads = max_threads;
+      _spin = true;
+      break;
+    case Preference::SUSTAINED_SPEED:
+      _threads = std::max(max_threads / 2, 1u);
+      _pin = true;
+      break;
+    default:
+      throw std::runtime_error{"Unknown preference"};
+  }
+
+  // Workers run kernels with this profile, and may be pinned to cores
+  const uint32_t threads = _threads;
+  const bool pin = _pin;
+
+  _pool.reset(new ThreadPool{_threads, _spin, [this, threads, pin](uint32_t index) {
+                               current_profile = this;
+                               kernel::cpu::setCurrentScheduler(this);
+                               if (pin)
+                               {
+                                 pinToCore(index, threads);
+                               }
+                             }});
+
+  VERBOSE(SchedulingProfile) << "Create " << name() << " profile (threads: " << _threads
+                             << ", spin: " << (_spin ? "on" : "off")
+                             << ", pin: " << (_pin ? "on" : "off") << ", winograd tile: "
+                             << (_winograd_tile == 0 ? "auto" : std::to_string(_winograd_tile))
+                             << ")" << std::endl;
+}
+
+const char *SchedulingProfile::name(void) const
+{
+  switch (_preference)
+  {
+    case Preference::LOW_POWER:
+      return "LOW_POWER";
+    case Preference::FAST_SINGLE_ANSWER:
+      return "FAST_SINGLE_ANSWER";
+    case Preference::SUSTAINED_SPEED:
+      return "SUSTAINED_SPEED";
+    default:
+      return "UNKNOWN";
+  }
+}
+
+} // namespace exec
+} // namespace neurun
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef __NEURUN_EXEC_SCHEDULING_PROFILE_H__
+#define __NEURUN_EXEC_SCHEDULING_PROFILE_H__
+
+#include <cstdint>
+#include <memory>
+
+#include "exec/ThreadPool.h"
+#include "kernel/cpu/Scheduler.h"
+
+namespace neurun
+{
+namespace exec
+{
+
+// How the CPU kernels of a plan use the cores, which follows the execution preference of NNAPI
+//
+//  - LOW_POWER          : a quarter of the threads, idle workers sleep at once, and Winograd
+//                         convolutions use 2x2 tiles (smaller transforms and scratch memory)
+//  - FAST_SINGLE_ANSWER : all the threads, idle workers spin for a while to take the next
+//                         kernel sooner, and Winograd tiles are chosen for fewer multiplications
+//  - SUSTAINED_SPEED    : half of the threads, each of which is pinned to a core so that the
+//                         throughput does not vary with thread migration
+//
+// NOTE The number of threads is read from NEURUN_NUM_THREADS (default: # of cores)
+// NOTE A profile is the scheduler of CPU kernels on the threads that it is current for
+class SchedulingProfile final : public kernel::cpu::IScheduler
+{
+public:
+  enum class Preference
+  {
+    LOW_POWER,
+    FAST_SINGLE_ANSWER,
+    SUSTAINED_SPEED
+  };
+
+public:
+  // Returns the profile of a preference, which is created on first use and shared by the runtime
+  static const SchedulingProfile &get(Preference preference);
+
+  // Returns the profile of the calling thread, which is set by Scope (or by the pool of a worker)
+  //
+  // NOTE This is FAST_SINGLE_ANSWER (the default of NNAPI) outside of any scope
+  static const SchedulingProfile &current(void);
+
+  // Returns the preference of a compilation that does not set it
+  //
+  // NOTE Set NEURUN_PREFERENCE as "LOW_POWER", "FAST_SINGLE_ANSWER" or "SUSTAINED_SPEED"
+  static Preference defaultPreference(void);
+
+public:
+  // Makes a profile current for the calling thread while it lives
+  class Scope
+  {
+  public:
+    Scope(const SchedulingProfile &profile);
+    ~Scope();
+
+  public:
+    Scope(const Scope &) = delete;
+    Scope &operator=(const Scope &) = delete;
+
+  private:
+    const SchedulingProfile *_prev;
+    const kernel::cpu::IScheduler *_prev_scheduler;
+  };
+
+private:
+  SchedulingProfile(Preference preference);
+
+public:
+  Preference preference(void) const { return _preference; }
+  const char *name(void) const;
+  ThreadPool &pool(void) const { return *_pool; }
+
+public:
+  uint32_t threads(void) const { return _threads; }
+  bool spin(void) const { return _spin; }
+  bool pin(void) const { return _pin; }
+
+public:
+  // kernel::cpu::IScheduler
+  uint32_t concurrency(void) const override { return _pool->size(); }
+  void parallel(uint32_t count, const std::function<void(uint32_t)> &fn) const override
+  {
+    _pool->parallel(count, fn);
+  }
+  uint32_t winogradTile(void) const override { return _winograd_tile; }
+
+private:
+  const Preference _preference;
+  uint32_t _threads;
+  bool _spin;
+  bool _pin;
+  uint32_t _winograd_tile;
+  std::unique_ptr<ThreadPool> _pool;
+};
+
+} // namespace exec
+} // namespace neurun
+
+#endif // __NEURUN_EXEC_SCHEDULING_PROFILE_H__
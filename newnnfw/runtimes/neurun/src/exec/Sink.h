@@ -18,8 +18,9 @@
 #define __NEURUN_EXEC_SINK_H__
 
 #include <cassert>
+#include <cstring>
 
-#include <arm_compute/core/ITensor.h>
+#include <arm_compute/runtime/CL/CLTensor.h>
 
 #include <util/feature/Shape.h>
 #include <util/feature/IndexIterator.h>
@@ -27,6 +28,9 @@
 #include "backend/cpu/operand/Tensor.h" // TODO Remove this dependency to backend
 #include "internal/nnapi/feature/View.h"
 #include "internal/nnapi/feature/Reader.h"
+#include "internal/nnapi/feature/Utils.h"
+
+#include "backend/acl_cl/feature/View.h"
 
 namespace neurun
 {
@@ -37,6 +41,12 @@ struct Sink
 {
   virtual ~Sink() = default;
 
+  // Called before computation so that the result may be written into the user buffer directly
+  virtual void bind(::arm_compute::ITensor &) const
+  {
+    // DO NOTHING
+  }
+
   virtual void pull(::arm_compute::ITensor &tensor) const = 0;
 };
 
@@ -46,29 +56,56 @@ struct Sink
 class VectorSink final : public Sink
 {
 public:
-  VectorSink(const int32_t vlen, uint8_t *base, const size_t size) : _vlen{vlen}, _base{base}
+  // NOTE The user buffer has 'batch' vectors of 'vlen' elements one after another
+  VectorSink(const int32_t batch, const int32_t vlen, uint8_t *base, const size_t size)
+      : _batch{batch}, _vlen{vlen}, _base{base}, _size{size}
   {
-    (void)size; // Workaround for unused variable in release mode
-    assert(size >= _vlen * sizeof(float));
+    // DO NOTHING
   }
 
 public:
+  void bind(::arm_compute::ITensor &tensor) const override
+  {
+    // CPU tensor has the same layout as the user buffer, so the buffer is used as it is
+    if (typeid(tensor) == typeid(neurun::backend::cpu::operand::Tensor))
+    {
+      assert(_size >= tensor.info()->total_size());
+
+      auto &cpu_tensor = static_cast<neurun::backend::cpu::operand::Tensor &>(tensor);
+      cpu_tensor.setBuffer(_base);
+    }
+  }
+
   void pull(::arm_compute::ITensor &tensor) const override
   {
-    float *base = reinterpret_cast<float *>(_base);
+    if (tensor.buffer() == _base)
+    {
+      // Already written by computation
+      return;
+    }
+
+    // NOTE Elements are copied as they are, so any element type (e.g. QUANT8) works
+    const auto elem_size = tensor.info()->element_size();
 
-    for (int32_t n = 0; n < _vlen; ++n)
+    assert(_size >= _batch * _vlen * elem_size);
+
+    for (int32_t b = 0; b < _batch; ++b)
     {
-      auto from = reinterpret_cast<float *>(tensor.ptr_to_element(::arm_compute::Coordinates{n}));
-      auto into = base + n;
+      for (int32_t n = 0; n < _vlen; ++n)
+      {
+        auto from = tensor.ptr_to_element(::arm_compute::Coordinates{n, b});
+        auto into = _base + (b * _vlen + n) * elem_size;
 
-      *into = *from;
+        memcpy(into, from, elem_size);
+      }
     }
   }
 
 private:
+  const int32_t _batch;
   const int32_t _vlen;
   uint8_t *const _base;
+  const size_t _size;
 };
 
 //
@@ -84,29 +121,55 @@ public:
   }
 
 public:
-  void pull(::arm_compute::ITensor &tensor) const override
+  void bind(::arm_compute::ITensor &tensor) const override
   {
-    // TODO: This is just workaround codes, It needs to refactor.
+    // CPU tensor is NHWC as the user buffer is, so the buffer is used as it is
     if (typeid(tensor) == typeid(neurun::backend::cpu::operand::Tensor))
     {
-      const ::internal::nnapi::feature::Reader<float> from{_shape, tensor.buffer(), _size};
-      ::internal::nnapi::feature::View<float> into{_shape, _base, _size};
+      assert(_size >= tensor.info()->total_size());
 
-      ::nnfw::util::feature::iterate(_shape)
-          << [&](uint32_t bat, uint32_t ch, uint32_t row, uint32_t col) {
-               const auto value = from.at(bat, ch, row, col);
-               into.at(bat, ch, row, col) = value;
-             };
+      auto &cpu_tensor = static_cast<neurun::backend::cpu::operand::Tensor &>(tensor);
+      cpu_tensor.setBuffer(_base);
     }
-    else if (typeid(tensor) == typeid(::arm_compute::CLTensor))
+  }
+
+  void pull(::arm_compute::ITensor &tensor) const override
+  {
+    if (tensor.buffer() == _base)
     {
-      const ::internal::arm_compute::feature::View<float> from{&tensor};
-      ::internal::nnapi::feature::View<float> into{_shape, _base, _size};
+      // Already written by computation
+      return;
+    }
+
+    // TODO: This is just workaround codes, It needs to refactor.
+    if (typeid(tensor) == typeid(::arm_compute::CLTensor))
+    {
+      if (tensor.info()->data_type() == ::arm_compute::DataType::F32)
+      {
+        const ::internal::arm_compute::feature::View<float> from{&tensor};
+        ::internal::nnapi::feature::View<float> into{_shape, _base, _size};
+
+        ::nnfw::util::feature::iterate(_shape)
+            << [&](uint32_t bat, uint32_t ch, uint32_t row, uint32_t col) {
+                 const auto value = from.at(bat, ch, row, col);
+                 into.at(bat, ch, row, col) = value;
+               };
+        return;
+      }
+
+      // NOTE Other elements (e.g. QUANT8) are copied as they are from ACL's layout into NHWC
+      const auto elem_size = tensor.info()->element_size();
+
+      assert(_size >= _shape.N * _shape.C * _shape.H * _shape.W * elem_size);
 
       ::nnfw::util::feature::iterate(_shape)
           << [&](uint32_t bat, uint32_t ch, uint32_t row, uint32_t col) {
-               const auto value = from.at(bat, ch, row, col);
-               into.at(bat, ch, row, col) = value;
+               const auto from =
+                   tensor.ptr_to_element(::arm_compute::Coordinates{col, row, ch, bat});
+               auto into = _base + ::internal::nnapi::feature::index_of(_shape, bat, ch, row, col) *
+                                       elem_size;
+
+               memcpy(into, from, elem_size);
              };
     }
   }
@@ -18,6 +18,7 @@
 #define __NEURUN_EXEC_SOURCE_H__
 
 #include <cassert>
+#include <cstring>
 
 #include <arm_compute/runtime/CL/CLTensor.h>
 
@@ -27,6 +28,7 @@
 #include "backend/cpu/operand/Tensor.h" // TODO Remove this dependency to backend
 #include "internal/nnapi/feature/Reader.h"
 #include "internal/nnapi/feature/View.h"
+#include "internal/nnapi/feature/Utils.h"
 
 #include "backend/acl_cl/feature/View.h"
 
@@ -48,30 +50,48 @@ struct Source
 class VectorSource final : public Source
 {
 public:
-  VectorSource(const int32_t vlen, const uint8_t *base, const size_t size)
-      : _vlen{vlen}, _base{base}
+  // NOTE The user buffer has 'batch' vectors of 'vlen' elements one after another
+  VectorSource(const int32_t batch, const int32_t vlen, const uint8_t *base, const size_t size)
+      : _batch{batch}, _vlen{vlen}, _base{base}, _size{size}
   {
-    (void)size; // Workaround for unused variable in release mode
-    assert(size >= _vlen * sizeof(float));
+    // DO NOTHING
   }
 
 public:
   void push(::arm_compute::ITensor &tensor) const override
   {
-    auto base = reinterpret_cast<const float *>(_base);
+    // CPU tensor has the same layout as the user buffer, so the buffer is used as it is
+    if (typeid(tensor) == typeid(neurun::backend::cpu::operand::Tensor))
+    {
+      assert(_size >= tensor.info()->total_size());
+
+      auto &cpu_tensor = static_cast<neurun::backend::cpu::operand::Tensor &>(tensor);
+      cpu_tensor.setBuffer(const_cast<uint8_t *>(_base));
+      return;
+    }
+
+    // NOTE Elements are copied as they are, so any element type (e.g. QUANT8) works
+    const auto elem_size = tensor.info()->element_size();
 
-    for (int32_t n = 0; n < _vlen; ++n)
+    assert(_size >= _batch * _vlen * elem_size);
+
+    for (int32_t b = 0; b < _batch; ++b)
     {
-      auto from = base + n;
-      auto into = reinterpret_cast<float *>(tensor.ptr_to_element(::arm_compute::Coordinates{n}));
+      for (int32_t n = 0; n < _vlen; ++n)
+      {
+        auto from = _base + (b * _vlen + n) * elem_size;
+        auto into = tensor.ptr_to_element(::arm_compute::Coordinates{n, b});
 
-      *into = *from;
+        memcpy(into, from, elem_size);
+      }
     }
   }
 
 private:
+  const int32_t _batch;
   const int32_t _vlen;
   const uint8_t *const _base;
+  const size_t _size;
 };
 
 //
@@ -92,24 +112,40 @@ public:
     // TODO: This is just workaround codes, It needs to refactor.
     if (typeid(tensor) == typeid(neurun::backend::cpu::operand::Tensor))
     {
-      const ::internal::nnapi::feature::Reader<float> from{_shape, _base, _size};
-      ::internal::nnapi::feature::View<float> into{_shape, tensor.buffer(), _size};
+      // CPU tensor is NHWC as the user buffer is, so the buffer is used as it is
+      assert(_size >= tensor.info()->total_size());
 
-      ::nnfw::util::feature::iterate(_shape)
-          << [&](uint32_t bat, uint32_t ch, uint32_t row, uint32_t col) {
-               const auto value = from.at(bat, ch, row, col);
-               into.at(bat, ch, row, col) = value;
-             };
+      auto &cpu_tensor = static_cast<neurun::backend::cpu::operand::Tensor &>(tensor);
+      cpu_tensor.setBuffer(const_cast<uint8_t *>(_base));
     }
     else if (typeid(tensor) == typeid(::arm_compute::CLTensor))
     {
-      const ::internal::nnapi::feature::Reader<float> from{_shape, _base, _size};
-      ::internal::arm_compute::feature::View<float> into{&tensor};
+      if (tensor.info()->data_type() == ::arm_compute::DataType::F32)
+      {
+        const ::internal::nnapi::feature::Reader<float> from{_shape, _base, _size};
+        ::internal::arm_compute::feature::View<float> into{&tensor};
+
+        ::nnfw::util::feature::iterate(_shape)
+            << [&](uint32_t bat, uint32_t ch, uint32_t row, uint32_t col) {
+                 const auto value = from.at(bat, ch, row, col);
+                 into.at(bat, ch, row, col) = value;
+               };
+        return;
+      }
+
+      // NOTE Other elements (e.g. QUANT8) are copied as they are from NHWC into ACL's layout
+      const auto elem_size = tensor.info()->element_size();
+
+      assert(_size >= _shape.N * _shape.C * _shape.H * _shape.W * elem_size);
 
       ::nnfw::util::feature::iterate(_shape)
           << [&](uint32_t bat, uint32_t ch, uint32_t row, uint32_t col) {
-               const auto value = from.at(bat, ch, row, col);
-               into.at(bat, ch, row, col) = value;
+               const auto from =
+                   _base + ::internal::nnapi::feature::index_of(_shape, bat, ch, row, col) *
+                               elem_size;
+               auto into = tensor.ptr_to_element(::arm_compute::Coordinates{col, row, ch, bat});
+
+               memcpy(into, from, elem_size);
              };
     }
   }
@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+
+namespace
+{
+
+// How long an idle worker polls the queues before it sleeps (if the pool spins)
+const std::chrono::microseconds spin_duration{200};
+
+// The pool and the queue that the current thread works on (if it is a worker)
+thread_local const neurun::exec::ThreadPool *current_pool = nullptr;
+thread_local uint32_t current_index = 0;
+
+} // namespace
+
+namespace neurun
+{
+namespace exec
+{
+
+ThreadPool::ThreadPool(uint32_t num_threads, bool spin, const Init &init)
+    : _spin{spin}, _init{init}, _pending{0}, _next{0}, _stop{false}
+{
+  assert(num_threads > 0);
+
+  for (uint32_t n = 0; n < num_threads; ++n)
+  {
+    _queues.emplace_back(new Queue);
+  }
+
+  for (uint32_t n = 0; n < num_threads; ++n)
+  {
+    _threads.emplace_back([this, n] { work(n); });
+  }
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _stop = true;
+  }
+
+  _cv.notify_all();
+
+  for (auto &thread : _threads)
+  {
+    thread.join();
+  }
+}
+
+void ThreadPool::submit(Task &&task)
+{
+  uint32_t index = 0;
+
+  if (current_pool == this)
+  {
+    index = current_index;
+  }
+  else
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    index = _next;
+    _next = (_next + 1) % _queues.size();
+  }
+
+  {
+    auto &queue = *_queues.at(index);
+    std::lock_guard<std::mutex> lock{queue.mutex};
+    queue.tasks.emplace_back(std::move(task));
+  }
+
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _pending += 1;
+  }
+
+  _cv.notify_one();
+}
+
+void ThreadPool::parallel(uint32_t count, const std::function<void(uint32_t)> &fn)
+{
+  if (count <= 1)
+  {
+    if (count == 1)
+    {
+      fn(0);
+    }
+    return;
+  }
+
+  struct Context
+  {
+    const std::function<void(uint32_t)> *fn;
+    uint32_t count;
+    std::atomic<uint32_t> next{0};
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    uint32_t done = 0;
+  };
+
+  auto ctx = std::make_shared<Context>();
+
+  ctx->fn = &fn;
+  ctx->count = count;
+
+  // NOTE 'fn' is touched only while some of its calls are not done, that is, while the caller
+  //      is still waiting below
+  auto drain = [](Context &ctx) {
+    uint32_t finished = 0;
+
+    for (uint32_t n = ctx.next.fetch_add(1); n < ctx.count; n = ctx.next.fetch_add(1))
+    {
+      (*ctx.fn)(n);
+      ++finished;
+    }
+
+    if (finished > 0)
+    {
+      std::lock_guard<std::mutex> lock{ctx.mutex};
+      ctx.done += finished;
+      if (ctx.done == ctx.count)
+      {
+        ctx.cv.notify_all();
+      }
+    }
+  };
+
+  const uint32_t helpers = std::min<uint32_t>(count - 1, size());
+
+  for (uint32_t n = 0; n < helpers; ++n)
+  {
+    submit([ctx, drain] { drain(*ctx); });
+  }
+
+  drain(*ctx);
+
+  std::unique_lock<std::mutex> lock{ctx->mutex};
+  ctx->cv.wait(lock, [&ctx] { return ctx->done == ctx->count; });
+}
+
+bool ThreadPool::pop(uint32_t index, Task &task)
+{
+  auto &queue = *_queues.at(index);
+  std::lock_guard<std::mutex> lock{queue.mutex};
+
+  if (queue.tasks.empty())
+  {
+    return false;
+  }
+
+  task = std::move(queue.tasks.back());
+  queue.tasks.pop_back();
+
+  return true;
+}
+
+bool ThreadPool::steal(uint32_t index, Task &task)
+{
+  const uint32_t count = _queues.size();
+
+  for (uint32_t offset = 1; offset < count; ++offset)
+  {
+    auto &queue = *_queues.at((index + offset) % count);
+    std::lock_guard<std::mutex> lock{queue.mutex};
+
+    if (!queue.tasks.empty())
+    {
+      task = std::move(queue.tasks.front());
+      queue.tasks.pop_front();
+      return true;
+    }
+  }
+
+  return false;
+}
+
+bool ThreadPool::spin(uint32_t index, Task &task)
+{
+  const auto deadline = std::chrono::steady_clock::now() + spin_duration;
+
+  while (std::chrono::steady_clock::now() < deadline)
+  {
+    if (pop(index, task) || steal(index, task))
+    {
+      return true;
+    }
+
+    std::this_thread::yield();
+  }
+
+  return false;
+}
+
+void ThreadPool::work(uint32_t index)
+{
+  current_pool = this;
+  current_index = index;
+
+  if (_init)
+  {
+    _init(index);
+  }
+
+  while (true)
+  {
+    Task task;
+
+    if (pop(index, task) || steal(index, task) || (_spin && spin(index, task)))
+    {
+      {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _pending -= 1;
+      }
+
+      task();
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock{_mutex};
+    _cv.wait(lock, [this] { return _stop || (_pending > 0); });
+
+    if (_stop && (_pending <= 0))
+    {
+      return;
+    }
+  }
+}
+
+} // namespace exec
+} // namespace neurun
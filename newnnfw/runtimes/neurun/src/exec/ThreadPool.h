@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NEURUN_EXEC_THREAD_POOL_H__
+#define __NEURUN_EXEC_THREAD_POOL_H__
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace neurun
+{
+namespace exec
+{
+
+// Work-stealing thread pool
+//
+// Each worker owns a task deque. A task submitted from a worker is pushed to that worker's deque,
+// and the worker pops its own tasks in LIFO order to keep producer/consumer data hot in cache.
+// Idle workers steal from the other end of the other deques.
+class ThreadPool
+{
+public:
+  using Task = std::function<void(void)>;
+  // Called on each worker (with its index) before the worker takes any task
+  using Init = std::function<void(uint32_t)>;
+
+public:
+  // NOTE With 'spin', idle workers poll the queues for a while before they sleep, which lets
+  //      them take the next task sooner at the cost of CPU time
+  ThreadPool(uint32_t num_threads, bool spin = false, const Init &init = nullptr);
+  ~ThreadPool();
+
+public:
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+public:
+  uint32_t size(void) const { return _threads.size(); }
+
+public:
+  void submit(Task &&task);
+
+  // Runs 'fn(0)', ..., 'fn(count - 1)' on workers and returns when all of them are done
+  //
+  // NOTE The calling thread also runs 'fn', so this may be called from a worker without deadlock
+  void parallel(uint32_t count, const std::function<void(uint32_t)> &fn);
+
+private:
+  struct Queue
+  {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+  };
+
+private:
+  void work(uint32_t index);
+  bool pop(uint32_t index, Task &task);
+  bool steal(uint32_t index, Task &task);
+  bool spin(uint32_t index, Task &task);
+
+private:
+  const bool _spin;
+  const Init _init;
+  std::vector<std::unique_ptr<Queue>> _queues;
+  std::vector<std::thread> _threads;
+
+private:
+  std::mutex _mutex;
+  std::condition_variable _cv;
+  // NOTE '_pending' may become negative for a while as a task can be taken before it is counted
+  int32_t _pending;
+  uint32_t _next;
+  bool _stop;
+};
+
+} // namespace exec
+} // namespace neurun
+
+#endif // __NEURUN_EXEC_THREAD_POOL_H__
@@ -15,6 +15,7 @@
  */
 
 #include <NeuralNetworks.h>
+#include <NeuralNetworksEx.h>
 
 #include <new>
 
@@ -61,13 +62,58 @@ void ANeuralNetworksCompilation_free(ANeuralNetworksCompilation *compilation)
 }
 
 int ANeuralNetworksCompilation_setPreference(ANeuralNetworksCompilation *compilation,
-                                             int32_t /* preference */)
+                                             int32_t preference)
 {
   if (compilation == nullptr)
   {
     return ANEURALNETWORKS_UNEXPECTED_NULL;
   }
 
-  // NYi
+  using Preference = neurun::exec::SchedulingProfile::Preference;
+
+  switch (preference)
+  {
+    case ANEURALNETWORKS_PREFER_LOW_POWER:
+      compilation->preference(Preference::LOW_POWER);
+      break;
+    case ANEURALNETWORKS_PREFER_FAST_SINGLE_ANSWER:
+      compilation->preference(Preference::FAST_SINGLE_ANSWER);
+      break;
+    case ANEURALNETWORKS_PREFER_SUSTAINED_SPEED:
+      compilation->preference(Preference::SUSTAINED_SPEED);
+      break;
+    default:
+      return ANEURALNETWORKS_BAD_DATA;
+  }
+
+  return ANEURALNETWORKS_NO_ERROR;
+}
+
+int ANeuralNetworksCompilation_setBatchSizeEx(ANeuralNetworksCompilation *compilation,
+                                              uint32_t batch)
+{
+  if (compilation == nullptr)
+  {
+    return ANEURALNETWORKS_UNEXPECTED_NULL;
+  }
+
+  if (batch == 0)
+  {
+    return ANEURALNETWORKS_BAD_DATA;
+  }
+
+  auto &model = compilation->plan().model();
+
+  // NOTE Operands cannot be resized once the model is lowered by 'finish'
+  if (!model.isModelPhase())
+  {
+    return ANEURALNETWORKS_BAD_STATE;
+  }
+
+  if (!model.setBatchSize(batch))
+  {
+    return ANEURALNETWORKS_BAD_DATA;
+  }
+
   return ANEURALNETWORKS_NO_ERROR;
 }
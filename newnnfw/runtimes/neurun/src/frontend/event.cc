@@ -25,7 +25,16 @@ int ANeuralNetworksEvent_wait(ANeuralNetworksEvent *event)
     return ANEURALNETWORKS_UNEXPECTED_NULL;
   }
 
-  return ANEURALNETWORKS_NO_ERROR;
+  return event->wait();
 }
 
-void ANeuralNetworksEvent_free(ANeuralNetworksEvent *event) { delete event; }
+void ANeuralNetworksEvent_free(ANeuralNetworksEvent *event)
+{
+  if (event != nullptr)
+  {
+    // NOTE The computation in flight should finish before its event is released
+    event->wait();
+  }
+
+  delete event;
+}
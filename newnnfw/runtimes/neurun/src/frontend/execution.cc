@@ -15,53 +15,47 @@
  */
 
 #include <NeuralNetworks.h>
+#include <NeuralNetworksEx.h>
 
+#include <future>
+#include <memory>
 #include <new>
+#include <thread>
 
 #include "frontend/wrapper/compilation.h"
 #include "frontend/wrapper/execution.h"
 #include "frontend/wrapper/event.h"
+#include "frontend/wrapper/memory.h"
 
 #include "graph/operand/Index.h"
+#include "exec/DataflowExecutor.h"
+#include "exec/Profiler.h"
+#include "exec/SchedulingProfile.h"
+#include "exec/ThreadPool.h"
 
-//
-// NNAPI Implementation
-//
-int ANeuralNetworksExecution_create(ANeuralNetworksCompilation *compilation,
-                                    ANeuralNetworksExecution **execution)
-{
-  if ((compilation == nullptr) || (execution == nullptr))
-  {
-    return ANEURALNETWORKS_UNEXPECTED_NULL;
-  }
+#include "util/EnvVar.h"
 
-  std::shared_ptr<const neurun::codegen::Plan> plan;
-
-  compilation->publish(plan);
+namespace
+{
 
-  *execution = new (std::nothrow) ANeuralNetworksExecution{plan};
-  if (*execution == nullptr)
-  {
-    return ANEURALNETWORKS_OUT_OF_MEMORY;
-  }
+// Workers that run the executions started with ANeuralNetworksExecution_startCompute
+//
+// NOTE The number of workers is read from NEURUN_NUM_EXECUTION_WORKERS (default: # of cores)
+neurun::exec::ThreadPool &workers(void)
+{
+  static neurun::exec::ThreadPool pool{[](void) {
+    const int hw_count = static_cast<int>(std::thread::hardware_concurrency());
+    const int count = nnfw::util::EnvVar{"NEURUN_NUM_EXECUTION_WORKERS"}.asInt(hw_count);
+    return static_cast<uint32_t>(count > 0 ? count : 1);
+  }()};
 
-  return ANEURALNETWORKS_NO_ERROR;
+  return pool;
 }
 
-int ANeuralNetworksExecution_setInput(ANeuralNetworksExecution *execution, int32_t index,
-                                      const ANeuralNetworksOperandType * /* type */,
-                                      const void *buffer, size_t length)
+void source(ANeuralNetworksExecution &execution, int32_t index, const uint8_t *buffer,
+            size_t length)
 {
-  // Don't check type
-  // Comment about ANeuralNetworksOperandType in NeuralNetworks.h:
-  //  If the input or output is optional and omitted then it need not have a fully specified tensor
-  //  operand type
-  if ((execution == nullptr) || ((buffer == nullptr) && (length != 0)))
-  {
-    return ANEURALNETWORKS_UNEXPECTED_NULL;
-  }
-
-  const auto &operands = execution->plan().model().operands();
+  const auto &operands = execution.plan().model().operands();
 
   // TODO Check type conflicts
 
@@ -69,46 +63,30 @@ int ANeuralNetworksExecution_setInput(ANeuralNetworksExecution *execution, int32
   // TODO Remove this assumption
   neurun::graph::operand::IO::Index input_index{index};
 
-  const auto operand_index = execution->plan().model().getInputs().at(input_index);
+  const auto operand_index = execution.plan().model().getInputs().at(input_index);
 
   if (operands.at(operand_index).shape().rank() == 2)
   {
-    assert(operands.at(operand_index).shape().dim(0) == 1);
-
+    const auto batch = operands.at(operand_index).shape().dim(0);
     const auto len = operands.at(operand_index).shape().dim(1);
 
-    execution->source<neurun::exec::VectorSource>(
-        index, len, reinterpret_cast<const uint8_t *>(buffer), length);
+    execution.source<neurun::exec::VectorSource>(index, batch, len, buffer, length);
   }
   else if (operands.at(operand_index).shape().rank() == 4)
   {
     const auto &operand_shape = operands.at(operand_index).shape().asFeature();
 
-    execution->source<neurun::exec::FeatureSource>(
-        index, operand_shape, reinterpret_cast<const uint8_t *>(buffer), length);
+    execution.source<neurun::exec::FeatureSource>(index, operand_shape, buffer, length);
   }
   else
   {
     throw std::runtime_error{"Not supported, yet"};
   }
-
-  return ANEURALNETWORKS_NO_ERROR;
 }
 
-int ANeuralNetworksExecution_setOutput(ANeuralNetworksExecution *execution, int32_t index,
-                                       const ANeuralNetworksOperandType * /* type */, void *buffer,
-                                       size_t length)
+void sink(ANeuralNetworksExecution &execution, int32_t index, uint8_t *buffer, size_t length)
 {
-  // Don't check type
-  // Comment about ANeuralNetworksOperandType in NeuralNetworks.h:
-  //  If the input or output is optional and omitted then it need not have a fully specified tensor
-  //  operand type
-  if ((execution == nullptr) || ((buffer == nullptr) && (length != 0)))
-  {
-    return ANEURALNETWORKS_UNEXPECTED_NULL;
-  }
-
-  const auto &operands = execution->plan().model().operands();
+  const auto &operands = execution.plan().model().operands();
 
   // TODO Check type conflicts
 
@@ -116,120 +94,308 @@ int ANeuralNetworksExecution_setOutput(ANeuralNetworksExecution *execution, int3
   // TODO Remove this assumption
   neurun::graph::operand::IO::Index output_index{index};
 
-  const auto operand_index = execution->plan().model().getOutputs().at(output_index);
+  const auto operand_index = execution.plan().model().getOutputs().at(output_index);
 
   if (operands.at(operand_index).shape().rank() == 2)
   {
-    assert(operands.at(operand_index).shape().dim(0) == 1);
-
+    const auto batch = operands.at(operand_index).shape().dim(0);
     const auto len = operands.at(operand_index).shape().dim(1);
 
-    execution->sink<neurun::exec::VectorSink>(index, len, reinterpret_cast<uint8_t *>(buffer),
-                                              length);
+    execution.sink<neurun::exec::VectorSink>(index, batch, len, buffer, length);
   }
   else if (operands.at(operand_index).shape().rank() == 4)
   {
     const auto &operand_shape = operands.at(operand_index).shape().asFeature();
 
-    execution->sink<neurun::exec::FeatureSink>(index, operand_shape,
-                                               reinterpret_cast<uint8_t *>(buffer), length);
+    execution.sink<neurun::exec::FeatureSink>(index, operand_shape, buffer, length);
   }
   else
   {
     throw std::runtime_error{"Not supported, yet"};
   }
-
-  return ANEURALNETWORKS_NO_ERROR;
 }
 
-int ANeuralNetworksExecution_startCompute(ANeuralNetworksExecution *execution,
-                                          ANeuralNetworksEvent **event)
+void compute(const ANeuralNetworksExecution &execution)
 {
-  if ((execution == nullptr) || (event == nullptr))
-  {
-    return ANEURALNETWORKS_UNEXPECTED_NULL;
-  }
+  const auto &plan = execution.plan();
+  const auto &model = plan.model();
 
-  // TODO: Handle event
-  *event = new (std::nothrow) ANeuralNetworksEvent{};
-  if (*event == nullptr)
-  {
-    return ANEURALNETWORKS_OUT_OF_MEMORY;
-  }
+  // Executions of the same plan take turns as they share tensors
+  std::lock_guard<std::mutex> lock{plan.execution_mutex()};
 
-  const auto &plan = execution->plan();
-  const auto &model = plan.model();
+  // Kernels run on the pool of the profile of the plan
+  neurun::exec::SchedulingProfile::Scope scope{plan.profile()};
 
   // Set input(s)
   for (uint32_t n = 0; n < model.getInputs().size(); ++n)
   {
-    auto setter = [&](::arm_compute::ITensor &tensor) { execution->source(n).push(tensor); };
+    auto setter = [&](::arm_compute::ITensor &tensor) { execution.source(n).push(tensor); };
 
     neurun::graph::operand::IO::Index input_index{n};
 
     ::neurun::graph::operand::Index index{model.getInputs().at(input_index)};
     auto objects = plan.operands().at(index);
 
+    neurun::exec::profile(
+        [n](neurun::exec::Profiler &profiler) { return profiler.beginInput(n); },
+        [&] {
+          for (auto object : objects)
+          {
+            object->access(setter);
+          }
+        });
+  }
+
+  // Bind output(s)
+  for (uint32_t n = 0; n < model.getOutputs().size(); ++n)
+  {
+    auto binder = [&](::arm_compute::ITensor &tensor) { execution.sink(n).bind(tensor); };
+
+    neurun::graph::operand::IO::Index output_index{n};
+
+    ::neurun::graph::operand::Index index{model.getOutputs().at(output_index)};
+    auto objects = plan.operands().at(index);
+
     for (auto object : objects)
     {
-      object->access(setter);
+      object->access(binder);
     }
   }
 
-  const auto &operations = execution->plan().operations();
-
-  for (uint32_t n = 0; n < operations.size(); ++n)
+  if (neurun::exec::DataflowExecutor::enabled())
   {
-    operations.at(n).run();
+    neurun::exec::DataflowExecutor{plan, plan.profile().pool()}.run();
+  }
+  else
+  {
+    const auto &operations = plan.operations();
+    const auto &dataflow = plan.dataflow();
+
+    // NOTE Blocks are appended in the order of operations
+    for (uint32_t b = 0; b < dataflow.size(); ++b)
+    {
+      const auto &block = dataflow.at(b);
+
+      neurun::exec::profile(
+          [&](neurun::exec::Profiler &profiler) {
+            return profiler.beginOperation(block.profile_id);
+          },
+          [&] {
+            for (uint32_t n = block.begin; n < block.end; ++n)
+            {
+              operations.at(n).run();
+            }
+          });
+    }
   }
 
   // Get output(s)
   for (uint32_t n = 0; n < model.getOutputs().size(); ++n)
   {
-    auto getter = [&](::arm_compute::ITensor &tensor) { execution->sink(n).pull(tensor); };
+    auto getter = [&](::arm_compute::ITensor &tensor) { execution.sink(n).pull(tensor); };
 
     neurun::graph::operand::IO::Index output_index{n};
 
     ::neurun::graph::operand::Index index{model.getOutputs().at(output_index)};
     auto objects = plan.operands().at(index);
 
-    for (auto object : objects)
+    neurun::exec::profile(
+        [n](neurun::exec::Profiler &profiler) { return profiler.beginOutput(n); },
+        [&] {
+          for (auto object : objects)
+          {
+            object->access(getter);
+          }
+        });
+  }
+}
+
+} // namespace
+
+//
+// NNAPI Implementation
+//
+int ANeuralNetworksExecution_create(ANeuralNetworksCompilation *compilation,
+                                    ANeuralNetworksExecution **execution)
+{
+  if ((compilation == nullptr) || (execution == nullptr))
+  {
+    return ANEURALNETWORKS_UNEXPECTED_NULL;
+  }
+
+  std::shared_ptr<const neurun::codegen::Plan> plan;
+
+  compilation->publish(plan);
+
+  *execution = new (std::nothrow) ANeuralNetworksExecution{plan};
+  if (*execution == nullptr)
+  {
+    return ANEURALNETWORKS_OUT_OF_MEMORY;
+  }
+
+  return ANEURALNETWORKS_NO_ERROR;
+}
+
+int ANeuralNetworksExecution_setInput(ANeuralNetworksExecution *execution, int32_t index,
+                                      const ANeuralNetworksOperandType * /* type */,
+                                      const void *buffer, size_t length)
+{
+  // Don't check type
+  // Comment about ANeuralNetworksOperandType in NeuralNetworks.h:
+  //  If the input or output is optional and omitted then it need not have a fully specified tensor
+  //  operand type
+  if ((execution == nullptr) || ((buffer == nullptr) && (length != 0)))
+  {
+    return ANEURALNETWORKS_UNEXPECTED_NULL;
+  }
+
+  source(*execution, index, reinterpret_cast<const uint8_t *>(buffer), length);
+
+  return ANEURALNETWORKS_NO_ERROR;
+}
+
+int ANeuralNetworksExecution_setOutput(ANeuralNetworksExecution *execution, int32_t index,
+                                       const ANeuralNetworksOperandType * /* type */, void *buffer,
+                                       size_t length)
+{
+  // Don't check type
+  // Comment about ANeuralNetworksOperandType in NeuralNetworks.h:
+  //  If the input or output is optional and omitted then it need not have a fully specified tensor
+  //  operand type
+  if ((execution == nullptr) || ((buffer == nullptr) && (length != 0)))
+  {
+    return ANEURALNETWORKS_UNEXPECTED_NULL;
+  }
+
+  sink(*execution, index, reinterpret_cast<uint8_t *>(buffer), length);
+
+  return ANEURALNETWORKS_NO_ERROR;
+}
+
+int ANeuralNetworksExecution_startCompute(ANeuralNetworksExecution *execution,
+                                          ANeuralNetworksEvent **event)
+{
+  if ((execution == nullptr) || (event == nullptr))
+  {
+    return ANEURALNETWORKS_UNEXPECTED_NULL;
+  }
+
+  // NOTE std::function requires a copyable callable
+  auto promise = std::make_shared<std::promise<int>>();
+  std::shared_future<int> result = promise->get_future().share();
+
+  *event = new (std::nothrow) ANeuralNetworksEvent{result};
+  if (*event == nullptr)
+  {
+    return ANEURALNETWORKS_OUT_OF_MEMORY;
+  }
+
+  execution->result(result);
+
+  workers().submit([execution, promise] {
+    try
     {
-      object->access(getter);
+      compute(*execution);
+      promise->set_value(ANEURALNETWORKS_NO_ERROR);
     }
-  }
+    catch (...)
+    {
+      promise->set_value(ANEURALNETWORKS_OP_FAILED);
+    }
+  });
 
   return ANEURALNETWORKS_NO_ERROR;
 }
 
-void ANeuralNetworksExecution_free(ANeuralNetworksExecution * /* execution */) {}
+void ANeuralNetworksExecution_free(ANeuralNetworksExecution *execution)
+{
+  if (execution == nullptr)
+  {
+    return;
+  }
+
+  // NOTE Wait for the computation in flight as it still refers to this execution
+  if (execution->result().valid())
+  {
+    execution->result().wait();
+  }
+
+  delete execution;
+}
 
 int ANeuralNetworksExecution_setInputFromMemory(ANeuralNetworksExecution *execution,
-                                                int32_t /* index */,
+                                                int32_t index,
                                                 const ANeuralNetworksOperandType * /* type */,
-                                                const ANeuralNetworksMemory *memory,
-                                                size_t /* offset */, size_t /* length */)
+                                                const ANeuralNetworksMemory *memory, size_t offset,
+                                                size_t length)
 {
   if ((execution == nullptr) || (memory == nullptr))
   {
     return ANEURALNETWORKS_UNEXPECTED_NULL;
   }
 
-  // NYI
+  // NOTE 'offset + length' may overflow
+  if ((offset > memory->size()) || (length > memory->size() - offset))
+  {
+    return ANEURALNETWORKS_BAD_DATA;
+  }
+
+  // NOTE The mapped region is read in place (no copy to an intermediate buffer)
+  source(*execution, index, memory->base() + offset, length);
+
   return ANEURALNETWORKS_NO_ERROR;
 }
 
 int ANeuralNetworksExecution_setOutputFromMemory(ANeuralNetworksExecution *execution,
-                                                 int32_t /* index */,
+                                                 int32_t index,
                                                  const ANeuralNetworksOperandType * /* type */,
-                                                 const ANeuralNetworksMemory *memory,
-                                                 size_t /* offset */, size_t /* length */)
+                                                 const ANeuralNetworksMemory *memory, size_t offset,
+                                                 size_t length)
 {
   if ((execution == nullptr) || (memory == nullptr))
   {
     return ANEURALNETWORKS_UNEXPECTED_NULL;
   }
 
-  // NYI
+  // NOTE 'offset + length' may overflow
+  if ((offset > memory->size()) || (length > memory->size() - offset))
+  {
+    return ANEURALNETWORKS_BAD_DATA;
+  }
+
+  // NOTE Results are written in place, which a memory mapped without PROT_WRITE does not allow
+  if (!memory->writable())
+  {
+    return ANEURALNETWORKS_BAD_DATA;
+  }
+
+  // NOTE ANeuralNetworksMemory_createFromFd maps a writable memory with MAP_SHARED (if its fd
+  //      allows), so results written in place are visible to other processes sharing the fd
+  auto base = const_cast<uint8_t *>(memory->base());
+
+  sink(*execution, index, base + offset, length);
+
+  return ANEURALNETWORKS_NO_ERROR;
+}
+
+int ANeuralNetworksProfiler_startEx(void)
+{
+  neurun::exec::Profiler::get().start();
+
+  return ANEURALNETWORKS_NO_ERROR;
+}
+
+int ANeuralNetworksProfiler_stopEx(const char *path)
+{
+  if (path == nullptr)
+  {
+    return ANEURALNETWORKS_UNEXPECTED_NULL;
+  }
+
+  if (!neurun::exec::Profiler::get().stop(path))
+  {
+    return ANEURALNETWORKS_BAD_DATA;
+  }
+
   return ANEURALNETWORKS_NO_ERROR;
 }
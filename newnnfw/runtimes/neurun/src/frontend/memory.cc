@@ -37,6 +37,10 @@ int ANeuralNetworksMemory_createFromFd(size_t size, int protect, int fd, size_t
   {
     return ANEURALNETWORKS_OUT_OF_MEMORY;
   }
+  if (memory_ptr->base() == nullptr)
+  {
+    return ANEURALNETWORKS_BAD_DATA;
+  }
   *memory = memory_ptr.release();
 
   return ANEURALNETWORKS_NO_ERROR;
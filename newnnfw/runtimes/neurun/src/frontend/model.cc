@@ -29,6 +29,7 @@
 #include "graph/operation/AvgPool2D.h"
 #include "graph/operation/Concat.h"
 #include "graph/operation/Conv2D.h"
+#include "graph/operation/DepthwiseConv2D.h"
 #include "graph/operation/FullyConnected.h"
 #include "graph/operation/MaxPool2D.h"
 #include "graph/operation/Reshape.h"
@@ -182,7 +183,9 @@ int ANeuralNetworksModel_setOperandValueFromMemory(ANeuralNetworksModel *model,
   }
 
   auto &obj = model->deref().operands().at(ind);
-  if ((obj.operandSize() != length) || (memory->size() < (offset + length)))
+  // NOTE 'offset + length' may overflow
+  if ((obj.operandSize() != length) || (offset > memory->size()) ||
+      (length > memory->size() - offset))
   {
     return ANEURALNETWORKS_BAD_DATA;
   }
@@ -254,6 +257,27 @@ int ANeuralNetworksModel_addOperation(ANeuralNetworksModel *model,
 
       break;
     }
+    case ANEURALNETWORKS_DEPTHWISE_CONV_2D:
+    {
+      // inputCount is either 8 or 11 acccording to NN API specification.
+      //  - Padding is implicit when inputCount is 8
+      //  - Padding is explicit when inputCount is 11
+      assert(inputCount == 8 || inputCount == 11);
+      assert(outputCount == 1);
+
+      if (inputCount == 8)
+      {
+        using GraphNode = neurun::graph::operation::DepthwiseConv2D::Implicit::Node;
+
+        graph.addOperation(nnfw::make_unique<GraphNode>(node_param));
+      }
+      else
+      {
+        throw std::runtime_error{"Explicit padding in DepthwiseConv2D is not supported, yet"};
+      }
+
+      break;
+    }
     case ANEURALNETWORKS_MAX_POOL_2D:
     {
       // inputCount is either 7 or 10 acccording to NN API specification.
@@ -39,28 +39,72 @@
 #include "codegen/IPlanBuilder.h"
 #include "codegen/Planner.h"
 #include "codegen/PlanBuilder.h"
+#include "codegen/PlanCache.h"
+
+#include "exec/DataflowExecutor.h"
 
 #include "linear/Linear.h"
 
+#include "util/profiling/PhaseReport.h"
+
+#include <sstream>
+
 int ANeuralNetworksCompilation::finish()
 {
   auto &plan = this->plan();
   const auto &operands = plan.model().operands();
 
-  plan.model().lower();
-  auto linear = plan.model().linearize();
+  // Kernels are chosen for the profile of the plan
+  neurun::exec::SchedulingProfile::Scope scope{plan.profile()};
+
+  VERBOSE(Compilation) << "Use " << plan.profile().name() << " profile (threads: "
+                       << plan.profile().threads() << ")" << std::endl;
+
+  using nnfw::util::profiling::ScopedPhase;
+
+  auto report = &plan.model().report();
+
+  // NOTE A cached plan of the same model lets lowering and weight conversion be skipped
+  neurun::codegen::PlanCache cache{plan.model()};
+  {
+    ScopedPhase phase{report, "loadCache"};
+    cache.load();
+  }
+
+  plan.model().lower(cache.backends());
+  auto linear = plan.model().linearize(cache.order());
 
   // Dump ops
   linear->accept(neurun::graph::dumper::Dumper{});
 
   neurun::codegen::PlanBuilder plan_builder{plan};
 
-  auto tensor_builders = linear->markTensors();
+  neurun::backend::TensorBuilderSet tensor_builders;
+
+  {
+    ScopedPhase phase{report, "markTensors"};
+    // NOTE Lifetimes are computed over the linear order, which the dataflow executor does not
+    //      follow
+    tensor_builders = linear->markTensors(!neurun::exec::DataflowExecutor::enabled());
+  }
 
-  linear->accept(neurun::codegen::Planner{operands, plan_builder});
+  {
+    ScopedPhase phase{report, "planner"};
+    linear->accept(neurun::codegen::Planner{operands, plan_builder});
+  }
 
   // TODO Add optimization passes
-  plan_builder.finalize(tensor_builders);
+  plan_builder.finalize(tensor_builders, cache);
+
+  {
+    ScopedPhase phase{report, "saveCache"};
+    cache.record(plan.model(), *linear);
+    cache.save();
+  }
+
+  std::stringstream ss;
+  report->report(ss);
+  VERBOSE(Compilation) << "Time and memory of each phase:" << std::endl << ss.str();
 
   return ANEURALNETWORKS_NO_ERROR;
 }
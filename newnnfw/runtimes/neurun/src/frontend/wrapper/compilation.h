@@ -32,6 +32,13 @@ public:
 public:
   neurun::codegen::Plan &plan(void) { return *_plan; }
 
+public:
+  // NOTE This should be called before 'finish' as the profile also decides kernels
+  void preference(neurun::exec::SchedulingProfile::Preference preference)
+  {
+    _plan->profile(neurun::exec::SchedulingProfile::get(preference));
+  }
+
 public:
   void publish(std::shared_ptr<const neurun::codegen::Plan> &plan) { plan = _plan; }
   int finish();
@@ -17,8 +17,22 @@
 #ifndef __EVENT_H__
 #define __EVENT_H__
 
+#include <future>
+
 struct ANeuralNetworksEvent
 {
+public:
+  ANeuralNetworksEvent(const std::shared_future<int> &result) : _result{result}
+  {
+    // DO NOTHING
+  }
+
+public:
+  // Blocks until the computation finishes, and returns its result code
+  int wait(void) const { return _result.get(); }
+
+private:
+  std::shared_future<int> _result;
 };
 
 #endif
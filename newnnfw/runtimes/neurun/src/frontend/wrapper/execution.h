@@ -17,6 +17,8 @@
 #ifndef __EXECUTION_H__
 #define __EXECUTION_H__
 
+#include <future>
+
 #include "codegen/Plan.h"
 #include "exec/Source.h"
 #include "exec/Sink.h"
@@ -61,6 +63,14 @@ public:
 public:
   const neurun::exec::Sink &sink(int n) const { return *(_sinks.at(n)); }
 
+public:
+  // Result of the last computation (which may still be in flight)
+  void result(const std::shared_future<int> &result) { _result = result; }
+  const std::shared_future<int> &result(void) const { return _result; }
+
+private:
+  std::shared_future<int> _result;
+
 private:
   std::vector<std::unique_ptr<neurun::exec::Source>> _sources;
   std::vector<std::unique_ptr<neurun::exec::Sink>> _sinks;
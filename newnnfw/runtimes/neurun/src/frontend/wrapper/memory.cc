@@ -23,9 +23,33 @@
 // ANeuralNetworksMemory
 //
 ANeuralNetworksMemory::ANeuralNetworksMemory(size_t size, int protect, int fd, size_t offset)
+    : _protect{protect}
 {
-  _base = reinterpret_cast<uint8_t *>(mmap(nullptr, size, protect, MAP_PRIVATE, fd, offset));
+  void *base = MAP_FAILED;
+
+  // NOTE A writable memory is shared so that outputs written in place are visible to the other
+  //      processes sharing the same fd. A read-only memory (e.g. operand values) is still mapped
+  //      privately, as are memories whose fd does not allow a shared writable mapping.
+  if (writable())
+  {
+    base = mmap(nullptr, size, protect, MAP_SHARED, fd, offset);
+  }
+
+  if (base == MAP_FAILED)
+  {
+    base = mmap(nullptr, size, protect, MAP_PRIVATE, fd, offset);
+  }
+
+  _base = (base == MAP_FAILED) ? nullptr : reinterpret_cast<uint8_t *>(base);
   _size = size;
 }
 
-ANeuralNetworksMemory::~ANeuralNetworksMemory() { munmap(reinterpret_cast<void *>(_base), _size); }
+bool ANeuralNetworksMemory::writable(void) const { return (_protect & PROT_WRITE) != 0; }
+
+ANeuralNetworksMemory::~ANeuralNetworksMemory()
+{
+  if (_base != nullptr)
+  {
+    munmap(reinterpret_cast<void *>(_base), _size);
+  }
+}
@@ -27,11 +27,15 @@ public:
 
 public:
   size_t size(void) const { return _size; }
+  // Whether the memory is mapped with PROT_WRITE, that is, whether outputs may be written on it
+  bool writable(void) const;
+  // NOTE This is nullptr if the memory is not mapped
   uint8_t *base(void) { return _base; }
   const uint8_t *base(void) const { return _base; }
 
 private:
   size_t _size;
+  int _protect;
   uint8_t *_base;
 };
 
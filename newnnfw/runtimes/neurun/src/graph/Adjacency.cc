@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "Adjacency.h"
+
+#include <limits>
+
+namespace neurun
+{
+namespace graph
+{
+
+Adjacency::Adjacency(const operation::Set &operations, const operand::Set &operands)
+{
+  // Operations that use each operand, in Compressed Sparse Row form as well
+  //
+  // NOTE These come from operation inputs rather than operand use-def so that this works for a
+  //      graph whose use-def is not initialized yet
+  std::vector<uint32_t> use_offsets(operands.size() + 1, 0);
+  std::vector<uint32_t> uses;
+
+  operations.iterate([&](const operation::Index &, const operation::Node &node) {
+    for (const auto &input : node.getInputs())
+    {
+      use_offsets.at(input.value() + 1) += 1;
+    }
+  });
+
+  for (uint32_t n = 0; n < operands.size(); ++n)
+  {
+    use_offsets[n + 1] += use_offsets[n];
+  }
+
+  {
+    std::vector<uint32_t> positions(use_offsets.begin(), use_offsets.end() - 1);
+    uses.resize(use_offsets.back());
+
+    operations.iterate([&](const operation::Index &index, const operation::Node &node) {
+      for (const auto &input : node.getInputs())
+      {
+        uses[positions[input.value()]++] = index.value();
+      }
+    });
+  }
+
+  // Operation that has added each operation as its successor last, to skip duplicates
+  std::vector<uint32_t> added_by(operations.size(), std::numeric_limits<uint32_t>::max());
+
+  _offsets.reserve(operations.size() + 1);
+  _offsets.emplace_back(0);
+
+  operations.iterate([&](const operation::Index &index, const operation::Node &node) {
+    for (const auto &output : node.getOutputs())
+    {
+      for (auto n = use_offsets.at(output.value()); n < use_offsets.at(output.value() + 1); ++n)
+      {
+        const auto use = uses[n];
+        if (added_by[use] != index.value())
+        {
+          added_by[use] = index.value();
+          _successors.emplace_back(use);
+        }
+      }
+    }
+
+    _offsets.emplace_back(_successors.size());
+  });
+}
+
+} // namespace graph
+} // namespace neurun
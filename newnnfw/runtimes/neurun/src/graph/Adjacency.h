@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef __NEURUN_GRAPH_ADJACENCY_H__
+#define __NEURUN_GRAPH_ADJACENCY_H__
+
+#include <vector>
+
+#include "graph/operation/Index.h"
+#include "graph/operation/Set.h"
+#include "graph/operand/Set.h"
+
+namespace neurun
+{
+namespace graph
+{
+
+// Operations that use outputs of each operation, in Compressed Sparse Row form
+//
+// NOTE This is a snapshot of the graph. Build it again after the graph changes.
+class Adjacency
+{
+public:
+  using Iterator = std::vector<operation::Index>::const_iterator;
+
+public:
+  Adjacency() = default;
+  Adjacency(const operation::Set &operations, const operand::Set &operands);
+
+public:
+  // Number of operations when this was built
+  uint32_t size() const { return _offsets.empty() ? 0 : _offsets.size() - 1; }
+  // Successors of 'index' without duplicates, in the order of its outputs and their users
+  Iterator begin(const operation::Index &index) const
+  {
+    return _successors.begin() + _offsets.at(index.value());
+  }
+  Iterator end(const operation::Index &index) const
+  {
+    return _successors.begin() + _offsets.at(index.value() + 1);
+  }
+
+private:
+  std::vector<uint32_t> _offsets;
+  std::vector<operation::Index> _successors;
+};
+
+} // namespace graph
+} // namespace neurun
+
+#endif // __NEURUN_GRAPH_ADJACENCY_H__
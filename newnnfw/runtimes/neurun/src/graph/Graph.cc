@@ -27,6 +27,8 @@
 #include "operand/LowerInfo.h"
 #include "operand/Shape4DConvert.h"
 #include "codegen/BackendResolver.h"
+#include "pass/ConstantFoldingPass.h"
+#include "pass/LayoutPropagationPass.h"
 #include "backend/IBackendConfig.h"
 
 namespace neurun
@@ -91,6 +93,9 @@ operation::Index Graph::insertOperation(const operand::Index &prev_operand_index
 
   operation::Index node_index = _operations.append(std::move(node));
 
+  // The adjacency does not know the new operation
+  _adjacency = Adjacency{};
+
   // Update Use/Def info
   {
     _operands.at(prev_operand_index).removeUse(next_operation_index);
@@ -114,6 +119,32 @@ void Graph::setOperandValue(const operand::Index &ind, std::unique_ptr<operand::
   _operands.at(ind).data(std::move(data));
 }
 
+void Graph::removeOperations(
+    const std::function<bool(const operation::Index &, const operation::Node &)> &pred)
+{
+  assert(_phase == Phase::MODEL);
+
+  _operations.removeIf(pred);
+
+  // Use-def has the old indexes
+  _operands.iterate([&](const operand::Index &, operand::Object &object) {
+    const auto uses = object.getUses();
+    const auto defs = object.getDef();
+
+    for (const auto &use : uses.list())
+    {
+      object.removeUse(use);
+    }
+    for (const auto &def : defs.list())
+    {
+      object.removeDef(def);
+    }
+  });
+
+  initializeUseDef();
+  _adjacency = Adjacency{_operations, _operands};
+}
+
 void Graph::addInput(const operand::Index &ind)
 {
   assert(_phase == Phase::BUILDING);
@@ -131,22 +162,108 @@ void Graph::finishBuilding(void)
   assert(_phase == Phase::BUILDING);
   _phase = Phase::MODEL;
 
+  using nnfw::util::profiling::ScopedPhase;
+
+  ScopedPhase phase{&_report, "finishBuilding"};
+
   // Initialize operand use-def
   initializeUseDef();
+  _adjacency = Adjacency{_operations, _operands};
 
   // Call graph verifications for the MODEL phase
   {
+    ScopedPhase verify_phase{&_report, "finishBuilding/verify"};
     verifier::DAGChecker dag_checker;
     dag_checker.verify(*this);
   }
+
+  // Evaluate operations on constants once here rather than on every inference
+  {
+    ScopedPhase folding_phase{&_report, "finishBuilding/constantFolding"};
+    pass::ConstantFoldingPass folding_pass{*this};
+    folding_pass.run();
+  }
+}
+
+bool Graph::setBatchSize(uint32_t batch)
+{
+  assert(_phase == Phase::MODEL);
+  assert(batch > 0);
+
+  // NOTE Feature maps and vectors (including their batches) are the only operands computed at
+  //      runtime in this runtime, and weights/biases/parameters are all constants
+  auto batched = [](const operand::Object &object) {
+    return !object.isConstant() && (object.shape().rank() == 2 || object.shape().rank() == 4);
+  };
+
+  int32_t current = -1;
+  bool consistent = true;
+
+  _operands.iterate([&](const operand::Index &, const operand::Object &object) {
+    if (!object.usageIsDefined())
+    {
+      // Not used by any operation
+      return;
+    }
+
+    if (!batched(object))
+    {
+      consistent = consistent && object.isConstant();
+      return;
+    }
+
+    if (current == -1)
+    {
+      current = object.shape().dim(0);
+    }
+
+    consistent = consistent && (object.shape().dim(0) == current);
+  });
+
+  if (!consistent)
+  {
+    return false;
+  }
+
+  _operands.iterate([&](const operand::Index &, operand::Object &object) {
+    if (object.usageIsDefined() && batched(object))
+    {
+      object.batch(static_cast<int32_t>(batch));
+    }
+  });
+
+  return true;
 }
 
-void Graph::lower(void)
+void Graph::lower(const std::unordered_map<operation::Index, std::string> &backends)
 {
   assert(_phase == Phase::MODEL);
 
+  using nnfw::util::profiling::ScopedPhase;
+
+  ScopedPhase phase{&_report, "lower"};
+
   // Lower
   {
+    auto _backend_resolver = codegen::BackendResolver(*this, backends);
+
+    // Operation LowerInfo
+    _operations.iterate([&](const operation::Index &index, operation::Node &node) {
+      auto backend = _backend_resolver.getBackend(index, node);
+      node.lower_info(nnfw::make_unique<operation::LowerInfo>(backend));
+    });
+
+    // Insert Permutes where operands move across backends
+    //
+    // NOTE Permutes are run by the cpu backend as it may access the tensors of any backend
+    // TODO Do not use magic string for backend id
+    {
+      pass::LayoutPropagationPass layout_pass{*this, _backend_resolver.getBackend("cpu")};
+      layout_pass.run();
+    }
+
+    _adjacency = Adjacency{_operations, _operands};
+
     // operand::LowerInfo holder
     std::unordered_map<operand::Index, std::unique_ptr<operand::LowerInfo>> operands_lower_info;
 
@@ -155,24 +272,19 @@ void Graph::lower(void)
           nnfw::make_unique<operand::LowerInfo>(operand::asShape4D(object.shape()));
     });
 
-    auto _backend_resolver = codegen::BackendResolver(_operands);
-
-    _operations.iterate([&](const operation::Index &, operation::Node &node) {
-      auto backend = _backend_resolver.getBackend(typeid(node));
-
-      // Operation LowerInfo
-      node.lower_info(nnfw::make_unique<operation::LowerInfo>(backend));
+    _operations.iterate([&](const operation::Index &, const operation::Node &node) {
+      const auto &lower_info = *node.lower_info();
 
       // LowerInfo for in/output operands
       for (auto operand : node.getInputs())
       {
-        auto &&lower_info = operands_lower_info.at(operand);
-        lower_info->addUseLayout(backend.config()->getOperandLayout());
+        auto &&operand_lower_info = operands_lower_info.at(operand);
+        operand_lower_info->addUseLayout(lower_info.input_backend().config()->getOperandLayout());
       }
       for (auto operand : node.getOutputs())
       {
-        auto &&lower_info = operands_lower_info.at(operand);
-        lower_info->addDefLayout(backend.config()->getOperandLayout());
+        auto &&operand_lower_info = operands_lower_info.at(operand);
+        operand_lower_info->addDefLayout(lower_info.output_backend().config()->getOperandLayout());
       }
     });
 
@@ -213,6 +325,7 @@ void Graph::lower(void)
 
   // Graph verifications for the LOWERED phase
   {
+    ScopedPhase verify_phase{&_report, "lower/verify"};
     verifier::DAGChecker dag_checker;
     dag_checker.verify(*this);
   }
@@ -220,11 +333,13 @@ void Graph::lower(void)
   _phase = Phase::LOWERED;
 }
 
-std::unique_ptr<linear::Linear> Graph::linearize(void)
+std::unique_ptr<linear::Linear> Graph::linearize(const std::vector<operation::Index> &order)
 {
   assert(_phase == Phase::LOWERED);
 
-  auto linear = nnfw::make_unique<linear::Linear>(*this);
+  nnfw::util::profiling::ScopedPhase phase{&_report, "linearize"};
+
+  auto linear = nnfw::make_unique<linear::Linear>(*this, order);
 
   // TODO Move the operations and operands to linear object
 
@@ -285,27 +400,40 @@ void Graph::PostDfsIterator<is_const>::iterate(GraphRef graph, const IterFn &fn)
 {
   assert(!graph.isBuildingPhase()); // Restrict iteration condition
 
+  const auto &adjacency = graph._adjacency;
+  assert(adjacency.size() == graph._operations.size()); // Operations are not inserted since
+
   std::vector<bool> visited(graph._operations.size(), false);
 
-  std::function<void(const operation::Index &, NodeRef)> dfs_recursive =
-      [&](const operation::Index &index, NodeRef node) -> void {
-    if (visited[index.asInt()])
+  // NOTE DFS is done with an explicit stack not to overflow the call stack with deep graphs.
+  //      Each entry has an operation being visited and its next successor to visit.
+  std::vector<std::pair<operation::Index, Adjacency::Iterator>> stack;
+
+  graph._operations.iterate([&](const operation::Index &index, NodeRef) -> void {
+    if (visited[index.value()])
       return;
-    visited[index.asInt()] = true;
+    visited[index.value()] = true;
+    stack.emplace_back(index, adjacency.begin(index));
 
-    for (auto output : node.getOutputs())
+    while (!stack.empty())
     {
-      const auto &operand = graph._operands.at(output);
-      for (const auto &use : operand.getUses().list())
+      auto &top = stack.back();
+
+      if (top.second == adjacency.end(top.first))
       {
-        dfs_recursive(use, graph._operations.at(use));
+        fn(graph._operations.at(top.first));
+        stack.pop_back();
+        continue;
       }
-    }
-
-    fn(node);
-  };
 
-  graph._operations.iterate(dfs_recursive);
+      const auto use = *(top.second++);
+      if (!visited[use.value()])
+      {
+        visited[use.value()] = true;
+        stack.emplace_back(use, adjacency.begin(use));
+      }
+    }
+  });
 
   // All of the operations(nodes) must have been visited.
   assert(std::all_of(visited.begin(), visited.end(), [](bool v) { return v; }));
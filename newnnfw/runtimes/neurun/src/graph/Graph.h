@@ -18,11 +18,16 @@
 #define __NEURUN_GRAPH_GRAPH_H__
 
 #include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
+#include "graph/Adjacency.h"
 #include "graph/operation/Node.h"
 #include "graph/operation/Set.h"
 #include "graph/operand/IndexSet.h"
 #include "graph/operand/Set.h"
+#include "util/profiling/PhaseReport.h"
 
 namespace neurun
 {
@@ -97,12 +102,20 @@ public:
                                    const operation::Index &next_operation_index,
                                    std::unique_ptr<operation::Node> &&node);
   void setOperandValue(const operand::Index &ind, std::unique_ptr<operand::Data> &&data);
+  // NOTE This renumbers the remaining operations, so it is allowed only before lowering
+  void removeOperations(
+      const std::function<bool(const operation::Index &, const operation::Node &)> &pred);
   void addInput(const operand::Index &ind);
   void addOutput(const operand::Index &ind);
   void finishBuilding(void);
-  void lower(void);
-  std::unique_ptr<linear::Linear> linearize(void);
+  // NOTE 'backends' and 'order' may give the result of a previous compilation (e.g. a cached plan)
+  void lower(const std::unordered_map<operation::Index, std::string> &backends = {});
+  std::unique_ptr<linear::Linear> linearize(const std::vector<operation::Index> &order = {});
+  // NOTE This makes every operand computed at runtime have 'batch' as its first dimension, and
+  //      returns false (with no change) if any of them has no batch of the same size
+  bool setBatchSize(uint32_t batch);
   bool isBuildingPhase(void) const { return _phase == Phase::BUILDING; }
+  bool isModelPhase(void) const { return _phase == Phase::MODEL; }
 
 private:
   void initializeUseDef();
@@ -114,6 +127,10 @@ public:
   const operand::Set &operands() const { return _operands; }
   operand::Set &operands() { return _operands; } // TODO Remove this non-const accessor
   const operation::Set &operations() const { return _operations; }
+  operation::Set &operations() { return _operations; } // TODO Remove this non-const accessor
+  // Time and memory of each phase that has built, lowered and compiled this graph
+  const nnfw::util::profiling::PhaseReport &report() const { return _report; }
+  nnfw::util::profiling::PhaseReport &report() { return _report; }
 
 private:
   Phase _phase{Phase::BUILDING};
@@ -121,6 +138,9 @@ private:
   operand::Set _operands;
   operand::IndexSet _inputs;
   operand::IndexSet _outputs;
+  // NOTE This is built at 'finishBuilding' and 'lower' and is used to traverse operations
+  Adjacency _adjacency;
+  nnfw::util::profiling::PhaseReport _report;
 };
 
 } // namespace graph
@@ -73,6 +73,24 @@ bool Object::setUsage(const OperandUsage usage)
   return true;
 }
 
+void Object::foldIntoConstant(std::unique_ptr<Data> &&data)
+{
+  assert(_usage == OperandUsage::OPERATION_OUTPUT);
+  assert(data != nullptr && data->size() == operandSize());
+
+  _usage = OperandUsage::CONSTANT;
+  _data = std::move(data);
+}
+
+void Object::batch(int32_t size)
+{
+  assert(_usage != OperandUsage::CONSTANT);
+  assert(_shape.rank() > 0);
+  assert(size > 0);
+
+  _shape.dim(0) = size;
+}
+
 void Object::appendUse(const ::neurun::graph::operation::Index &idx)
 {
   assert(_usage != OperandUsage::NOT_DEFINED);
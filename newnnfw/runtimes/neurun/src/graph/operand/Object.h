@@ -62,6 +62,12 @@ public:
   bool setAsOperationOutput() { return setUsage(OperandUsage::OPERATION_OUTPUT); }
   bool usageIsDefined(void) const { return _usage != OperandUsage::NOT_DEFINED; }
   bool isModelInput(void) const { return _usage == OperandUsage::MODEL_INPUT; }
+  bool isConstant(void) const { return _usage == OperandUsage::CONSTANT; }
+  // NOTE An operation output turns into a constant when its operation is folded at compile time
+  void foldIntoConstant(std::unique_ptr<Data> &&data);
+  // NOTE The first dimension of an operand computed at runtime is its batch, and it is the only
+  //      dimension which may change once the operand is added
+  void batch(int32_t size);
 
   const operation::IndexList &getUses() const { return _uses; }
   const operation::IndexList &getDef() const { return _def; }
@@ -76,6 +82,7 @@ private:
 public:
   void data(std::unique_ptr<Data> &&data) { _data = std::move(data); }
   const Data &data(void) const { return *_data; }
+  bool hasData(void) const { return _data != nullptr; }
 
 public:
   template <typename T, typename... Args> void data(Args &&... args)
@@ -98,7 +105,7 @@ public:
   const LowerInfo *lower_info() const;
 
 private:
-  const Shape _shape;
+  Shape _shape;
   const TypeInfo _type;
   std::unique_ptr<Data> _data;
   OperandUsage _usage;
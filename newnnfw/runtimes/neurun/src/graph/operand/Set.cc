@@ -27,39 +27,39 @@ namespace operand
 
 const Index Set::generateIndex()
 {
-  assert((_index_count) <= 0x7fffffff);
+  assert(_objects.size() <= 0x7fffffff);
 
-  return Index{_index_count++};
+  return Index{static_cast<uint32_t>(_objects.size())};
 }
 
 Index Set::append(const Shape &shape, const TypeInfo &type)
 {
   auto index = generateIndex();
 
-  _objects[index] = nnfw::make_unique<Object>(shape, type);
+  _objects.emplace_back(nnfw::make_unique<Object>(shape, type));
 
   return index;
 }
 
-const Object &Set::at(const Index &index) const { return *(_objects.at(index)); }
+const Object &Set::at(const Index &index) const { return *(_objects.at(index.value())); }
 
-Object &Set::at(const Index &index) { return *(_objects.at(index)); }
+Object &Set::at(const Index &index) { return *(_objects.at(index.value())); }
 
 bool Set::exist(const Index &index) const { return index.value() < _objects.size(); }
 
 void Set::iterate(const std::function<void(const Index &, const Object &)> &fn) const
 {
-  for (const auto &e : _objects)
+  for (uint32_t n = 0; n < _objects.size(); ++n)
   {
-    fn(e.first, *e.second);
+    fn(Index{n}, *_objects[n]);
   }
 }
 
 void Set::iterate(const std::function<void(const Index &, Object &)> &fn)
 {
-  for (auto &e : _objects)
+  for (uint32_t n = 0; n < _objects.size(); ++n)
   {
-    fn(e.first, *e.second);
+    fn(Index{n}, *_objects[n]);
   }
 }
 
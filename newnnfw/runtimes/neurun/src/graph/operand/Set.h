@@ -17,8 +17,9 @@
 #ifndef __NEURUN_GRAPH_OPERAND_SET_H__
 #define __NEURUN_GRAPH_OPERAND_SET_H__
 
+#include <functional>
 #include <memory>
-#include <unordered_map>
+#include <vector>
 
 #include "Object.h"
 #include "Index.h"
@@ -33,7 +34,7 @@ namespace operand
 class Set
 {
 public:
-  Set() : _index_count(0) {}
+  Set() = default;
 
 public:
   Index append(const Shape &, const TypeInfo &);
@@ -42,6 +43,7 @@ public:
   const Object &at(const Index &) const;
   Object &at(const Index &);
   bool exist(const Index &) const;
+  uint32_t size() const { return _objects.size(); }
   void iterate(const std::function<void(const Index &, const Object &)> &fn) const;
   void iterate(const std::function<void(const Index &, Object &)> &fn);
 
@@ -49,8 +51,8 @@ private:
   const Index generateIndex();
 
 private:
-  std::unordered_map<Index, std::unique_ptr<Object>> _objects;
-  uint32_t _index_count;
+  // NOTE Indexes are given in sequence, so an index is the position of its object
+  std::vector<std::unique_ptr<Object>> _objects;
 };
 
 } // namespace operand
@@ -23,7 +23,15 @@ namespace graph
 namespace operation
 {
 
-LowerInfo::LowerInfo(const backend::Backend &backend) : _backend(backend)
+LowerInfo::LowerInfo(const backend::Backend &backend)
+    : _backend(backend), _input_backend(backend), _output_backend(backend)
+{
+  // DO NOTHING
+}
+
+LowerInfo::LowerInfo(const backend::Backend &backend, const backend::Backend &input_backend,
+                     const backend::Backend &output_backend)
+    : _backend(backend), _input_backend(input_backend), _output_backend(output_backend)
 {
   // DO NOTHING
 }
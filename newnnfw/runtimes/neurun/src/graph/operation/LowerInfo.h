@@ -32,10 +32,19 @@ class LowerInfo
 {
 public:
   LowerInfo(const backend::Backend &backend);
+  // NOTE An operation that moves operands across backends (e.g. Permute) reads and writes the
+  //      tensors of other backends than the one that runs it
+  LowerInfo(const backend::Backend &backend, const backend::Backend &input_backend,
+            const backend::Backend &output_backend);
   const backend::Backend &backend() const { return _backend; }
+  // Backends that hold the tensors of inputs and outputs
+  const backend::Backend &input_backend() const { return _input_backend; }
+  const backend::Backend &output_backend() const { return _output_backend; }
 
 private:
   backend::Backend _backend;
+  backend::Backend _input_backend;
+  backend::Backend _output_backend;
 };
 
 } // namespace operation
@@ -13,10 +13,29 @@ namespace operation
 namespace Permute
 {
 
+Type typeOf(const operand::Shape &shape, operand::Layout from, operand::Layout to)
+{
+  // NOTE Only feature maps have different orderings of elements over layouts
+  if ((shape.rank() != 4) || (from == to))
+  {
+    return Type::COPY;
+  }
+
+  if ((from == operand::Layout::NHWC) && (to == operand::Layout::NCHW))
+  {
+    return Type::NHWC_TO_NCHW;
+  }
+
+  assert((from == operand::Layout::NCHW) && (to == operand::Layout::NHWC));
+  return Type::NCHW_TO_NHWC;
+}
+
 void Node::accept(NodeVisitor &&v) const { v.visit(*this); }
 
-Node::Node(const operand::Index &input, const operand::Index &output)
+Node::Node(const operand::Index &input, const operand::Index &output, Type type)
 {
+  _param.type = type;
+
   setInputs({input});
   setOutputs({output});
 }
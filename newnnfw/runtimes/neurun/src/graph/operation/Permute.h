@@ -2,6 +2,8 @@
 #define __NEURUN_GRAPH_OPERATION_PERMUTE_PERMUTE_H__
 
 #include "graph/operation/Node.h"
+#include "graph/operand/Layout.h"
+#include "graph/operand/Shape.h"
 
 namespace neurun
 {
@@ -12,17 +14,38 @@ namespace operation
 namespace Permute
 {
 
+enum class Type
+{
+  NHWC_TO_NCHW,
+  NCHW_TO_NHWC,
+  COPY
+};
+
+// Returns the type of Permute that moves an operand of 'shape' from 'from' layout to 'to' layout
+Type typeOf(const operand::Shape &shape, operand::Layout from, operand::Layout to);
+
+struct Param
+{
+  Type type;
+};
+
 class Node : public graph::operation::Node
 {
 public:
   virtual void accept(NodeVisitor &&) const override;
 
 public:
-  Node(const operand::Index &input, const operand::Index &output);
+  Node(const operand::Index &input, const operand::Index &output, Type type);
 
 public:
   virtual void setInputs(const operand::IndexSet &indexes) override;
   virtual void setOutputs(const operand::IndexSet &indexes) override;
+
+public:
+  const Param &param() const { return _param; }
+
+private:
+  Param _param;
 };
 
 } // namespace Permute
@@ -27,41 +27,56 @@ namespace operation
 
 const Index Set::generateIndex()
 {
-  assert((_index_count) <= 0x7fffffff);
+  assert(_nodes.size() <= 0x7fffffff);
 
-  return Index{_index_count++};
+  return Index{static_cast<uint32_t>(_nodes.size())};
 }
 
 Index Set::append(std::unique_ptr<Node> &&node)
 {
   auto index = generateIndex();
 
-  _nodes[index] = std::move(node);
+  _nodes.emplace_back(std::move(node));
   return index;
 }
 
-const Node &Set::at(const Index &index) const { return *(_nodes.at(index)); }
+const Node &Set::at(const Index &index) const { return *(_nodes.at(index.value())); }
 
-Node &Set::at(const Index &index) { return *(_nodes.at(index)); }
+Node &Set::at(const Index &index) { return *(_nodes.at(index.value())); }
 
-bool Set::exist(const Index &index) const { return _nodes.find(index) != _nodes.end(); }
+bool Set::exist(const Index &index) const { return index.value() < _nodes.size(); }
 
 void Set::iterate(const std::function<void(const Index &, const Node &)> &fn) const
 {
-  for (auto it = _nodes.begin(); it != _nodes.end(); ++it)
+  for (uint32_t n = 0; n < _nodes.size(); ++n)
   {
-    fn(it->first, *it->second);
+    fn(Index{n}, *_nodes[n]);
   }
 }
 
 void Set::iterate(const std::function<void(const Index &, Node &)> &fn)
 {
-  for (auto it = _nodes.begin(); it != _nodes.end(); ++it)
+  for (uint32_t n = 0; n < _nodes.size(); ++n)
   {
-    fn(it->first, *it->second);
+    fn(Index{n}, *_nodes[n]);
   }
 }
 
+void Set::removeIf(const std::function<bool(const Index &, const Node &)> &pred)
+{
+  uint32_t count = 0;
+
+  for (uint32_t n = 0; n < _nodes.size(); ++n)
+  {
+    if (!pred(Index{n}, *_nodes[n]))
+    {
+      _nodes[count++] = std::move(_nodes[n]);
+    }
+  }
+
+  _nodes.resize(count);
+}
+
 } // namespace operation
 } // namespace graph
 } // namespace neurun
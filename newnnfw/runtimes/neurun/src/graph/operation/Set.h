@@ -17,13 +17,13 @@
 #ifndef __NEURUN_GRAPH_OPERATION_SET_H__
 #define __NEURUN_GRAPH_OPERATION_SET_H__
 
+#include <functional>
 #include <memory>
+#include <vector>
 
 #include "graph/operation/Index.h"
 #include "Node.h"
 
-#include <unordered_map>
-
 namespace neurun
 {
 namespace graph
@@ -34,7 +34,7 @@ namespace operation
 class Set
 {
 public:
-  Set() : _index_count(0) {}
+  Set() = default;
 
 public:
   Index append(std::unique_ptr<Node> &&node);
@@ -46,13 +46,15 @@ public:
   uint32_t size() const { return _nodes.size(); }
   void iterate(const std::function<void(const Index &, const Node &)> &fn) const;
   void iterate(const std::function<void(const Index &, Node &)> &fn);
+  // NOTE The remaining nodes are renumbered in order
+  void removeIf(const std::function<bool(const Index &, const Node &)> &pred);
 
 private:
   const Index generateIndex();
 
 private:
-  std::unordered_map<Index, std::unique_ptr<Node>> _nodes;
-  uint32_t _index_count;
+  // NOTE Indexes are given in sequence, so an index is the position of its node
+  std::vector<std::unique_ptr<Node>> _nodes;
 };
 
 } // namespace operation
@@ -0,0 +1,257 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "ConstantFoldingPass.h"
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <arm_compute/runtime/IFunction.h>
+
+#include "graph/Graph.h"
+#include "graph/operation/NodeVisitor.h"
+#include "backend/cpu/operand/Tensor.h"
+#include "kernel/cpu/ConcatLayer.h"
+#include "kernel/cpu/ReshapeLayer.h"
+#include "nnfw/std/memory.h"
+#include "logging.h"
+
+namespace
+{
+
+using namespace neurun::graph;
+
+using Tensors =
+    std::unordered_map<operand::Index, std::unique_ptr<neurun::backend::cpu::operand::Tensor>>;
+
+// Creates a CPU kernel that evaluates an operation on 'tensors'
+//
+// NOTE 'fn' is left empty for an operation that is not supported
+class KernelGenerator final : public operation::NodeVisitor
+{
+public:
+  KernelGenerator(const operand::Set &operands, const Tensors &tensors,
+                  std::unique_ptr<::arm_compute::IFunction> &fn)
+      : _operands(operands), _tensors(tensors), _fn(fn)
+  {
+    // DO NOTHING
+  }
+
+public:
+  void visit(const operation::Conv2D::Implicit::Node &) override {}
+  void visit(const operation::DepthwiseConv2D::Implicit::Node &) override {}
+  void visit(const operation::MaxPool2D::Implicit::Node &) override {}
+  void visit(const operation::AvgPool2D::Implicit::Node &) override {}
+  void visit(const operation::Concat::Node &node) override;
+  void visit(const operation::Reshape::Node &node) override;
+  void visit(const operation::FullyConnected::Node &) override {}
+  void visit(const operation::Softmax::Node &) override {}
+  void visit(const operation::NOP::Node &) override {}
+  void visit(const operation::Permute::Node &) override {}
+
+private:
+  const operand::Set &_operands;
+  const Tensors &_tensors;
+  std::unique_ptr<::arm_compute::IFunction> &_fn;
+};
+
+void KernelGenerator::visit(const operation::Concat::Node &node)
+{
+  const auto &ofm = _operands.at(node.getOutputs().at(0));
+  const auto axis = _operands.at(operand::Index{node.param().axis_index}).asScalar<int32_t>();
+
+  const auto type = ofm.typeInfo().type();
+  if ((type != operand::DataType::TENSOR_FLOAT32) &&
+      (type != operand::DataType::TENSOR_QUANT8_ASYMM))
+  {
+    return;
+  }
+
+  std::vector<const ::arm_compute::ITensor *> inputs;
+  std::vector<neurun::kernel::cpu::Shape> input_shapes;
+
+  for (const auto &ind : node.getInputs())
+  {
+    const auto &ifm = _operands.at(ind);
+
+    // NOTE The kernel copies elements as they are
+    if ((ifm.typeInfo().type() != type) || (ifm.typeInfo().scale() != ofm.typeInfo().scale()) ||
+        (ifm.typeInfo().offset() != ofm.typeInfo().offset()))
+    {
+      return;
+    }
+
+    inputs.emplace_back(_tensors.at(ind).get());
+    input_shapes.emplace_back(neurun::kernel::cpu::getShape(ifm));
+  }
+
+  auto fn = nnfw::make_unique<neurun::kernel::cpu::ConcatLayer>();
+
+  fn->configure(inputs, input_shapes, axis, _tensors.at(node.getOutputs().at(0)).get(),
+                neurun::kernel::cpu::getShape(ofm));
+
+  _fn = std::move(fn);
+}
+
+void KernelGenerator::visit(const operation::Reshape::Node &node)
+{
+  const auto &input_index = node.getInputs().at(0);
+  const auto &output_index = node.getOutputs().at(0);
+
+  auto fn = nnfw::make_unique<neurun::kernel::cpu::ReshapeLayer>();
+
+  fn->configure(_tensors.at(input_index).get(),
+                neurun::kernel::cpu::getShape(_operands.at(input_index)),
+                _tensors.at(output_index).get(),
+                neurun::kernel::cpu::getShape(_operands.at(output_index)));
+
+  _fn = std::move(fn);
+}
+
+} // namespace
+
+namespace neurun
+{
+namespace graph
+{
+namespace pass
+{
+
+void ConstantFoldingPass::run()
+{
+  const auto &operands = _graph.operands();
+  const auto &operations = _graph.operations();
+
+  // Operations that may be foldable. An operation is visited again whenever one of its inputs is
+  // folded as it may become foldable.
+  std::vector<operation::Index> worklist;
+
+  operations.iterate([&](const operation::Index &index, const operation::Node &) {
+    worklist.emplace_back(index);
+  });
+
+  std::unordered_set<operation::Index> folded;
+  size_t bytes = 0;
+
+  while (!worklist.empty())
+  {
+    const auto index = worklist.back();
+    worklist.pop_back();
+
+    const auto &node = operations.at(index);
+
+    if ((folded.count(index) > 0) || !foldable(node) || !fold(node))
+    {
+      continue;
+    }
+
+    VERBOSE(ConstantFoldingPass) << "Fold operation #" << index.value() << std::endl;
+
+    folded.insert(index);
+
+    for (const auto &output : node.getOutputs())
+    {
+      bytes += operands.at(output).operandSize();
+
+      for (const auto &use : operands.at(output).getUses().list())
+      {
+        worklist.emplace_back(use);
+      }
+    }
+  }
+
+  VERBOSE(ConstantFoldingPass) << "Folded " << folded.size() << " operations into " << bytes
+                               << " bytes of constants" << std::endl;
+
+  if (!folded.empty())
+  {
+    _graph.removeOperations([&](const operation::Index &index, const operation::Node &) {
+      return folded.count(index) > 0;
+    });
+  }
+}
+
+bool ConstantFoldingPass::foldable(const operation::Node &node) const
+{
+  const auto &operands = _graph.operands();
+
+  for (const auto &input : node.getInputs())
+  {
+    const auto &object = operands.at(input);
+    if (!object.isConstant() || !object.hasData())
+    {
+      return false;
+    }
+  }
+
+  // NOTE Model outputs are left to be computed as they are read from tensors after execution
+  for (const auto &output : node.getOutputs())
+  {
+    if (_graph.getOutputs().contains(output))
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool ConstantFoldingPass::fold(const operation::Node &node)
+{
+  auto &operands = _graph.operands();
+
+  Tensors tensors;
+  std::unordered_map<operand::Index, std::vector<uint8_t>> outputs;
+
+  // NOTE Kernels do not write to inputs
+  for (const auto &input : node.getInputs())
+  {
+    auto base = const_cast<uint8_t *>(operands.at(input).data().base());
+    tensors[input] = nnfw::make_unique<backend::cpu::operand::Tensor>(base);
+  }
+
+  for (const auto &output : node.getOutputs())
+  {
+    auto &buffer = outputs[output];
+    buffer.resize(operands.at(output).operandSize());
+    tensors[output] = nnfw::make_unique<backend::cpu::operand::Tensor>(buffer.data());
+  }
+
+  std::unique_ptr<::arm_compute::IFunction> fn;
+  node.accept(KernelGenerator{operands, tensors, fn});
+
+  if (fn == nullptr)
+  {
+    return false;
+  }
+
+  fn->run();
+
+  for (auto &output : outputs)
+  {
+    operands.at(output.first)
+        .foldIntoConstant(
+            nnfw::make_unique<operand::CachedData>(output.second.data(), output.second.size()));
+  }
+
+  return true;
+}
+
+} // namespace pass
+} // namespace graph
+} // namespace neurun
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef __NEURUN_GRAPH_PASS_CONSTANT_FOLDING_PASS_H__
+#define __NEURUN_GRAPH_PASS_CONSTANT_FOLDING_PASS_H__
+
+#include "Pass.h"
+#include "graph/operation/Node.h"
+
+namespace neurun
+{
+namespace graph
+{
+namespace pass
+{
+
+// Evaluates operations whose inputs are all constants once with CPU kernels, turns their outputs
+// into constants and removes them
+//
+// NOTE This runs before lowering, as removing operations renumbers the remaining ones
+class ConstantFoldingPass : public Pass
+{
+public:
+  ConstantFoldingPass(Graph &graph) : Pass{graph}
+  {
+    // DO NOTHING
+  }
+
+public:
+  virtual std::string id() override { return "ConstantFoldingPass"; }
+  virtual void run() override;
+
+private:
+  bool foldable(const operation::Node &node) const;
+  // Returns false if CPU kernels cannot evaluate the operation
+  bool fold(const operation::Node &node);
+};
+
+} // namespace pass
+} // namespace graph
+} // namespace neurun
+
+#endif // __NEURUN_GRAPH_PASS_CONSTANT_FOLDING_PASS_H__
@@ -0,0 +1,421 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "LayoutPropagationPass.h"
+
+#include <algorithm>
+#include <typeinfo>
+#include <unordered_set>
+#include <utility>
+
+#include "backend/IBackendConfig.h"
+#include "graph/Graph.h"
+#include "graph/operation/LowerInfo.h"
+#include "graph/operation/Permute.h"
+#include "graph/operation/Reshape.h"
+#include "nnfw/std/memory.h"
+
+#include "logging.h"
+
+namespace
+{
+
+using namespace neurun;
+
+// NOTE Backends that come from the same BackendManager share their config
+bool equal(const backend::Backend &lhs, const backend::Backend &rhs)
+{
+  return lhs.config() == rhs.config();
+}
+
+// Whether an operation gives the same result regardless of the layout of its operands
+//
+// NOTE Reshape is layout-agnostic in this runtime as it only flattens feature maps whose height
+//      and width are 1 (See Planner), whose elements are in the same order over layouts
+bool isLayoutAgnostic(const graph::operation::Node &node)
+{
+  return typeid(node) == typeid(graph::operation::Reshape::Node);
+}
+
+} // namespace
+
+namespace neurun
+{
+namespace graph
+{
+namespace pass
+{
+
+LayoutPropagationPass::LayoutPropagationPass(Graph &graph,
+                                             const backend::Backend &permute_backend)
+    : Pass{graph}, _permute_backend{permute_backend}
+{
+  // DO NOTHING
+}
+
+size_t LayoutPropagationPass::cost(const operand::Index &index) const
+{
+  const auto &object = _graph.operands().at(index);
+
+  // NOTE Model inputs and constants are given to each backend that uses them
+  if (object.getDef().size() == 0)
+  {
+    return 0;
+  }
+
+  const auto &from = _backends.at(object.getDef().list().front());
+
+  std::vector<backend::Backend> targets;
+  for (const auto &use : object.getUses().list())
+  {
+    const auto &to = _backends.at(use);
+    auto is_same = [&](const backend::Backend &backend) { return equal(backend, to); };
+
+    if (!equal(from, to) && std::none_of(targets.begin(), targets.end(), is_same))
+    {
+      targets.emplace_back(to);
+    }
+  }
+
+  return targets.size() * object.operandSize();
+}
+
+size_t LayoutPropagationPass::cost(const std::vector<operation::Index> &operations) const
+{
+  std::unordered_set<operand::Index> operands;
+
+  for (const auto &index : operations)
+  {
+    const auto &node = _graph.operations().at(index);
+
+    for (const auto &ind : node.getInputs())
+    {
+      operands.insert(ind);
+    }
+    for (const auto &ind : node.getOutputs())
+    {
+      operands.insert(ind);
+    }
+  }
+
+  size_t bytes = 0;
+  for (const auto &ind : operands)
+  {
+    bytes += cost(ind);
+  }
+
+  return bytes;
+}
+
+size_t LayoutPropagationPass::totalCost(void) const
+{
+  size_t bytes = 0;
+
+  _graph.operands().iterate(
+      [&](const operand::Index &index, const operand::Object &) { bytes += cost(index); });
+
+  return bytes;
+}
+
+std::vector<std::vector<operation::Index>> LayoutPropagationPass::agnosticGroups(void) const
+{
+  const auto &operations = _graph.operations();
+  const auto &operands = _graph.operands();
+
+  std::vector<std::vector<operation::Index>> groups;
+  std::unordered_set<operation::Index> visited;
+
+  operations.iterate([&](const operation::Index &index, const operation::Node &node) {
+    if (!isLayoutAgnostic(node) || (visited.find(index) != visited.end()))
+    {
+      return;
+    }
+
+    std::vector<operation::Index> group;
+    std::vector<operation::Index> stack{index};
+    visited.insert(index);
+
+    auto visit = [&](const operation::Index &neighbor) {
+      if (isLayoutAgnostic(operations.at(neighbor)) && visited.insert(neighbor).second)
+      {
+        stack.emplace_back(neighbor);
+      }
+    };
+
+    while (!stack.empty())
+    {
+      const auto current = stack.back();
+      stack.pop_back();
+      group.emplace_back(current);
+
+      const auto &current_node = operations.at(current);
+
+      for (const auto &ind : current_node.getInputs())
+      {
+        for (const auto &def : operands.at(ind).getDef().list())
+        {
+          visit(def);
+        }
+      }
+      for (const auto &ind : current_node.getOutputs())
+      {
+        for (const auto &use : operands.at(ind).getUses().list())
+        {
+          visit(use);
+        }
+      }
+    }
+
+    groups.emplace_back(std::move(group));
+  });
+
+  return groups;
+}
+
+bool LayoutPropagationPass::propagate(const std::vector<operation::Index> &group)
+{
+  const auto &operands = _graph.operands();
+
+  // Candidates are the backends of the operations around the group
+  std::vector<backend::Backend> candidates;
+
+  auto add_candidate = [&](const operation::Index &index) {
+    const auto &backend = _backends.at(index);
+    auto is_same = [&](const backend::Backend &candidate) { return equal(candidate, backend); };
+
+    if (std::none_of(candidates.begin(), candidates.end(), is_same))
+    {
+      candidates.emplace_back(backend);
+    }
+  };
+
+  for (const auto &index : group)
+  {
+    const auto &node = _graph.operations().at(index);
+
+    for (const auto &ind : node.getInputs())
+    {
+      for (const auto &def : operands.at(ind).getDef().list())
+      {
+        add_candidate(def);
+      }
+    }
+    for (const auto &ind : node.getOutputs())
+    {
+      for (const auto &use : operands.at(ind).getUses().list())
+      {
+        add_candidate(use);
+      }
+    }
+  }
+
+  std::vector<backend::Backend> current;
+  for (const auto &index : group)
+  {
+    current.emplace_back(_backends.at(index));
+  }
+
+  auto assign = [&](const backend::Backend &backend) {
+    for (const auto &index : group)
+    {
+      _backends[index] = backend;
+    }
+  };
+
+  size_t best_cost = cost(group);
+  const backend::Backend *best = nullptr;
+
+  for (const auto &candidate : candidates)
+  {
+    assign(candidate);
+
+    const auto candidate_cost = cost(group);
+    if (candidate_cost < best_cost)
+    {
+      best_cost = candidate_cost;
+      best = &candidate;
+    }
+  }
+
+  if (best == nullptr)
+  {
+    for (uint32_t n = 0; n < group.size(); ++n)
+    {
+      _backends[group[n]] = current[n];
+    }
+    return false;
+  }
+
+  assign(*best);
+  return true;
+}
+
+uint32_t LayoutPropagationPass::insertPermutes(void)
+{
+  auto &operands = _graph.operands();
+  auto &operations = _graph.operations();
+
+  // NOTE Operands are collected first as appending an operand while iterating is not allowed
+  std::vector<operand::Index> indexes;
+
+  operands.iterate([&](const operand::Index &index, const operand::Object &object) {
+    if ((object.getDef().size() != 0) && (object.getUses().size() != 0))
+    {
+      indexes.emplace_back(index);
+    }
+  });
+
+  uint32_t count = 0;
+
+  for (const auto &index : indexes)
+  {
+    const auto from = _backends.at(operands.at(index).getDef().list().front());
+
+    // Uses of the operand for each backend other than the one that defines it
+    using Target = std::pair<backend::Backend, std::vector<operation::Index>>;
+    std::vector<Target> targets;
+
+    for (const auto &use : operands.at(index).getUses().list())
+    {
+      const auto &to = _backends.at(use);
+      if (equal(from, to))
+      {
+        continue;
+      }
+
+      auto it = std::find_if(targets.begin(), targets.end(),
+                             [&](const Target &target) { return equal(target.first, to); });
+
+      if (it == targets.end())
+      {
+        targets.emplace_back(to, std::vector<operation::Index>{use});
+      }
+      else
+      {
+        it->second.emplace_back(use);
+      }
+    }
+
+    for (const auto &target : targets)
+    {
+      const auto &to = target.first;
+
+      const auto &shape = operands.at(index).shape();
+
+      const auto permuted = operands.append(shape, operands.at(index).typeInfo());
+      operands.at(permuted).setAsOperationOutput();
+
+      const auto type = operation::Permute::typeOf(shape, from.config()->getOperandLayout(),
+                                                   to.config()->getOperandLayout());
+
+      auto node = nnfw::make_unique<operation::Permute::Node>(index, permuted, type);
+      node->lower_info(nnfw::make_unique<operation::LowerInfo>(_permute_backend, from, to));
+
+      const auto permute = operations.append(std::move(node));
+      _backends.emplace(permute, _permute_backend);
+
+      operands.at(index).appendUse(permute);
+      operands.at(permuted).appendDef(permute);
+
+      // Let the uses on the target backend read the permuted operand
+      for (const auto &use : target.second)
+      {
+        auto &use_node = operations.at(use);
+
+        operand::IndexSet inputs;
+        for (const auto &input : use_node.getInputs())
+        {
+          inputs.append((input == index) ? permuted : input);
+        }
+        use_node.setInputs(inputs);
+
+        operands.at(index).removeUse(use);
+        operands.at(permuted).appendUse(use);
+      }
+
+      VERBOSE(LayoutPropagationPass) << "Permute #" << index.value() << " into #"
+                                     << permuted.value() << " for " << target.second.size()
+                                     << " operation(s)" << std::endl;
+
+      ++count;
+    }
+  }
+
+  return count;
+}
+
+void LayoutPropagationPass::run()
+{
+  _graph.operations().iterate([&](const operation::Index &index, const operation::Node &node) {
+    _backends.emplace(index, node.lower_info()->backend());
+  });
+
+  // Bytes to permute when an operand is permuted for each use on another backend
+  size_t naive_bytes = 0;
+
+  _graph.operands().iterate([&](const operand::Index &, const operand::Object &object) {
+    if (object.getDef().size() == 0)
+    {
+      return;
+    }
+
+    const auto &from = _backends.at(object.getDef().list().front());
+    for (const auto &use : object.getUses().list())
+    {
+      if (!equal(from, _backends.at(use)))
+      {
+        naive_bytes += object.operandSize();
+      }
+    }
+  });
+
+  // Move layout-agnostic operations until no move reduces the bytes to permute
+  //
+  // NOTE Each move strictly reduces the total bytes to permute, so this loop terminates
+  const auto groups = agnosticGroups();
+
+  bool changed = true;
+  while (changed)
+  {
+    changed = false;
+    for (const auto &group : groups)
+    {
+      changed = propagate(group) || changed;
+    }
+  }
+
+  _graph.operations().iterate([&](const operation::Index &index, operation::Node &node) {
+    const auto &backend = _backends.at(index);
+
+    if (!equal(node.lower_info()->backend(), backend))
+    {
+      VERBOSE(LayoutPropagationPass) << "Move operation #" << index.value()
+                                     << " to the backend around it" << std::endl;
+      node.lower_info(nnfw::make_unique<operation::LowerInfo>(backend));
+    }
+  });
+
+  const auto bytes = totalCost();
+  const auto count = insertPermutes();
+
+  VERBOSE(LayoutPropagationPass) << "Permutes: " << count << " operations, " << bytes
+                                 << " bytes (naive " << naive_bytes << " bytes, removed "
+                                 << (naive_bytes - bytes) << " bytes)" << std::endl;
+}
+
+} // namespace pass
+} // namespace graph
+} // namespace neurun
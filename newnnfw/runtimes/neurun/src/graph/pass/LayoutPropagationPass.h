@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NEURUN_GRAPH_PASS_LAYOUT_PROPAGATION_PASS_H__
+#define __NEURUN_GRAPH_PASS_LAYOUT_PROPAGATION_PASS_H__
+
+#include <unordered_map>
+#include <vector>
+
+#include "Pass.h"
+#include "backend/BackendManager.h"
+#include "graph/operand/Index.h"
+#include "graph/operation/Index.h"
+
+namespace neurun
+{
+namespace graph
+{
+namespace pass
+{
+
+// Inserts Permute operations where an operand moves across backends (i.e. layouts)
+//
+// Before inserting them, this pass moves layout-agnostic operations (e.g. Reshape) to the backend
+// that minimizes the total bytes to permute, which hoists Permutes past such operations and folds
+// the pair of Permutes around them. Then an operand is permuted only once for each backend that
+// uses it.
+//
+// NOTE Every operation should have its LowerInfo before this pass runs
+class LayoutPropagationPass : public Pass
+{
+public:
+  // 'permute_backend' runs the inserted Permute operations
+  LayoutPropagationPass(Graph &graph, const backend::Backend &permute_backend);
+
+public:
+  virtual std::string id() override { return "LayoutPropagationPass"; }
+  virtual void run() override;
+
+private:
+  // Bytes to permute for an operand under the current backend assignment
+  size_t cost(const operand::Index &index) const;
+  size_t cost(const std::vector<operation::Index> &operations) const;
+  size_t totalCost(void) const;
+  // Groups of layout-agnostic operations that are connected with each other
+  std::vector<std::vector<operation::Index>> agnosticGroups(void) const;
+  bool propagate(const std::vector<operation::Index> &group);
+  uint32_t insertPermutes(void);
+
+private:
+  backend::Backend _permute_backend;
+  // Backend of each operation (for evaluating assignments before updating LowerInfo)
+  std::unordered_map<operation::Index, backend::Backend> _backends;
+};
+
+} // namespace pass
+} // namespace graph
+} // namespace neurun
+
+#endif // __NEURUN_GRAPH_PASS_LAYOUT_PROPAGATION_PASS_H__
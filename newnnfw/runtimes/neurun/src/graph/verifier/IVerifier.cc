@@ -16,6 +16,9 @@
 
 #include "IVerifier.h"
 
+#include <vector>
+
+#include "graph/Adjacency.h"
 #include "graph/Graph.h"
 
 namespace neurun
@@ -28,41 +31,48 @@ namespace verifier
 bool DAGChecker::verify(const Graph &graph) const
 {
   auto &operations = graph.operations();
+  const Adjacency adjacency{operations, graph.operands()};
+
+  enum class State : uint8_t
+  {
+    NOT_VISITED,
+    ON_STACK,
+    VISITED
+  };
+
   bool cyclic = false;
-  std::vector<bool> visited(operations.size(), false);
-  std::vector<bool> on_stack(operations.size(), false);
+  std::vector<State> states(operations.size(), State::NOT_VISITED);
+  std::vector<std::pair<operation::Index, Adjacency::Iterator>> stack;
 
-  std::function<void(const operation::Index &index, const operation::Node &)> dfs_recursive =
-      [&](const operation::Index &index, const operation::Node &node) -> void {
-    if (on_stack[index.value()])
-      cyclic = true;
-    if (visited[index.value()])
+  operations.iterate([&](const operation::Index &index, const operation::Node &) {
+    if (states[index.value()] != State::NOT_VISITED)
       return;
-    visited[index.value()] = true;
-    on_stack[index.value()] = true;
+    states[index.value()] = State::ON_STACK;
+    stack.emplace_back(index, adjacency.begin(index));
 
-    auto outputs = node.getOutputs();
-    for (auto output : outputs)
+    while (!stack.empty())
     {
-      // TODO Fix traversing algorithm
-      //      Every time need to search for operations that has `outgoing` as incoming from all
-      //      operations but we can hold that info cached
-      operations.iterate([&](const operation::Index &cand_index, const operation::Node &cand_node) {
-        auto inputs = cand_node.getInputs();
-        for (auto input : inputs)
-        {
-          if (output == input)
-          {
-            dfs_recursive(cand_index, cand_node);
-          }
-        }
-      });
-    }
+      auto &top = stack.back();
 
-    on_stack[index.value()] = false;
-  };
+      if (top.second == adjacency.end(top.first))
+      {
+        states[top.first.value()] = State::VISITED;
+        stack.pop_back();
+        continue;
+      }
 
-  operations.iterate(dfs_recursive);
+      const auto use = *(top.second++);
+      if (states[use.value()] == State::ON_STACK)
+      {
+        cyclic = true;
+      }
+      else if (states[use.value()] == State::NOT_VISITED)
+      {
+        states[use.value()] = State::ON_STACK;
+        stack.emplace_back(use, adjacency.begin(use));
+      }
+    }
+  });
 
   return !cyclic;
 }
@@ -16,6 +16,8 @@
 
 #include "Convert.h"
 
+#include <stdexcept>
+
 namespace internal
 {
 
@@ -34,26 +36,56 @@ namespace internal
   return ::arm_compute::TensorShape(shape.W, shape.H, shape.C, shape.N);
 }
 
-::arm_compute::TensorInfo asTensorInfo(const nnfw::util::feature::Shape &shape)
+::arm_compute::DataType asDataType(const ::neurun::graph::operand::DataType &type)
+{
+  switch (type)
+  {
+    case ::neurun::graph::operand::DataType::SCALAR_FLOAT32:
+    case ::neurun::graph::operand::DataType::TENSOR_FLOAT32:
+      return ::arm_compute::DataType::F32;
+    case ::neurun::graph::operand::DataType::SCALAR_INT32:
+    case ::neurun::graph::operand::DataType::TENSOR_INT32:
+      return ::arm_compute::DataType::S32;
+    case ::neurun::graph::operand::DataType::SCALAR_UINT32:
+      return ::arm_compute::DataType::U32;
+    case ::neurun::graph::operand::DataType::TENSOR_QUANT8_ASYMM:
+      return ::arm_compute::DataType::QASYMM8;
+    default:
+      throw std::runtime_error("Not supported, yet");
+      break;
+  }
+}
+
+::arm_compute::TensorInfo asTensorInfo(const ::arm_compute::TensorShape &shape,
+                                       const ::neurun::graph::operand::TypeInfo &typeInfo)
+{
+  return ::arm_compute::TensorInfo(shape, 1, asDataType(typeInfo.type()),
+                                   ::arm_compute::QuantizationInfo(typeInfo.scale(),
+                                                                   typeInfo.offset()));
+}
+
+::arm_compute::TensorInfo asTensorInfo(const nnfw::util::feature::Shape &shape,
+                                       const ::neurun::graph::operand::TypeInfo &typeInfo)
 {
-  return ::arm_compute::TensorInfo(asTensorShape(shape), 1, ::arm_compute::DataType::F32);
+  return asTensorInfo(asTensorShape(shape), typeInfo);
 }
 
-::arm_compute::TensorInfo asTensorInfo(const nnfw::util::kernel::Shape &shape)
+::arm_compute::TensorInfo asTensorInfo(const nnfw::util::kernel::Shape &shape,
+                                       const ::neurun::graph::operand::TypeInfo &typeInfo)
 {
-  return ::arm_compute::TensorInfo(asTensorShape(shape), 1, ::arm_compute::DataType::F32);
+  return asTensorInfo(asTensorShape(shape), typeInfo);
 }
 
-::arm_compute::TensorInfo asTensorInfo(int32_t size)
+::arm_compute::TensorInfo asTensorInfo(int32_t size,
+                                       const ::neurun::graph::operand::TypeInfo &typeInfo)
 {
-  return ::arm_compute::TensorInfo(::arm_compute::TensorShape(size), 1,
-                                   ::arm_compute::DataType::F32);
+  return asTensorInfo(::arm_compute::TensorShape(size), typeInfo);
 }
 
-::arm_compute::TensorInfo asTensorInfo(int32_t h, int32_t w)
+::arm_compute::TensorInfo asTensorInfo(int32_t h, int32_t w,
+                                       const ::neurun::graph::operand::TypeInfo &typeInfo)
 {
-  return ::arm_compute::TensorInfo(::arm_compute::TensorShape(w, h), 1,
-                                   ::arm_compute::DataType::F32);
+  return asTensorInfo(::arm_compute::TensorShape(w, h), typeInfo);
 }
 
 } // namespace internal
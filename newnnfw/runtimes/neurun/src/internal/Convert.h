@@ -23,6 +23,8 @@
 #include "util/feature/Shape.h"
 #include "util/kernel/Shape.h"
 
+#include "graph/operand/TypeInfo.h"
+
 namespace internal
 {
 
@@ -30,10 +32,18 @@ namespace internal
 ::arm_compute::TensorShape asTensorShape(const nnfw::util::feature::Shape &shape);
 ::arm_compute::TensorShape asTensorShape(const nnfw::util::kernel::Shape &shape);
 
-::arm_compute::TensorInfo asTensorInfo(const nnfw::util::feature::Shape &shape);
-::arm_compute::TensorInfo asTensorInfo(const nnfw::util::kernel::Shape &shape);
-::arm_compute::TensorInfo asTensorInfo(int32_t size);
-::arm_compute::TensorInfo asTensorInfo(int32_t h, int32_t w);
+::arm_compute::DataType asDataType(const ::neurun::graph::operand::DataType &type);
+
+::arm_compute::TensorInfo asTensorInfo(const ::arm_compute::TensorShape &shape,
+                                       const ::neurun::graph::operand::TypeInfo &typeInfo);
+::arm_compute::TensorInfo asTensorInfo(const nnfw::util::feature::Shape &shape,
+                                       const ::neurun::graph::operand::TypeInfo &typeInfo);
+::arm_compute::TensorInfo asTensorInfo(const nnfw::util::kernel::Shape &shape,
+                                       const ::neurun::graph::operand::TypeInfo &typeInfo);
+::arm_compute::TensorInfo asTensorInfo(int32_t size,
+                                       const ::neurun::graph::operand::TypeInfo &typeInfo);
+::arm_compute::TensorInfo asTensorInfo(int32_t h, int32_t w,
+                                       const ::neurun::graph::operand::TypeInfo &typeInfo);
 
 } // namespace internal
 
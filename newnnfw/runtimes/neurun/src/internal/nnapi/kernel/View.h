@@ -29,12 +29,12 @@ namespace nnapi
 namespace kernel
 {
 
-template <typename T> class View final : public nnfw::util::kernel::Reader<float>
+template <typename T> class View final : public nnfw::util::kernel::Reader<T>
 {
 public:
   View(::arm_compute::ITensor *tensor) : _tensor{tensor}
   {
-    assert(tensor->info()->data_type() == ::arm_compute::DataType::F32);
+    assert(tensor->info()->element_size() == sizeof(T));
 
     _shape.N = tensor->info()->dimension(3);
     _shape.C = tensor->info()->dimension(2);
@@ -46,7 +46,7 @@ public:
   const nnfw::util::kernel::Shape &shape(void) const { return _shape; }
 
 public:
-  float at(uint32_t nth, uint32_t row, uint32_t col, uint32_t ch) const override
+  T at(uint32_t nth, uint32_t row, uint32_t col, uint32_t ch) const override
   {
     // NNAPI uses NHWC ordering
     uint32_t index = 0;
@@ -56,12 +56,12 @@ public:
     index += col * _shape.C;
     index += ch;
 
-    float *ptr = reinterpret_cast<float *>(_tensor->buffer());
+    T *ptr = reinterpret_cast<T *>(_tensor->buffer());
 
     return ptr[index];
   }
 
-  float &at(uint32_t nth, uint32_t row, uint32_t col, uint32_t ch)
+  T &at(uint32_t nth, uint32_t row, uint32_t col, uint32_t ch)
   {
     // NNAPI uses NHWC ordering
     uint32_t index = 0;
@@ -71,7 +71,7 @@ public:
     index += col * _shape.C;
     index += ch;
 
-    float *ptr = reinterpret_cast<float *>(_tensor->buffer());
+    T *ptr = reinterpret_cast<T *>(_tensor->buffer());
 
     return ptr[index];
   }
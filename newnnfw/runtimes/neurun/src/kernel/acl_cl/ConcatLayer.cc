@@ -18,6 +18,7 @@
 
 #include <arm_compute/runtime/CL/CLScheduler.h>
 
+#include "backend/NotSupportedError.h"
 #include "backend/acl_cl/kernel/View.h"
 #include "logging.h"
 
@@ -149,7 +150,7 @@ void ConcatLayer::run()
   }
   else if (_input_type == OperandType::TENSOR_QUANT8_ASYMM)
   {
-    throw std::runtime_error("NYI - concatenationQuant8()");
+    throw neurun::backend::NotSupportedError("NYI - concatenationQuant8()");
   }
 }
 
@@ -37,7 +37,7 @@ namespace cpu
   uint32_t paddingWidth = (uint32_t)_paddingLeft;
 
 AvgPoolLayer::AvgPoolLayer()
-    : _inputData(nullptr), _outputData(nullptr), _inputShape(), _outputShape(), _paddingLeft(0),
+    : _input(nullptr), _output(nullptr), _inputShape(), _outputShape(), _paddingLeft(0),
       _paddingTop(0), _paddingRight(0), _paddingBottom(0), _strideWidth(0), _strideHeight(0),
       _kernelWidth(0), _kernelHeight(0), _activation(ANEURALNETWORKS_FUSED_NONE),
       _inputType(OperandType::SCALAR_FLOAT32)
@@ -52,11 +52,12 @@ bool AvgPoolLayer::averagePoolFloat32()
   float output_activation_min, output_activation_max;
   CalculateActivationRangeFloat(_activation, &output_activation_min, &output_activation_max);
 
-  ::tflite::optimized_ops::AveragePool(
-      reinterpret_cast<const float *>(_inputData), convertShapeToDims(_inputShape), _strideWidth,
-      _strideHeight, paddingWidth, paddingHeight, _kernelWidth, _kernelHeight,
-      output_activation_min, output_activation_max, reinterpret_cast<float *>(_outputData),
-      convertShapeToDims(_outputShape));
+  ::tflite::optimized_ops::AveragePool(reinterpret_cast<const float *>(_input->buffer()),
+                                       convertShapeToDims(_inputShape), _strideWidth, _strideHeight,
+                                       paddingWidth, paddingHeight, _kernelWidth, _kernelHeight,
+                                       output_activation_min, output_activation_max,
+                                       reinterpret_cast<float *>(_output->buffer()),
+                                       convertShapeToDims(_outputShape));
   return true;
 }
 bool AvgPoolLayer::averagePoolQuant8()
@@ -68,21 +69,23 @@ bool AvgPoolLayer::averagePoolQuant8()
   CalculateActivationRangeUint8(_activation, _outputShape, &output_activation_min,
                                 &output_activation_max);
 
-  ::tflite::optimized_ops::AveragePool(_inputData, convertShapeToDims(_inputShape), _strideWidth,
-                                       _strideHeight, paddingWidth, paddingHeight, _kernelWidth,
-                                       _kernelHeight, output_activation_min, output_activation_max,
-                                       _outputData, convertShapeToDims(_outputShape));
+  ::tflite::optimized_ops::AveragePool(_input->buffer(), convertShapeToDims(_inputShape),
+                                       _strideWidth, _strideHeight, paddingWidth, paddingHeight,
+                                       _kernelWidth, _kernelHeight, output_activation_min,
+                                       output_activation_max, _output->buffer(),
+                                       convertShapeToDims(_outputShape));
   return true;
 }
 
-void AvgPoolLayer::configure(uint8_t *inputData, const Shape inputShape, const uint32_t paddingLeft,
-                             const uint32_t paddingRight, const uint32_t paddingTop,
-                             const uint32_t paddingBottom, const uint32_t strideWidth,
-                             const uint32_t strideHeight, const uint32_t kernelWidth,
-                             const uint32_t kernelHeight, const FuseCode activation,
-                             uint8_t *outputData, const Shape outputShape)
+void AvgPoolLayer::configure(::arm_compute::ITensor *input, const Shape inputShape,
+                             const uint32_t paddingLeft, const uint32_t paddingRight,
+                             const uint32_t paddingTop, const uint32_t paddingBottom,
+                             const uint32_t strideWidth, const uint32_t strideHeight,
+                             const uint32_t kernelWidth, const uint32_t kernelHeight,
+                             const FuseCode activation, ::arm_compute::ITensor *output,
+                             const Shape outputShape)
 {
-  _inputData = inputData;
+  _input = input;
   _inputShape = inputShape;
   _inputType = inputShape.type;
   _paddingLeft = paddingLeft;
@@ -94,7 +97,7 @@ void AvgPoolLayer::configure(uint8_t *inputData, const Shape inputShape, const u
   _kernelWidth = kernelWidth;
   _kernelHeight = kernelHeight;
   _activation = activation;
-  _outputData = outputData;
+  _output = output;
   _outputShape = outputShape;
 }
 
@@ -106,8 +109,7 @@ void AvgPoolLayer::run()
   }
   else if (_inputType == OperandType::TENSOR_QUANT8_ASYMM)
   {
-    throw std::runtime_error{"AvgPoolLayer : Not tested for TENSOR_QUANT8_ASYMM"};
-    // averagePoolQuant8();
+    averagePoolQuant8();
   }
 }
 
@@ -19,6 +19,7 @@
 
 #include <NeuralNetworks.h>
 
+#include <arm_compute/core/ITensor.h>
 #include <arm_compute/runtime/IFunction.h>
 
 #include "kernel/cpu/OperationUtils.h"
@@ -40,18 +41,18 @@ public:
 
   bool averagePoolQuant8();
 
-  void configure(uint8_t *inputData, const Shape inputShape, const uint32_t paddingLeft,
+  void configure(::arm_compute::ITensor *input, const Shape inputShape, const uint32_t paddingLeft,
                  const uint32_t paddingRight, const uint32_t paddingTop,
                  const uint32_t paddingBottom, const uint32_t strideWidth,
                  const uint32_t strideHeight, const uint32_t kernelWidth,
-                 const uint32_t kernelHeight, const FuseCode activation, uint8_t *outputData,
-                 const Shape outputShape);
+                 const uint32_t kernelHeight, const FuseCode activation,
+                 ::arm_compute::ITensor *output, const Shape outputShape);
 
   void run();
 
 private:
-  uint8_t *_inputData;
-  uint8_t *_outputData;
+  ::arm_compute::ITensor *_input;
+  ::arm_compute::ITensor *_output;
 
   Shape _inputShape;
   Shape _outputShape;
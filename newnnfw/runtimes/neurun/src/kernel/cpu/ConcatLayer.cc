@@ -28,7 +28,7 @@ namespace cpu
 {
 
 ConcatLayer::ConcatLayer()
-    : _inputDataPtrs(), _outputData(nullptr), _axis(0), _inputShapes(), _outputShape(),
+    : _inputs(), _output(nullptr), _axis(0), _inputShapes(), _outputShape(),
       _inputType(OperandType::SCALAR_FLOAT32)
 {
   // DO NOTHING
@@ -47,14 +47,14 @@ bool ConcatLayer::concatenationFloat32()
 
   std::vector<const float *> inputFloatPtrs;
 
-  for (auto ptr : _inputDataPtrs)
+  for (auto input : _inputs)
   {
-    inputFloatPtrs.emplace_back(reinterpret_cast<const float *>(ptr));
+    inputFloatPtrs.emplace_back(reinterpret_cast<const float *>(input->buffer()));
   }
 
   ::tflite::optimized_ops::Concatenation<::tflite::FusedActivationFunctionType::kNone, float>(
       getNumberOfDimensions(_outputShape) - _axis - 1, inputFloatPtrs.data(), inputDimsPtr.data(),
-      num_inputs, reinterpret_cast<float *>(_outputData), convertShapeToDims(_outputShape));
+      num_inputs, reinterpret_cast<float *>(_output->buffer()), convertShapeToDims(_outputShape));
   return true;
 }
 bool ConcatLayer::concatenationQuant8()
@@ -67,17 +67,25 @@ bool ConcatLayer::concatenationQuant8()
     inputDims[i] = convertShapeToDims(_inputShapes[i]);
     inputDimsPtr[i] = &inputDims[i];
   }
+
+  std::vector<const uint8_t *> inputDataPtrs;
+
+  for (auto input : _inputs)
+  {
+    inputDataPtrs.emplace_back(input->buffer());
+  }
+
   ::tflite::optimized_ops::Concatenation<::tflite::FusedActivationFunctionType::kNone, uint8_t>(
-      getNumberOfDimensions(_outputShape) - _axis - 1, _inputDataPtrs.data(), inputDimsPtr.data(),
-      num_inputs, _outputData, convertShapeToDims(_outputShape));
+      getNumberOfDimensions(_outputShape) - _axis - 1, inputDataPtrs.data(), inputDimsPtr.data(),
+      num_inputs, _output->buffer(), convertShapeToDims(_outputShape));
   return true;
 }
 
-void ConcatLayer::configure(const std::vector<const uint8_t *> &inputDataPtrs,
+void ConcatLayer::configure(const std::vector<const ::arm_compute::ITensor *> &inputs,
                             const std::vector<Shape> &inputShapes, int32_t axis,
-                            uint8_t *outputData, const Shape outputShape)
+                            ::arm_compute::ITensor *output, const Shape outputShape)
 {
-  _inputDataPtrs = inputDataPtrs;
+  _inputs = inputs;
 
   for (auto shape : inputShapes)
   {
@@ -87,20 +95,42 @@ void ConcatLayer::configure(const std::vector<const uint8_t *> &inputDataPtrs,
 
   _axis = axis;
 
-  _outputData = outputData;
+  _output = output;
   _outputShape = outputShape;
 }
 
+bool ConcatLayer::isInPlace() const
+{
+  size_t offset = 0;
+
+  for (uint32_t n = 0; n < _inputs.size(); ++n)
+  {
+    if (_inputs[n]->buffer() != _output->buffer() + offset)
+    {
+      return false;
+    }
+
+    offset += sizeOfData(_inputShapes[n].type, _inputShapes[n].dimensions);
+  }
+
+  return true;
+}
+
 void ConcatLayer::run()
 {
+  // NOTE Inputs may live in their regions of the output buffer (see linear::AliasAnalysis)
+  if (isInPlace())
+  {
+    return;
+  }
+
   if (_inputType == OperandType::TENSOR_FLOAT32)
   {
     concatenationFloat32();
   }
   else if (_inputType == OperandType::TENSOR_QUANT8_ASYMM)
   {
-    throw std::runtime_error{"ConcatLayer : Not tested for TENSOR_QUANT8_ASYMM"};
-    // concatenationQuant8();
+    concatenationQuant8();
   }
 }
 
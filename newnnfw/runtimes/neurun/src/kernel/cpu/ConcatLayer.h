@@ -20,6 +20,7 @@
 
 #include <NeuralNetworks.h>
 
+#include <arm_compute/core/ITensor.h>
 #include <arm_compute/runtime/IFunction.h>
 
 #include "kernel/cpu/OperationUtils.h"
@@ -41,15 +42,19 @@ public:
 
   bool concatenationQuant8();
 
-  void configure(const std::vector<const uint8_t *> &inputDataPtrs,
-                 const std::vector<Shape> &inputShapes, int32_t axis, uint8_t *outputData,
-                 const Shape outputShape);
+  void configure(const std::vector<const ::arm_compute::ITensor *> &inputs,
+                 const std::vector<Shape> &inputShapes, int32_t axis,
+                 ::arm_compute::ITensor *output, const Shape outputShape);
 
   void run();
 
 private:
-  std::vector<const uint8_t *> _inputDataPtrs;
-  uint8_t *_outputData;
+  // Whether every input is already in its place of the output
+  bool isInPlace() const;
+
+private:
+  std::vector<const ::arm_compute::ITensor *> _inputs;
+  ::arm_compute::ITensor *_output;
 
   int32_t _axis;
 
@@ -18,8 +18,11 @@
 
 #include "tensorflow/contrib/lite/kernels/internal/optimized/optimized_ops.h"
 #include "kernel/cpu/OperationUtils.h"
+#include "kernel/cpu/PackedGemm.h"
+#include "kernel/cpu/Parallel.h"
 
-#include <mutex>
+#include <algorithm>
+#include <cassert>
 
 namespace neurun
 {
@@ -28,65 +31,141 @@ namespace kernel
 namespace cpu
 {
 
-// If possible we will use this static buffer for the tensor.
-static constexpr int kStaticBufferSize = 1605632;
-static char static_scratch_buffer[kStaticBufferSize];
-static std::mutex executionMutex;
-
-#define ANDROID_NN_CONV_PARAMETERS(Type)                                      \
-  uint32_t height = getSizeOfDimension(_inputShape, 1);                       \
-  uint32_t width = getSizeOfDimension(_inputShape, 2);                        \
-  uint32_t kernelHeight = getSizeOfDimension(_kernelShape, 1);                \
-  uint32_t kernelWidth = getSizeOfDimension(_kernelShape, 2);                 \
-  uint32_t outHeight = getSizeOfDimension(_outputShape, 1);                   \
-  uint32_t outWidth = getSizeOfDimension(_outputShape, 2);                    \
-  uint32_t inDepth = getSizeOfDimension(_inputShape, 3);                      \
-                                                                              \
-  uint32_t paddingHeight = (uint32_t)_paddingTop;                             \
-  uint32_t paddingWidth = (uint32_t)_paddingLeft;                             \
-                                                                              \
-  ::tflite::Dims<4> im2colDim;                                                \
-  im2colDim.sizes[3] = (int)getSizeOfDimension(_outputShape, 0);              \
-  im2colDim.sizes[2] = (int)getSizeOfDimension(_outputShape, 1);              \
-  im2colDim.sizes[1] = (int)getSizeOfDimension(_outputShape, 2);              \
-  im2colDim.sizes[0] = (int)inDepth * kernelHeight * kernelWidth;             \
-                                                                              \
-  im2colDim.strides[0] = 1;                                                   \
-  for (int i = 1; i < 4; i++)                                                 \
-  {                                                                           \
-    im2colDim.strides[i] = im2colDim.strides[i - 1] * im2colDim.sizes[i - 1]; \
-  }                                                                           \
-  Type *im2colData = nullptr;                                                 \
-  uint64_t im2colByteSize = sizeof(Type);                                     \
-  std::unique_ptr<Type[]> im2colGuard;                                        \
-  for (int i = 0; i < 4; i++)                                                 \
-  {                                                                           \
-    im2colByteSize *= im2colDim.sizes[i];                                     \
-  }                                                                           \
-  /* http://b/77982879, tflite::optimized_ops::Conv uses int for offsets */   \
-  if (im2colByteSize >= 0x7fffffff)                                           \
-  {                                                                           \
-    std::cout << "Conv size is too large, not enough memory" << std::endl;    \
-    return false;                                                             \
-  }                                                                           \
-  if (im2colByteSize <= kStaticBufferSize)                                    \
-  {                                                                           \
-    im2colData = reinterpret_cast<Type *>(static_scratch_buffer);             \
-  }                                                                           \
-  else                                                                        \
-  {                                                                           \
-    im2colData = new (std::nothrow) Type[im2colByteSize / sizeof(Type)];      \
-    if (im2colData == nullptr)                                                \
-    {                                                                         \
-      std::cout << "Conv size is too large, not enough memory" << std::endl;  \
-      return false;                                                           \
-    }                                                                         \
-    im2colGuard.reset(im2colData);                                            \
+namespace
+{
+
+::tflite::Dims<4> makeDims(uint32_t batch, uint32_t height, uint32_t width, uint32_t depth)
+{
+  ::tflite::Dims<4> dims;
+  dims.sizes[0] = static_cast<int>(depth);
+  dims.sizes[1] = static_cast<int>(width);
+  dims.sizes[2] = static_cast<int>(height);
+  dims.sizes[3] = static_cast<int>(batch);
+  dims.strides[0] = 1;
+  for (int i = 1; i < 4; i++)
+  {
+    dims.strides[i] = dims.strides[i - 1] * dims.sizes[i - 1];
+  }
+  return dims;
+}
+
+// Part of convolution that computes output rows [rowBegin, rowEnd) of a batch
+//
+// A slice reads only the input rows that it needs, and is given as much padding at the top as
+// its first output row needs, so that every slice can be computed by a separate Conv call.
+struct ConvSlice
+{
+  ConvSlice(const Shape &inputShape, const Shape &kernelShape, const Shape &outputShape,
+            uint32_t strideHeight, uint32_t paddingTop, uint32_t batch, uint32_t rowBegin,
+            uint32_t rowEnd)
+  {
+    const uint32_t height = getSizeOfDimension(inputShape, 1);
+    const uint32_t width = getSizeOfDimension(inputShape, 2);
+    const uint32_t inDepth = getSizeOfDimension(inputShape, 3);
+    const uint32_t kernelHeight = getSizeOfDimension(kernelShape, 1);
+    const uint32_t kernelWidth = getSizeOfDimension(kernelShape, 2);
+    const uint32_t outHeight = getSizeOfDimension(outputShape, 1);
+    const uint32_t outWidth = getSizeOfDimension(outputShape, 2);
+    const uint32_t outDepth = getSizeOfDimension(outputShape, 3);
+    const uint32_t rows = rowEnd - rowBegin;
+
+    // Input rows [inRowOrigin, inRowLast] are read (some of them may be padding)
+    const int32_t inRowOrigin =
+        static_cast<int32_t>(rowBegin * strideHeight) - static_cast<int32_t>(paddingTop);
+    const int32_t inRowLast =
+        inRowOrigin + static_cast<int32_t>((rows - 1) * strideHeight + kernelHeight - 1);
+    const uint32_t inRowBegin = std::max(inRowOrigin, 0);
+    const uint32_t inRowEnd = std::min(inRowLast + 1, static_cast<int32_t>(height));
+
+    assert(inRowBegin < inRowEnd);
+
+    inputOffset = (batch * height + inRowBegin) * width * inDepth;
+    outputOffset = (batch * outHeight + rowBegin) * outWidth * outDepth;
+    paddingHeight = inRowBegin - inRowOrigin;
+
+    inputDims = makeDims(1, inRowEnd - inRowBegin, width, inDepth);
+    outputDims = makeDims(1, rows, outWidth, outDepth);
+    im2colDims = makeDims(1, rows, outWidth, inDepth * kernelHeight * kernelWidth);
+    im2colSize = rows * outWidth * inDepth * kernelHeight * kernelWidth;
+  }
+
+  // Offsets (in elements) of the first input/output element of the slice
+  uint32_t inputOffset;
+  uint32_t outputOffset;
+  uint32_t paddingHeight;
+
+  ::tflite::Dims<4> inputDims;
+  ::tflite::Dims<4> outputDims;
+  ::tflite::Dims<4> im2colDims;
+  uint32_t im2colSize;
+};
+
+// Gathers the input patch of each output pixel in rows [rowBegin, rowEnd) of a NHWC batch
+//
+// A patch is laid out as [kernelHeight, kernelWidth, depth], the order of a NHWC kernel, and
+// the elements in padding are zero.
+void im2col(const float *input, uint32_t height, uint32_t width, uint32_t depth,
+            uint32_t kernelHeight, uint32_t kernelWidth, uint32_t strideHeight,
+            uint32_t strideWidth, uint32_t paddingTop, uint32_t paddingLeft, uint32_t rowBegin,
+            uint32_t rowEnd, uint32_t outWidth, float *output)
+{
+  for (uint32_t row = rowBegin; row < rowEnd; ++row)
+  {
+    for (uint32_t col = 0; col < outWidth; ++col)
+    {
+      for (uint32_t ky = 0; ky < kernelHeight; ++ky)
+      {
+        const int32_t y = static_cast<int32_t>(row * strideHeight + ky - paddingTop);
+
+        for (uint32_t kx = 0; kx < kernelWidth; ++kx)
+        {
+          const int32_t x = static_cast<int32_t>(col * strideWidth + kx - paddingLeft);
+
+          if (y < 0 || y >= static_cast<int32_t>(height) || x < 0 ||
+              x >= static_cast<int32_t>(width))
+          {
+            std::fill(output, output + depth, 0.0f);
+          }
+          else
+          {
+            std::copy_n(input + (y * width + x) * depth, depth, output);
+          }
+          output += depth;
+        }
+      }
+    }
+  }
+}
+
+} // namespace
+
+#define ANDROID_NN_CONV_PARAMETERS(Type)                                    \
+  uint32_t batches = getSizeOfDimension(_inputShape, 0);                    \
+  uint32_t height = getSizeOfDimension(_inputShape, 1);                     \
+  uint32_t width = getSizeOfDimension(_inputShape, 2);                      \
+  uint32_t kernelHeight = getSizeOfDimension(_kernelShape, 1);              \
+  uint32_t kernelWidth = getSizeOfDimension(_kernelShape, 2);               \
+  uint32_t outHeight = getSizeOfDimension(_outputShape, 1);                 \
+  uint32_t outWidth = getSizeOfDimension(_outputShape, 2);                  \
+  uint32_t outDepth = getSizeOfDimension(_outputShape, 3);                  \
+  uint32_t inDepth = getSizeOfDimension(_inputShape, 3);                    \
+                                                                            \
+  uint32_t paddingHeight = (uint32_t)_paddingTop;                           \
+  uint32_t paddingWidth = (uint32_t)_paddingLeft;                           \
+                                                                            \
+  uint64_t im2colByteSize = sizeof(Type);                                   \
+  im2colByteSize *= batches * outHeight * outWidth;                         \
+  im2colByteSize *= inDepth * kernelHeight * kernelWidth;                   \
+  /* http://b/77982879, tflite::optimized_ops::Conv uses int for offsets */ \
+  if (im2colByteSize >= 0x7fffffff)                                         \
+  {                                                                         \
+    std::cout << "Conv size is too large, not enough memory" << std::endl;  \
+    return false;                                                           \
   }
 
 ConvolutionLayer::ConvolutionLayer()
-    : _inputData(nullptr), _kernelData(nullptr), _outputData(nullptr), _biasData(nullptr),
-      _inputShape(), _kernelShape(), _outputShape(), _biasShape(), _paddingLeft(0), _paddingTop(0),
+    : _input(nullptr), _kernel(nullptr), _output(nullptr), _bias(nullptr), _inputShape(),
+      _kernelShape(), _outputShape(), _biasShape(), _paddingLeft(0), _paddingTop(0),
       _paddingRight(0), _paddingBottom(0), _strideWidth(0), _strideHeight(0),
       _activation(ANEURALNETWORKS_FUSED_NONE), _inputType(OperandType::SCALAR_FLOAT32)
 {
@@ -97,28 +176,46 @@ bool ConvolutionLayer::convFloat32()
 {
   ANDROID_NN_CONV_PARAMETERS(float)
 
-  const ::tflite::Dims<4> &kernel_dim = convertShapeToDims(_kernelShape);
-  const int kernel_width = ArraySize(kernel_dim, 1);
-  const int kernel_height = ArraySize(kernel_dim, 2);
   const bool need_im2col =
-      _strideWidth != 1 || _strideHeight != 1 || kernel_width != 1 || kernel_height != 1;
-
-  float *im2colDataToPass = nullptr;
-  if (need_im2col)
-  {
-    im2colDataToPass = im2colData;
-  }
+      _strideWidth != 1 || _strideHeight != 1 || kernelWidth != 1 || kernelHeight != 1;
 
   float output_activation_min, output_activation_max;
   CalculateActivationRangeFloat(_activation, &output_activation_min, &output_activation_max);
-  int32_t dilationWidthFactor = 1, dilationHeightFactor = 1;
-  ::tflite::optimized_ops::Conv(
-      reinterpret_cast<const float *>(_inputData), convertShapeToDims(_inputShape),
-      reinterpret_cast<const float *>(_kernelData), convertShapeToDims(_kernelShape),
-      reinterpret_cast<const float *>(_biasData), convertShapeToDims(_biasShape), _strideWidth,
-      _strideHeight, dilationWidthFactor, dilationHeightFactor, paddingWidth, paddingHeight,
-      output_activation_min, output_activation_max, reinterpret_cast<float *>(_outputData),
-      convertShapeToDims(_outputShape), im2colDataToPass, im2colDim);
+
+  const auto inputData = reinterpret_cast<const float *>(_input->buffer());
+  const auto kernelData = reinterpret_cast<const float *>(_kernel->buffer());
+  const auto biasData = reinterpret_cast<const float *>(_bias->buffer());
+  const auto outputData = reinterpret_cast<float *>(_output->buffer());
+  const uint32_t patchSize = kernelHeight * kernelWidth * inDepth;
+  const uint64_t macsPerRow = outWidth * outDepth * patchSize;
+
+  // Output rows are split across threads, each of which has its own im2col buffer
+  //
+  // NOTE The kernel is packed into panels at compile time (see
+  //      backend::cpu::InitializerGenerator), so each slice is a single GEMM over packed weights
+  for (uint32_t b = 0; b < batches; ++b)
+  {
+    parallelFor(outHeight, macsPerRow, 1, [&](uint32_t rowBegin, uint32_t rowEnd) {
+      const uint32_t pixels = (rowEnd - rowBegin) * outWidth;
+      const float *lhs = inputData + ((b * height + rowBegin) * width) * inDepth;
+
+      if (need_im2col)
+      {
+        auto scratch = ScratchArena::local().get(pixels * patchSize * sizeof(float));
+        auto im2colData = reinterpret_cast<float *>(scratch);
+
+        im2col(inputData + b * height * width * inDepth, height, width, inDepth, kernelHeight,
+               kernelWidth, _strideHeight, _strideWidth, paddingHeight, paddingWidth, rowBegin,
+               rowEnd, outWidth, im2colData);
+        lhs = im2colData;
+      }
+
+      float *out = outputData + ((b * outHeight + rowBegin) * outWidth) * outDepth;
+
+      gemmPacked(lhs, pixels, patchSize, kernelData, outDepth, biasData, output_activation_min,
+                 output_activation_max, out, 0, outDepth);
+    });
+  }
   return true;
 }
 
@@ -141,35 +238,53 @@ bool ConvolutionLayer::convQuant8()
   }
   CalculateActivationRangeUint8(_activation, _outputShape, &output_activation_min,
                                 &output_activation_max);
-  static gemmlowp::GemmContext gemm_context;
-  // Prevent concurrent executions that may access the scratch buffer and
-  // gemm_context.
-  std::unique_lock<std::mutex> lock(executionMutex);
-  // Alow gemmlowp automatically decide how many threads to use.
-  gemm_context.set_max_num_threads(0);
-  ::tflite::optimized_ops::Conv(
-      _inputData, convertShapeToDims(_inputShape), inputOffset, _kernelData,
-      convertShapeToDims(_kernelShape), kernelOffset, reinterpret_cast<const int32_t *>(_biasData),
-      convertShapeToDims(_biasShape), _strideWidth, _strideHeight, paddingWidth, paddingHeight,
-      outputOffset, output_multiplier, output_shift, output_activation_min, output_activation_max,
-      _outputData, convertShapeToDims(_outputShape), im2colData, im2colDim, &gemm_context);
+
+  const uint8_t *inputData = _input->buffer();
+  uint8_t *outputData = _output->buffer();
+  const uint64_t macsPerRow = outWidth * outDepth * inDepth * kernelHeight * kernelWidth;
+
+  // Output rows are split across threads, each of which has its own im2col buffer and
+  // gemm_context
+  for (uint32_t b = 0; b < batches; ++b)
+  {
+    parallelFor(outHeight, macsPerRow, 1, [&](uint32_t rowBegin, uint32_t rowEnd) {
+      const ConvSlice slice(_inputShape, _kernelShape, _outputShape, _strideHeight, paddingHeight,
+                            b, rowBegin, rowEnd);
+
+      auto &arena = ScratchArena::local();
+      auto im2colData = arena.get(slice.im2colSize * sizeof(uint8_t));
+      auto &gemm_context = arena.gemm_context();
+      // NOTE Slices are already run in parallel on the runtime thread pool
+      gemm_context.set_max_num_threads(1);
+
+      ::tflite::optimized_ops::Conv(
+          inputData + slice.inputOffset, slice.inputDims, inputOffset, _kernel->buffer(),
+          convertShapeToDims(_kernelShape), kernelOffset,
+          reinterpret_cast<const int32_t *>(_bias->buffer()), convertShapeToDims(_biasShape),
+          _strideWidth, _strideHeight, paddingWidth, slice.paddingHeight, outputOffset,
+          output_multiplier, output_shift, output_activation_min, output_activation_max,
+          outputData + slice.outputOffset, slice.outputDims, im2colData, slice.im2colDims,
+          &gemm_context);
+    });
+  }
   return true;
 }
 
-void ConvolutionLayer::configure(uint8_t *inputData, const Shape inputShape, uint8_t *kernelData,
-                                 const Shape kernelShape, uint8_t *biasData, const Shape biasShape,
+void ConvolutionLayer::configure(::arm_compute::ITensor *input, const Shape inputShape,
+                                 ::arm_compute::ITensor *kernel, const Shape kernelShape,
+                                 ::arm_compute::ITensor *bias, const Shape biasShape,
                                  const uint32_t paddingLeft, const uint32_t paddingRight,
                                  const uint32_t paddingTop, const uint32_t paddingBottom,
                                  const uint32_t strideWidth, const uint32_t strideHeight,
-                                 const FuseCode activation, uint8_t *outputData,
+                                 const FuseCode activation, ::arm_compute::ITensor *output,
                                  const Shape outputShape)
 {
-  _inputData = inputData;
+  _input = input;
   _inputShape = inputShape;
   _inputType = inputShape.type;
-  _kernelData = kernelData;
+  _kernel = kernel;
   _kernelShape = kernelShape;
-  _biasData = biasData;
+  _bias = bias;
   _biasShape = biasShape;
   _paddingLeft = paddingLeft;
   _paddingRight = paddingRight;
@@ -178,7 +293,7 @@ void ConvolutionLayer::configure(uint8_t *inputData, const Shape inputShape, uin
   _strideWidth = strideWidth;
   _strideHeight = strideHeight;
   _activation = activation;
-  _outputData = outputData;
+  _output = output;
   _outputShape = outputShape;
 }
 
@@ -190,8 +305,7 @@ void ConvolutionLayer::run()
   }
   else if (_inputType == OperandType::TENSOR_QUANT8_ASYMM)
   {
-    throw std::runtime_error{"ConvolutionLayer : Not tested for TENSOR_QUANT8_ASYMM"};
-    // convQuant8();
+    convQuant8();
   }
 }
 
@@ -19,9 +19,11 @@
 
 #include <NeuralNetworks.h>
 
+#include <arm_compute/core/ITensor.h>
 #include <arm_compute/runtime/IFunction.h>
 
 #include "kernel/cpu/OperationUtils.h"
+#include "kernel/cpu/ScratchArena.h"
 
 namespace neurun
 {
@@ -40,19 +42,21 @@ public:
 
   bool convQuant8();
 
-  void configure(uint8_t *inputData, const Shape inputShape, uint8_t *kernelData,
-                 const Shape kernelShape, uint8_t *biasData, const Shape biasShape,
-                 const uint32_t paddingLeft, const uint32_t paddingRight, const uint32_t paddingTop,
+  void configure(::arm_compute::ITensor *input, const Shape inputShape,
+                 ::arm_compute::ITensor *kernel, const Shape kernelShape,
+                 ::arm_compute::ITensor *bias, const Shape biasShape, const uint32_t paddingLeft,
+                 const uint32_t paddingRight, const uint32_t paddingTop,
                  const uint32_t paddingBottom, const uint32_t strideW, const uint32_t strideH,
-                 const FuseCode activation, uint8_t *outputData, const Shape outputShape);
+                 const FuseCode activation, ::arm_compute::ITensor *output,
+                 const Shape outputShape);
 
   void run();
 
 private:
-  uint8_t *_inputData;
-  uint8_t *_kernelData;
-  uint8_t *_outputData;
-  uint8_t *_biasData;
+  ::arm_compute::ITensor *_input;
+  ::arm_compute::ITensor *_kernel;
+  ::arm_compute::ITensor *_output;
+  ::arm_compute::ITensor *_bias;
 
   Shape _inputShape;
   Shape _kernelShape;
@@ -70,6 +74,9 @@ private:
   FuseCode _activation;
 
   OperandType _inputType;
+
+  // Keeps the scratch memory of every thread while this kernel exists
+  ScratchArena::User _scratch_user;
 };
 
 } // namespace cpu
@@ -0,0 +1,357 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DepthwiseConvolutionLayer.h"
+
+#include "tensorflow/contrib/lite/kernels/internal/optimized/depthwiseconv_uint8.h"
+#include "kernel/cpu/OperationUtils.h"
+#include "kernel/cpu/Parallel.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace neurun
+{
+namespace kernel
+{
+namespace cpu
+{
+
+namespace
+{
+
+struct Geometry
+{
+  uint32_t inHeight;
+  uint32_t inWidth;
+  uint32_t inDepth;
+  uint32_t kernelHeight;
+  uint32_t kernelWidth;
+  uint32_t outWidth;
+  uint32_t outDepth;
+  uint32_t depthMultiplier;
+  uint32_t strideWidth;
+  uint32_t strideHeight;
+  uint32_t paddingLeft;
+  uint32_t paddingTop;
+};
+
+// Accumulates 'input * filter' into 'acc' channel-wise
+inline void accumulate(float *acc, const float *input, const float *filter, uint32_t depth)
+{
+  uint32_t c = 0;
+#ifdef USE_NEON
+  for (; c + 4 <= depth; c += 4)
+  {
+    const float32x4_t sum = vld1q_f32(acc + c);
+    vst1q_f32(acc + c, vmlaq_f32(sum, vld1q_f32(input + c), vld1q_f32(filter + c)));
+  }
+#endif
+  for (; c < depth; ++c)
+  {
+    acc[c] += input[c] * filter[c];
+  }
+}
+
+inline void clamp(float *data, uint32_t depth, float min, float max)
+{
+  uint32_t c = 0;
+#ifdef USE_NEON
+  const float32x4_t vmin = vdupq_n_f32(min);
+  const float32x4_t vmax = vdupq_n_f32(max);
+  for (; c + 4 <= depth; c += 4)
+  {
+    vst1q_f32(data + c, vminq_f32(vmaxq_f32(vld1q_f32(data + c), vmin), vmax));
+  }
+#endif
+  for (; c < depth; ++c)
+  {
+    data[c] = std::min(std::max(data[c], min), max);
+  }
+}
+
+// Computes all the channels of output pixel (row, col), skipping the taps that fall on padding
+void depthwisePixel(const Geometry &g, const float *input, const float *filter, const float *bias,
+                    uint32_t row, uint32_t col, float *output)
+{
+  std::copy(bias, bias + g.outDepth, output);
+
+  const int32_t inRowOrigin =
+      static_cast<int32_t>(row * g.strideHeight) - static_cast<int32_t>(g.paddingTop);
+  const int32_t inColOrigin =
+      static_cast<int32_t>(col * g.strideWidth) - static_cast<int32_t>(g.paddingLeft);
+
+  for (uint32_t ky = 0; ky < g.kernelHeight; ++ky)
+  {
+    const int32_t inRow = inRowOrigin + static_cast<int32_t>(ky);
+    if (inRow < 0 || inRow >= static_cast<int32_t>(g.inHeight))
+    {
+      continue;
+    }
+
+    for (uint32_t kx = 0; kx < g.kernelWidth; ++kx)
+    {
+      const int32_t inCol = inColOrigin + static_cast<int32_t>(kx);
+      if (inCol < 0 || inCol >= static_cast<int32_t>(g.inWidth))
+      {
+        continue;
+      }
+
+      const float *in = input + (inRow * g.inWidth + inCol) * g.inDepth;
+      const float *w = filter + (ky * g.kernelWidth + kx) * g.outDepth;
+
+      if (g.depthMultiplier == 1)
+      {
+        accumulate(output, in, w, g.outDepth);
+        continue;
+      }
+
+      // Output channel 'ic * depthMultiplier + m' is computed from input channel 'ic'
+      for (uint32_t ic = 0; ic < g.inDepth; ++ic)
+      {
+        for (uint32_t m = 0; m < g.depthMultiplier; ++m)
+        {
+          const uint32_t oc = ic * g.depthMultiplier + m;
+          output[oc] += in[ic] * w[oc];
+        }
+      }
+    }
+  }
+}
+
+// Computes all the channels of an output pixel whose 3x3 window lies inside the input
+//
+// Unlike depthwisePixel, each group of channels is accumulated in registers over all the 9 taps
+// and is stored only once.
+void depthwise3x3Pixel(const float *input, uint32_t inRowSize, const float *filter,
+                       const float *bias, uint32_t depth, float *output)
+{
+  const float *taps[9];
+  for (uint32_t ky = 0; ky < 3; ++ky)
+  {
+    for (uint32_t kx = 0; kx < 3; ++kx)
+    {
+      taps[ky * 3 + kx] = input + ky * inRowSize + kx * depth;
+    }
+  }
+
+  uint32_t c = 0;
+#ifdef USE_NEON
+  for (; c + 4 <= depth; c += 4)
+  {
+    float32x4_t acc = vld1q_f32(bias + c);
+    for (uint32_t k = 0; k < 9; ++k)
+    {
+      acc = vmlaq_f32(acc, vld1q_f32(taps[k] + c), vld1q_f32(filter + k * depth + c));
+    }
+    vst1q_f32(output + c, acc);
+  }
+#endif
+  for (; c < depth; ++c)
+  {
+    float acc = bias[c];
+    for (uint32_t k = 0; k < 9; ++k)
+    {
+      acc += taps[k][c] * filter[k * depth + c];
+    }
+    output[c] = acc;
+  }
+}
+
+// Computes output rows [rowBegin, rowEnd) of a batch
+//
+// STRIDE is the stride of a 3x3 kernel whose depth multiplier is 1, or 0 for the generic path.
+template <uint32_t STRIDE>
+void depthwiseRows(const Geometry &g, const float *input, const float *filter, const float *bias,
+                   uint32_t rowBegin, uint32_t rowEnd, float activationMin, float activationMax,
+                   float *output)
+{
+  const uint32_t inRowSize = g.inWidth * g.inDepth;
+
+  for (uint32_t row = rowBegin; row < rowEnd; ++row)
+  {
+    float *out = output + row * g.outWidth * g.outDepth;
+
+    const int32_t inRow = static_cast<int32_t>(row * STRIDE) - static_cast<int32_t>(g.paddingTop);
+    const bool rowInside = (inRow >= 0) && (inRow + 3 <= static_cast<int32_t>(g.inHeight));
+
+    for (uint32_t col = 0; col < g.outWidth; ++col, out += g.outDepth)
+    {
+      const int32_t inCol =
+          static_cast<int32_t>(col * STRIDE) - static_cast<int32_t>(g.paddingLeft);
+      const bool inside = rowInside && (inCol >= 0) &&
+                          (inCol + 3 <= static_cast<int32_t>(g.inWidth));
+
+      if (STRIDE != 0 && inside)
+      {
+        depthwise3x3Pixel(input + inRow * inRowSize + inCol * g.inDepth, inRowSize, filter, bias,
+                          g.outDepth, out);
+      }
+      else
+      {
+        depthwisePixel(g, input, filter, bias, row, col, out);
+      }
+
+      clamp(out, g.outDepth, activationMin, activationMax);
+    }
+  }
+}
+
+} // namespace
+
+DepthwiseConvolutionLayer::DepthwiseConvolutionLayer()
+    : _input(nullptr), _kernel(nullptr), _output(nullptr), _bias(nullptr), _inputShape(),
+      _kernelShape(), _outputShape(), _biasShape(), _paddingLeft(0), _paddingTop(0),
+      _paddingRight(0), _paddingBottom(0), _strideWidth(0), _strideHeight(0),
+      _depthMultiplier(0), _activation(ANEURALNETWORKS_FUSED_NONE),
+      _inputType(OperandType::SCALAR_FLOAT32)
+{
+  // DO NOTHING
+}
+
+bool DepthwiseConvolutionLayer::depthwiseFloat32()
+{
+  Geometry g;
+
+  g.inHeight = getSizeOfDimension(_inputShape, 1);
+  g.inWidth = getSizeOfDimension(_inputShape, 2);
+  g.inDepth = getSizeOfDimension(_inputShape, 3);
+  g.kernelHeight = getSizeOfDimension(_kernelShape, 1);
+  g.kernelWidth = getSizeOfDimension(_kernelShape, 2);
+  g.outWidth = getSizeOfDimension(_outputShape, 2);
+  g.outDepth = getSizeOfDimension(_outputShape, 3);
+  g.depthMultiplier = _depthMultiplier;
+  g.strideWidth = _strideWidth;
+  g.strideHeight = _strideHeight;
+  g.paddingLeft = _paddingLeft;
+  g.paddingTop = _paddingTop;
+
+  const uint32_t batches = getSizeOfDimension(_inputShape, 0);
+  const uint32_t outHeight = getSizeOfDimension(_outputShape, 1);
+
+  float output_activation_min, output_activation_max;
+  CalculateActivationRangeFloat(_activation, &output_activation_min, &output_activation_max);
+
+  // Select a specialization for the common 3x3 kernels of stride 1 and 2
+  auto rows = &depthwiseRows<0>;
+  if (g.kernelHeight == 3 && g.kernelWidth == 3 && g.depthMultiplier == 1 &&
+      g.strideWidth == g.strideHeight)
+  {
+    if (g.strideWidth == 1)
+    {
+      rows = &depthwiseRows<1>;
+    }
+    else if (g.strideWidth == 2)
+    {
+      rows = &depthwiseRows<2>;
+    }
+  }
+
+  const auto inputData = reinterpret_cast<const float *>(_input->buffer());
+  const auto kernelData = reinterpret_cast<const float *>(_kernel->buffer());
+  const auto biasData = reinterpret_cast<const float *>(_bias->buffer());
+  const auto outputData = reinterpret_cast<float *>(_output->buffer());
+  const uint64_t macsPerRow = g.outWidth * g.outDepth * g.kernelHeight * g.kernelWidth;
+
+  for (uint32_t b = 0; b < batches; ++b)
+  {
+    const float *input = inputData + b * g.inHeight * g.inWidth * g.inDepth;
+    float *output = outputData + b * outHeight * g.outWidth * g.outDepth;
+
+    parallelFor(outHeight, macsPerRow, 1, [&](uint32_t rowBegin, uint32_t rowEnd) {
+      rows(g, input, kernelData, biasData, rowBegin, rowEnd, output_activation_min,
+           output_activation_max, output);
+    });
+  }
+  return true;
+}
+
+bool DepthwiseConvolutionLayer::depthwiseQuant8()
+{
+  int32_t inputOffset = -_inputShape.offset;
+  int32_t kernelOffset = -_kernelShape.offset;
+  int32_t outputOffset = _outputShape.offset;
+  float real_multiplier = 0.0;
+  int32_t output_multiplier = 0;
+  int32_t output_shift = 0;
+  int32_t output_activation_min = 0;
+  int32_t output_activation_max = 0;
+  if (!GetQuantizedConvolutionMultipler(_inputShape, _kernelShape, _biasShape, _outputShape,
+                                        &real_multiplier) ||
+      !QuantizeMultiplierSmallerThanOne(real_multiplier, &output_multiplier, &output_shift))
+  {
+    return false;
+  }
+  CalculateActivationRangeUint8(_activation, _outputShape, &output_activation_min,
+                                &output_activation_max);
+
+  ::tflite::optimized_ops::DepthwiseConv(
+      _input->buffer(), convertShapeToDims(_inputShape), inputOffset, _kernel->buffer(),
+      convertShapeToDims(_kernelShape), kernelOffset,
+      reinterpret_cast<const int32_t *>(_bias->buffer()), convertShapeToDims(_biasShape),
+      _strideWidth, _strideHeight, _paddingLeft, _paddingTop, _depthMultiplier, outputOffset,
+      output_multiplier, output_shift, output_activation_min, output_activation_max,
+      _output->buffer(), convertShapeToDims(_outputShape));
+  return true;
+}
+
+void DepthwiseConvolutionLayer::configure(
+    ::arm_compute::ITensor *input, const Shape inputShape, ::arm_compute::ITensor *kernel,
+    const Shape kernelShape, ::arm_compute::ITensor *bias, const Shape biasShape,
+    const uint32_t paddingLeft, const uint32_t paddingRight, const uint32_t paddingTop,
+    const uint32_t paddingBottom, const uint32_t strideWidth, const uint32_t strideHeight,
+    const uint32_t depthMultiplier, const FuseCode activation, ::arm_compute::ITensor *output,
+    const Shape outputShape)
+{
+  _input = input;
+  _inputShape = inputShape;
+  _inputType = inputShape.type;
+  _kernel = kernel;
+  _kernelShape = kernelShape;
+  _bias = bias;
+  _biasShape = biasShape;
+  _paddingLeft = paddingLeft;
+  _paddingRight = paddingRight;
+  _paddingTop = paddingTop;
+  _paddingBottom = paddingBottom;
+  _strideWidth = strideWidth;
+  _strideHeight = strideHeight;
+  _depthMultiplier = depthMultiplier;
+  _activation = activation;
+  _output = output;
+  _outputShape = outputShape;
+
+  assert(getSizeOfDimension(_kernelShape, 0) == 1);
+  assert(getSizeOfDimension(_kernelShape, 3) ==
+         getSizeOfDimension(_inputShape, 3) * _depthMultiplier);
+  assert(getSizeOfDimension(_outputShape, 3) == getSizeOfDimension(_kernelShape, 3));
+}
+
+void DepthwiseConvolutionLayer::run()
+{
+  if (_inputType == OperandType::TENSOR_FLOAT32)
+  {
+    depthwiseFloat32();
+  }
+  else if (_inputType == OperandType::TENSOR_QUANT8_ASYMM)
+  {
+    depthwiseQuant8();
+  }
+}
+
+} // namespace cpu
+} // namespace kernel
+} // namespace neurun
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NEURUN_KERNEL_CPU_DEPTHWISE_CONVOLUTIONLAYER_H__
+#define __NEURUN_KERNEL_CPU_DEPTHWISE_CONVOLUTIONLAYER_H__
+
+#include <NeuralNetworks.h>
+
+#include <arm_compute/core/ITensor.h>
+#include <arm_compute/runtime/IFunction.h>
+
+#include "kernel/cpu/OperationUtils.h"
+
+namespace neurun
+{
+namespace kernel
+{
+namespace cpu
+{
+
+class DepthwiseConvolutionLayer : public ::arm_compute::IFunction
+{
+public:
+  DepthwiseConvolutionLayer();
+
+public:
+  bool depthwiseFloat32();
+
+  bool depthwiseQuant8();
+
+  void configure(::arm_compute::ITensor *input, const Shape inputShape,
+                 ::arm_compute::ITensor *kernel, const Shape kernelShape,
+                 ::arm_compute::ITensor *bias, const Shape biasShape, const uint32_t paddingLeft,
+                 const uint32_t paddingRight, const uint32_t paddingTop,
+                 const uint32_t paddingBottom, const uint32_t strideW, const uint32_t strideH,
+                 const uint32_t depthMultiplier, const FuseCode activation,
+                 ::arm_compute::ITensor *output, const Shape outputShape);
+
+  void run();
+
+private:
+  ::arm_compute::ITensor *_input;
+  ::arm_compute::ITensor *_kernel;
+  ::arm_compute::ITensor *_output;
+  ::arm_compute::ITensor *_bias;
+
+  Shape _inputShape;
+  Shape _kernelShape;
+  Shape _outputShape;
+  Shape _biasShape;
+
+  uint32_t _paddingLeft;
+  uint32_t _paddingTop;
+  uint32_t _paddingRight;
+  uint32_t _paddingBottom;
+
+  uint32_t _strideWidth;
+  uint32_t _strideHeight;
+
+  uint32_t _depthMultiplier;
+
+  FuseCode _activation;
+
+  OperandType _inputType;
+};
+
+} // namespace cpu
+} // namespace kernel
+} // namespace neurun
+
+#endif // __NEURUN_KERNEL_CPU_DEPTHWISE_CONVOLUTIONLAYER_H__
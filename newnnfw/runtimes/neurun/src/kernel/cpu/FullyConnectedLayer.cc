@@ -18,10 +18,9 @@
 #include "FullyConnectedLayer.h"
 
 #include "tensorflow/contrib/lite/kernels/internal/optimized/optimized_ops.h"
-#include "tensorflow/contrib/lite/kernels/internal/reference/reference_ops.h"
 #include "kernel/cpu/OperationUtils.h"
-
-#include <mutex>
+#include "kernel/cpu/PackedGemm.h"
+#include "kernel/cpu/Parallel.h"
 
 namespace neurun
 {
@@ -30,44 +29,72 @@ namespace kernel
 namespace cpu
 {
 
+namespace
+{
+
+// Returns Dims<4> of a contiguous (rows x cols) matrix
+::tflite::Dims<4> makeMatrixDims(uint32_t rows, uint32_t cols)
+{
+  ::tflite::Dims<4> dims;
+  dims.sizes[0] = static_cast<int>(cols);
+  dims.sizes[1] = static_cast<int>(rows);
+  dims.sizes[2] = 1;
+  dims.sizes[3] = 1;
+  dims.strides[0] = 1;
+  for (int i = 1; i < 4; i++)
+  {
+    dims.strides[i] = dims.strides[i - 1] * dims.sizes[i - 1];
+  }
+  return dims;
+}
+
+} // namespace
+
 FullyConnectedLayer::FullyConnectedLayer()
-    : _inputData(nullptr), _weightsData(nullptr), _biasData(nullptr), _outputData(nullptr),
-      _inputShape(), _weightsShape(), _biasShape(), _outputShape(),
-      _activation(ANEURALNETWORKS_FUSED_NONE), _inputType(OperandType::SCALAR_FLOAT32)
+    : _input(nullptr), _weights(nullptr), _bias(nullptr), _output(nullptr), _inputShape(),
+      _weightsShape(), _biasShape(), _outputShape(), _activation(ANEURALNETWORKS_FUSED_NONE),
+      _inputType(OperandType::SCALAR_FLOAT32)
 {
   // DO NOTHING
 }
 
-// executionMutex is used to protect concurrent access of non-threadsafe resources
-// like gemmlowp::GemmContext.
-// std::mutex is safe for pthreads on Android.
-static std::mutex executionMutex;
+template <typename Fn> void FullyConnectedLayer::forEachUnitSlice(Fn fn)
+{
+  const uint32_t batches = getSizeOfDimension(_outputShape, 0);
+  const uint32_t units = getSizeOfDimension(_outputShape, 1);
+  const uint32_t inputSize = getSizeOfDimension(_weightsShape, 1);
+
+  // Output units of a batch are contiguous only if there is a single batch
+  if (batches != 1)
+  {
+    fn(0, units);
+    return;
+  }
+
+  // NOTE Each slice has a multiple of 4 units to keep the GEMV fast path of tflite
+  parallelFor(units, inputSize, 4, fn);
+}
+
 bool FullyConnectedLayer::fullyConnectedFloat32()
 {
   float output_activation_min, output_activation_max;
   CalculateActivationRangeFloat(_activation, &output_activation_min, &output_activation_max);
-  // b/80425683, optimized implementation produces incorrect results when the
-  // number of input elements is the squre of batch_size.
-  uint32_t batch_size = getSizeOfDimension(_outputShape, 0);
-  uint32_t input_n_elements = getNumberOfElements(_inputShape);
-  if (batch_size * batch_size == input_n_elements)
-  {
-    ::tflite::reference_ops::FullyConnected(
-        reinterpret_cast<const float *>(_inputData), convertShapeToDims(_inputShape),
-        reinterpret_cast<const float *>(_weightsData), convertShapeToDims(_weightsShape),
-        reinterpret_cast<const float *>(_biasData), convertShapeToDims(_biasShape),
-        output_activation_min, output_activation_max, reinterpret_cast<float *>(_outputData),
-        convertShapeToDims(_outputShape));
-  }
-  else
-  {
-    ::tflite::optimized_ops::FullyConnected(
-        reinterpret_cast<const float *>(_inputData), convertShapeToDims(_inputShape),
-        reinterpret_cast<const float *>(_weightsData), convertShapeToDims(_weightsShape),
-        reinterpret_cast<const float *>(_biasData), convertShapeToDims(_biasShape),
-        output_activation_min, output_activation_max, reinterpret_cast<float *>(_outputData),
-        convertShapeToDims(_outputShape));
-  }
+
+  const uint32_t batches = getSizeOfDimension(_outputShape, 0);
+  const uint32_t units = getSizeOfDimension(_outputShape, 1);
+  const uint32_t inputSize = getSizeOfDimension(_weightsShape, 1);
+
+  const auto inputData = reinterpret_cast<const float *>(_input->buffer());
+  const auto weightsData = reinterpret_cast<const float *>(_weights->buffer());
+  const auto biasData = reinterpret_cast<const float *>(_bias->buffer());
+  const auto outputData = reinterpret_cast<float *>(_output->buffer());
+
+  // NOTE Weights are packed into panels at compile time (see backend::cpu::InitializerGenerator),
+  //      and each slice has whole panels
+  parallelFor(units, batches * inputSize, kPanelWidth, [&](uint32_t begin, uint32_t end) {
+    gemmPacked(inputData, batches, inputSize, weightsData, units, biasData, output_activation_min,
+               output_activation_max, outputData, begin, end);
+  });
   return true;
 }
 
@@ -90,34 +117,44 @@ bool FullyConnectedLayer::fullyConnectedQuant8()
   }
   CalculateActivationRangeUint8(_activation, _outputShape, &output_activation_min,
                                 &output_activation_max);
-  static gemmlowp::GemmContext gemm_context;
-  // Prevent concurrent executions that access gemm_context.
-  std::unique_lock<std::mutex> lock(executionMutex);
-  // Alow gemmlowp automatically decide how many threads to use.
-  gemm_context.set_max_num_threads(0);
-  ::tflite::optimized_ops::FullyConnected(
-      _inputData, convertShapeToDims(_inputShape), inputOffset, _weightsData,
-      convertShapeToDims(_weightsShape), weightsOffset,
-      reinterpret_cast<const int32_t *>(_biasData), convertShapeToDims(_biasShape), outputOffset,
-      output_multiplier, output_shift, output_activation_min, output_activation_max, _outputData,
-      convertShapeToDims(_outputShape), &gemm_context);
+  const uint8_t *inputData = _input->buffer();
+  const uint8_t *weightsData = _weights->buffer();
+  const auto biasData = reinterpret_cast<const int32_t *>(_bias->buffer());
+  uint8_t *outputData = _output->buffer();
+
+  forEachUnitSlice([&](uint32_t begin, uint32_t end) {
+    const uint32_t units = end - begin;
+    const uint32_t inputSize = getSizeOfDimension(_weightsShape, 1);
+    const uint32_t batches = getSizeOfDimension(_outputShape, 0);
+
+    // NOTE Each thread has its own gemm_context, and slices are already run in parallel
+    auto &gemm_context = ScratchArena::local().gemm_context();
+    gemm_context.set_max_num_threads(1);
+
+    ::tflite::optimized_ops::FullyConnected(
+        inputData, convertShapeToDims(_inputShape), inputOffset, weightsData + begin * inputSize,
+        makeMatrixDims(units, inputSize), weightsOffset, biasData + begin, makeMatrixDims(1, units),
+        outputOffset, output_multiplier, output_shift, output_activation_min, output_activation_max,
+        outputData + begin, makeMatrixDims(batches, units), &gemm_context);
+  });
   return true;
 }
 
-void FullyConnectedLayer::configure(uint8_t *inputData, const Shape inputShape,
-                                    uint8_t *weightsData, const Shape weightsShape,
-                                    uint8_t *biasData, const Shape biasShape, FuseCode activation,
-                                    uint8_t *outputData, const Shape outputShape)
+void FullyConnectedLayer::configure(::arm_compute::ITensor *input, const Shape inputShape,
+                                    ::arm_compute::ITensor *weights, const Shape weightsShape,
+                                    ::arm_compute::ITensor *bias, const Shape biasShape,
+                                    FuseCode activation, ::arm_compute::ITensor *output,
+                                    const Shape outputShape)
 {
-  _inputData = inputData;
+  _input = input;
   _inputShape = inputShape;
   _inputType = inputShape.type;
-  _weightsData = weightsData;
+  _weights = weights;
   _weightsShape = weightsShape;
-  _biasData = biasData;
+  _bias = bias;
   _biasShape = biasShape;
   _activation = activation;
-  _outputData = outputData;
+  _output = output;
   _outputShape = outputShape;
 }
 
@@ -129,8 +166,7 @@ void FullyConnectedLayer::run()
   }
   else if (_inputType == OperandType::TENSOR_QUANT8_ASYMM)
   {
-    throw std::runtime_error{"FullyConnectedLayer : Not tested for TENSOR_QUANT8_ASYMM"};
-    // fullyConnectedQuant8();
+    fullyConnectedQuant8();
   }
 }
 
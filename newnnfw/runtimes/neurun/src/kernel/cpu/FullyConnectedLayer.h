@@ -19,9 +19,11 @@
 
 #include <NeuralNetworks.h>
 
+#include <arm_compute/core/ITensor.h>
 #include <arm_compute/runtime/IFunction.h>
 
 #include "kernel/cpu/OperationUtils.h"
+#include "kernel/cpu/ScratchArena.h"
 
 namespace neurun
 {
@@ -40,17 +42,22 @@ public:
 
   bool fullyConnectedQuant8();
 
-  void configure(uint8_t *inputData, const Shape inputShape, uint8_t *weightsData,
-                 const Shape weightsShape, uint8_t *biasData, const Shape biasShape,
-                 FuseCode activation, uint8_t *outputData, const Shape outputShape);
+  void configure(::arm_compute::ITensor *input, const Shape inputShape,
+                 ::arm_compute::ITensor *weights, const Shape weightsShape,
+                 ::arm_compute::ITensor *bias, const Shape biasShape, FuseCode activation,
+                 ::arm_compute::ITensor *output, const Shape outputShape);
 
   void run();
 
 private:
-  uint8_t *_inputData;
-  uint8_t *_weightsData;
-  uint8_t *_biasData;
-  uint8_t *_outputData;
+  // Runs 'fn(begin, end)' for slices of output units in parallel
+  template <typename Fn> void forEachUnitSlice(Fn fn);
+
+private:
+  ::arm_compute::ITensor *_input;
+  ::arm_compute::ITensor *_weights;
+  ::arm_compute::ITensor *_bias;
+  ::arm_compute::ITensor *_output;
 
   Shape _inputShape;
   Shape _weightsShape;
@@ -60,6 +67,9 @@ private:
   FuseCode _activation;
 
   OperandType _inputType;
+
+  // Keeps the scratch memory of every thread while this kernel exists
+  ScratchArena::User _scratch_user;
 };
 
 } // namespace cpu
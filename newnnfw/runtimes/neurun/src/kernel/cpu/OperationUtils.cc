@@ -191,7 +191,7 @@ Shape getShape(const ::neurun::graph::operand::Object &o)
   shape.type = static_cast<OperandType>(static_cast<int32_t>(o.typeInfo().type()));
   shape.dimensions = std::vector<uint32_t>(o.shape().dims().begin(), o.shape().dims().end());
   shape.scale = o.typeInfo().scale();
-  // shape.offset = _offset;
+  shape.offset = o.typeInfo().offset();
 
   return shape;
 }
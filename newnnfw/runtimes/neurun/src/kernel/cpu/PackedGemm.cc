@@ -0,0 +1,323 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "PackedGemm.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace
+{
+
+using neurun::kernel::cpu::kPanelWidth;
+
+// Number of lhs rows that share a panel in the micro-kernel
+constexpr uint32_t kRowBlock = 4;
+
+// Depth of a K-slice of panels and lhs rows, so that a panel slice (kDepthTile x kPanelWidth
+// floats, 8KB) stays in L1 while all the rows of a tile go through it
+constexpr uint32_t kDepthTile = 256;
+
+// Number of lhs rows in a tile, so that a tile (kRowTile x kDepthTile floats, 64KB) stays in L2
+// while all the panels go through it
+constexpr uint32_t kRowTile = 64;
+
+// Where a micro-kernel starts from, and whether it writes the final output
+//
+// NOTE Outputs keep partial sums between K-slices, and activation is applied on the last one
+struct Slice
+{
+  bool first;
+  bool last;
+  float output_min;
+  float output_max;
+};
+
+// Writes the accumulators of a row into the output, applying activation on the last K-slice
+inline void storeRow(const float *acc, const Slice &slice, float *out)
+{
+  if (slice.last)
+  {
+    for (uint32_t j = 0; j < kPanelWidth; ++j)
+    {
+      out[j] = std::min(std::max(acc[j], slice.output_min), slice.output_max);
+    }
+  }
+  else
+  {
+    for (uint32_t j = 0; j < kPanelWidth; ++j)
+    {
+      out[j] = acc[j];
+    }
+  }
+}
+
+// kRowBlock rows x kPanelWidth units, which the compiler keeps in SIMD registers
+//
+// NOTE Rows are unrolled by hand, as compilers do not unroll them at -O2 and keep the
+//      accumulators in memory otherwise
+void fullBlock(const float *lhs, uint32_t lhs_stride, uint32_t depth, const float *panel,
+               const float *bias, const Slice &slice, float *out, uint32_t out_stride)
+{
+  static_assert(kRowBlock == 4, "fullBlock has 4 rows");
+
+  float acc0[kPanelWidth], acc1[kPanelWidth], acc2[kPanelWidth], acc3[kPanelWidth];
+
+  // NOTE Branches are kept out of the loops so that the compiler vectorizes them
+  const float *init = slice.first ? bias : out;
+  const uint32_t init_stride = slice.first ? 0 : out_stride;
+
+  for (uint32_t j = 0; j < kPanelWidth; ++j)
+  {
+    acc0[j] = init[j];
+    acc1[j] = init[init_stride + j];
+    acc2[j] = init[2 * init_stride + j];
+    acc3[j] = init[3 * init_stride + j];
+  }
+
+  const float *lhs0 = lhs;
+  const float *lhs1 = lhs + lhs_stride;
+  const float *lhs2 = lhs + 2 * lhs_stride;
+  const float *lhs3 = lhs + 3 * lhs_stride;
+
+  for (uint32_t k = 0; k < depth; ++k)
+  {
+    const float *w = panel + k * kPanelWidth;
+    const float a0 = lhs0[k];
+    const float a1 = lhs1[k];
+    const float a2 = lhs2[k];
+    const float a3 = lhs3[k];
+
+    // NOTE Each iteration updates both halves of the panel, so that the loop is a single step of
+    //      128-bit SIMD instructions and the accumulators stay in registers
+    for (uint32_t j = 0; j < kPanelWidth / 2; ++j)
+    {
+      const uint32_t h = j + kPanelWidth / 2;
+
+      acc0[j] += a0 * w[j];
+      acc0[h] += a0 * w[h];
+      acc1[j] += a1 * w[j];
+      acc1[h] += a1 * w[h];
+      acc2[j] += a2 * w[j];
+      acc2[h] += a2 * w[h];
+      acc3[j] += a3 * w[j];
+      acc3[h] += a3 * w[h];
+    }
+  }
+
+  storeRow(acc0, slice, out);
+  storeRow(acc1, slice, out + out_stride);
+  storeRow(acc2, slice, out + 2 * out_stride);
+  storeRow(acc3, slice, out + 3 * out_stride);
+}
+
+// A single row x kPanelWidth units, for the rows that do not fill a full block
+void fullRow(const float *lhs, uint32_t depth, const float *panel, const float *bias,
+             const Slice &slice, float *out)
+{
+  float acc[kPanelWidth];
+
+  const float *init = slice.first ? bias : out;
+
+  for (uint32_t j = 0; j < kPanelWidth; ++j)
+  {
+    acc[j] = init[j];
+  }
+
+  for (uint32_t k = 0; k < depth; ++k)
+  {
+    const float a = lhs[k];
+    const float *w = panel + k * kPanelWidth;
+
+    for (uint32_t j = 0; j < kPanelWidth; ++j)
+    {
+      acc[j] += a * w[j];
+    }
+  }
+
+  storeRow(acc, slice, out);
+}
+
+// A single row x 2 panels (of kPanelWidth units each), for the rows that do not fill a full block
+//
+// NOTE A single row reads weights as fast as memory gives them (e.g. GEMV of a batch of 1), and
+//      reading two panels at once keeps more memory requests in flight than one panel does
+void fullRowPair(const float *lhs, uint32_t depth, const float *panel0, const float *panel1,
+                 const float *bias, const Slice &slice, float *out)
+{
+  float acc0[kPanelWidth];
+  float acc1[kPanelWidth];
+
+  const float *init = slice.first ? bias : out;
+
+  for (uint32_t j = 0; j < kPanelWidth; ++j)
+  {
+    acc0[j] = init[j];
+    acc1[j] = init[kPanelWidth + j];
+  }
+
+  for (uint32_t k = 0; k < depth; ++k)
+  {
+    const float a = lhs[k];
+    const float *w0 = panel0 + k * kPanelWidth;
+    const float *w1 = panel1 + k * kPanelWidth;
+
+    // NOTE See fullBlock for why the halves of a panel are updated together
+    for (uint32_t j = 0; j < kPanelWidth / 2; ++j)
+    {
+      const uint32_t h = j + kPanelWidth / 2;
+
+      acc0[j] += a * w0[j];
+      acc0[h] += a * w0[h];
+      acc1[j] += a * w1[j];
+      acc1[h] += a * w1[h];
+    }
+  }
+
+  storeRow(acc0, slice, out);
+  storeRow(acc1, slice, out + kPanelWidth);
+}
+
+// A single row x 'width' units, for the last panel that does not have kPanelWidth units
+void partialBlock(const float *lhs, uint32_t depth, const float *panel, uint32_t width,
+                  const float *bias, const Slice &slice, float *out)
+{
+  float acc[kPanelWidth];
+
+  const float *init = slice.first ? bias : out;
+
+  for (uint32_t j = 0; j < width; ++j)
+  {
+    acc[j] = init[j];
+  }
+
+  for (uint32_t k = 0; k < depth; ++k)
+  {
+    const float a = lhs[k];
+    const float *w = panel + k * width;
+
+    for (uint32_t j = 0; j < width; ++j)
+    {
+      acc[j] += a * w[j];
+    }
+  }
+
+  for (uint32_t j = 0; j < width; ++j)
+  {
+    out[j] = slice.last ? std::min(std::max(acc[j], slice.output_min), slice.output_max) : acc[j];
+  }
+}
+
+} // namespace
+
+namespace neurun
+{
+namespace kernel
+{
+namespace cpu
+{
+
+void packWeights(const float *weights, uint32_t units, uint32_t depth, float *packed)
+{
+  for (uint32_t unit = 0; unit < units; unit += kPanelWidth)
+  {
+    const uint32_t width = std::min(kPanelWidth, units - unit);
+    float *panel = packed + unit * depth;
+
+    for (uint32_t k = 0; k < depth; ++k)
+    {
+      for (uint32_t j = 0; j < width; ++j)
+      {
+        panel[k * width + j] = weights[(unit + j) * depth + k];
+      }
+    }
+  }
+}
+
+void gemmPacked(const float *lhs, uint32_t rows, uint32_t depth, const float *packed,
+                uint32_t units, const float *bias, float output_min, float output_max, float *out,
+                uint32_t unit_begin, uint32_t unit_end)
+{
+  assert(unit_begin % kPanelWidth == 0);
+
+  // NOTE The K-slice of a panel is contiguous as a panel interleaves its units along depth, so
+  //      the slice [k0, k0 + k_count) of the panel of 'unit' begins at 'panel + k0 * width'
+  for (uint32_t k0 = 0; k0 < depth; k0 += kDepthTile)
+  {
+    const uint32_t k_count = std::min(kDepthTile, depth - k0);
+    const Slice slice{k0 == 0, k0 + k_count == depth, output_min, output_max};
+
+    for (uint32_t row0 = 0; row0 < rows; row0 += kRowTile)
+    {
+      const uint32_t row_end = std::min(rows, row0 + kRowTile);
+      const uint32_t block_end = row0 + (row_end - row0) / kRowBlock * kRowBlock;
+
+      // NOTE Rows are in the inner loop so that a panel slice is read from memory once for all
+      //      rows of a tile
+      for (uint32_t unit = unit_begin; unit + kPanelWidth <= unit_end; unit += kPanelWidth)
+      {
+        const float *panel = packed + unit * depth + k0 * kPanelWidth;
+
+        for (uint32_t row = row0; row < block_end; row += kRowBlock)
+        {
+          fullBlock(lhs + row * depth + k0, depth, k_count, panel, bias + unit, slice,
+                    out + row * units + unit, units);
+        }
+      }
+
+      // The rows that do not fill a block, and the last panel if it does not have kPanelWidth
+      // units
+      for (uint32_t unit = unit_begin; unit < unit_end;)
+      {
+        const uint32_t width = std::min(kPanelWidth, units - unit);
+        const float *panel = packed + unit * depth + k0 * width;
+
+        if (width < kPanelWidth)
+        {
+          for (uint32_t row = row0; row < row_end; ++row)
+          {
+            partialBlock(lhs + row * depth + k0, k_count, panel, width, bias + unit, slice,
+                         out + row * units + unit);
+          }
+          unit += width;
+        }
+        else if (unit + 2 * kPanelWidth <= unit_end)
+        {
+          for (uint32_t row = block_end; row < row_end; ++row)
+          {
+            fullRowPair(lhs + row * depth + k0, k_count, panel, panel + kPanelWidth * depth,
+                        bias + unit, slice, out + row * units + unit);
+          }
+          unit += 2 * kPanelWidth;
+        }
+        else
+        {
+          for (uint32_t row = block_end; row < row_end; ++row)
+          {
+            fullRow(lhs + row * depth + k0, k_count, panel, bias + unit, slice,
+                    out + row * units + unit);
+          }
+          unit += kPanelWidth;
+        }
+      }
+    }
+  }
+}
+
+} // namespace cpu
+} // namespace kernel
+} // namespace neurun
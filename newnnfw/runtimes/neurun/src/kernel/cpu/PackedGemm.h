@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef __NEURUN_KERNEL_CPU_PACKED_GEMM_H__
+#define __NEURUN_KERNEL_CPU_PACKED_GEMM_H__
+
+#include <cstdint>
+
+namespace neurun
+{
+namespace kernel
+{
+namespace cpu
+{
+
+// Number of output units in a panel of packed weights (two 128-bit or one 256-bit SIMD register)
+static constexpr uint32_t kPanelWidth = 8;
+
+// Packs row-major weights of shape [units, depth] into panels
+//
+// A panel holds 'kPanelWidth' consecutive units, and interleaves their weights along depth:
+//
+//   packed[(p * kPanelWidth) * depth + k * width + j] = weights[(p * kPanelWidth + j) * depth + k]
+//
+// where 'width' is kPanelWidth but for the last panel, which keeps only the remaining units.
+// Thus packed weights are as large as the original ones, and the weights of 'unit' (a multiple
+// of kPanelWidth) begin at 'packed + unit * depth'.
+void packWeights(const float *weights, uint32_t units, uint32_t depth, float *packed);
+
+// Computes output units [unit_begin, unit_end) of 'out = clamp(lhs * weights^T + bias)'
+//
+//   - 'lhs' is row-major of shape [rows, depth]
+//   - 'packed' is weights packed by packWeights
+//   - 'out' is row-major of shape [rows, units]
+//
+// NOTE 'unit_begin' should be a multiple of kPanelWidth
+void gemmPacked(const float *lhs, uint32_t rows, uint32_t depth, const float *packed,
+                uint32_t units, const float *bias, float output_min, float output_max, float *out,
+                uint32_t unit_begin, uint32_t unit_end);
+
+} // namespace cpu
+} // namespace kernel
+} // namespace neurun
+
+#endif // __NEURUN_KERNEL_CPU_PACKED_GEMM_H__
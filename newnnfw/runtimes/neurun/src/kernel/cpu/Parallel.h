@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef __NEURUN_KERNEL_CPU_PARALLEL_H__
+#define __NEURUN_KERNEL_CPU_PARALLEL_H__
+
+#include <algorithm>
+#include <cstdint>
+
+#include "kernel/cpu/Scheduler.h"
+
+namespace neurun
+{
+namespace kernel
+{
+namespace cpu
+{
+
+// Minimum amount of work (# of multiply-accumulates) worth running on another thread
+static constexpr uint64_t kMinWorkPerSlice = 1 << 16;
+
+// Splits [0, extent) into slices and runs 'fn(begin, end)' for each slice on the scheduler of the
+// calling thread
+//
+// 'work' is the amount of work per item. Every slice but the last has a multiple of 'align' items.
+template <typename Fn> void parallelFor(uint32_t extent, uint64_t work, uint32_t align, Fn fn)
+{
+  const auto &scheduler = currentScheduler();
+
+  const uint64_t max_slices = std::max<uint64_t>(extent * work / kMinWorkPerSlice, 1);
+  const uint32_t slices = std::min<uint64_t>(scheduler.concurrency(), max_slices);
+
+  uint32_t step = (extent + slices - 1) / slices;
+  step = (step + align - 1) / align * align;
+
+  if (step >= extent)
+  {
+    fn(0, extent);
+    return;
+  }
+
+  const uint32_t count = (extent + step - 1) / step;
+
+  scheduler.parallel(count, [&](uint32_t n) {
+    const uint32_t begin = n * step;
+    const uint32_t end = std::min(begin + step, extent);
+    fn(begin, end);
+  });
+}
+
+} // namespace cpu
+} // namespace kernel
+} // namespace neurun
+
+#endif // __NEURUN_KERNEL_CPU_PARALLEL_H__
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PermuteLayer.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+namespace neurun
+{
+namespace kernel
+{
+namespace cpu
+{
+
+using Type = graph::operation::Permute::Type;
+
+PermuteLayer::PermuteLayer()
+    : _input(nullptr), _output(nullptr), _shape(), _type(Type::COPY)
+{
+  // DO NOTHING
+}
+
+void PermuteLayer::configure(const std::shared_ptr<backend::operand::IObject> &input,
+                             const std::shared_ptr<backend::operand::IObject> &output,
+                             const Shape &shape, graph::operation::Permute::Type type)
+{
+  _input = input;
+  _output = output;
+  _shape = shape;
+  _type = type;
+}
+
+void PermuteLayer::permute(const ::arm_compute::ITensor &input,
+                           ::arm_compute::ITensor &output) const
+{
+  const auto element_size = input.info()->element_size();
+  assert(output.info()->element_size() == element_size);
+
+  if (_type == Type::COPY)
+  {
+    // NOTE Both tensors address their elements in the same way, but may have different paddings
+    const auto &shape = input.info()->tensor_shape();
+
+    for (uint32_t n = 0; n < std::max<size_t>(shape[3], 1); ++n)
+    {
+      for (uint32_t c = 0; c < std::max<size_t>(shape[2], 1); ++c)
+      {
+        for (uint32_t h = 0; h < std::max<size_t>(shape[1], 1); ++h)
+        {
+          for (uint32_t w = 0; w < std::max<size_t>(shape[0], 1); ++w)
+          {
+            const ::arm_compute::Coordinates coordinate{w, h, c, n};
+            std::memcpy(output.buffer() + output.info()->offset_element_in_bytes(coordinate),
+                        input.buffer() + input.info()->offset_element_in_bytes(coordinate),
+                        element_size);
+          }
+        }
+      }
+    }
+    return;
+  }
+
+  // The tensor in NHWC is a dense buffer, and the one in NCHW is addressed by ACL coordinates
+  assert(_shape.dimensions.size() == 4);
+  const auto batch = _shape.dimensions[0];
+  const auto height = _shape.dimensions[1];
+  const auto width = _shape.dimensions[2];
+  const auto depth = _shape.dimensions[3];
+
+  const bool from_nhwc = (_type == Type::NHWC_TO_NCHW);
+  const auto &nchw = from_nhwc ? output : input;
+  uint8_t *const nhwc_base = from_nhwc ? input.buffer() : output.buffer();
+
+  for (uint32_t n = 0; n < batch; ++n)
+  {
+    for (uint32_t h = 0; h < height; ++h)
+    {
+      for (uint32_t w = 0; w < width; ++w)
+      {
+        // Elements over depth are contiguous in NHWC
+        uint8_t *nhwc_ptr = nhwc_base + (((n * height + h) * width + w) * depth) * element_size;
+
+        for (uint32_t c = 0; c < depth; ++c, nhwc_ptr += element_size)
+        {
+          uint8_t *nchw_ptr =
+              nchw.buffer() +
+              nchw.info()->offset_element_in_bytes(::arm_compute::Coordinates{w, h, c, n});
+
+          if (from_nhwc)
+          {
+            std::memcpy(nchw_ptr, nhwc_ptr, element_size);
+          }
+          else
+          {
+            std::memcpy(nhwc_ptr, nchw_ptr, element_size);
+          }
+        }
+      }
+    }
+  }
+}
+
+void PermuteLayer::run()
+{
+  _input->access([&](::arm_compute::ITensor &input) {
+    _output->access([&](::arm_compute::ITensor &output) { permute(input, output); });
+  });
+}
+
+} // namespace cpu
+} // namespace kernel
+} // namespace neurun
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NEURUN_KERNEL_CPU_PERMUTE_LAYER_H__
+#define __NEURUN_KERNEL_CPU_PERMUTE_LAYER_H__
+
+#include <memory>
+
+#include <arm_compute/core/ITensor.h>
+#include <arm_compute/runtime/IFunction.h>
+
+#include "backend/IObject.h"
+#include "graph/operation/Permute.h"
+#include "kernel/cpu/OperationUtils.h"
+
+namespace neurun
+{
+namespace kernel
+{
+namespace cpu
+{
+
+// Copies an operand from the tensor of a backend into the tensor of another backend
+//
+// NOTE Tensors are accessed through objects as the tensor of a backend (e.g. OpenCL buffer) may
+//      need to be mapped on the host memory first
+class PermuteLayer : public ::arm_compute::IFunction
+{
+public:
+  PermuteLayer();
+
+public:
+  void configure(const std::shared_ptr<backend::operand::IObject> &input,
+                 const std::shared_ptr<backend::operand::IObject> &output, const Shape &shape,
+                 graph::operation::Permute::Type type);
+
+  void run();
+
+private:
+  void permute(const ::arm_compute::ITensor &input, ::arm_compute::ITensor &output) const;
+
+private:
+  std::shared_ptr<backend::operand::IObject> _input;
+  std::shared_ptr<backend::operand::IObject> _output;
+
+  Shape _shape;
+  graph::operation::Permute::Type _type;
+};
+
+} // namespace cpu
+} // namespace kernel
+} // namespace neurun
+
+#endif // __NEURUN_KERNEL_CPU_PERMUTE_LAYER_H__
@@ -28,8 +28,7 @@ namespace kernel
 namespace cpu
 {
 
-ReshapeLayer::ReshapeLayer()
-    : _inputData(nullptr), _outputData(nullptr), _inputShape(), _outputShape()
+ReshapeLayer::ReshapeLayer() : _input(nullptr), _output(nullptr), _inputShape(), _outputShape()
 {
   // DO NOTHING
 }
@@ -37,20 +36,30 @@ ReshapeLayer::ReshapeLayer()
 bool ReshapeLayer::reshapeGeneric()
 {
   size_t count = sizeOfData(_inputShape.type, _inputShape.dimensions);
-  memcpy(reinterpret_cast<void *>(_outputData), reinterpret_cast<const void *>(_inputData), count);
+  memcpy(reinterpret_cast<void *>(_output->buffer()),
+         reinterpret_cast<const void *>(_input->buffer()), count);
   return true;
 }
 
-void ReshapeLayer::configure(uint8_t *inputData, const Shape &inputShape, uint8_t *outputData,
-                             const Shape &outputShape)
+void ReshapeLayer::configure(::arm_compute::ITensor *input, const Shape &inputShape,
+                             ::arm_compute::ITensor *output, const Shape &outputShape)
 {
-  _inputData = inputData;
+  _input = input;
   _inputShape = inputShape;
-  _outputData = outputData;
+  _output = output;
   _outputShape = outputShape;
 }
 
-void ReshapeLayer::run() { reshapeGeneric(); }
+void ReshapeLayer::run()
+{
+  // NOTE The output may live in the buffer of the input (see linear::AliasAnalysis)
+  if (_output->buffer() == _input->buffer())
+  {
+    return;
+  }
+
+  reshapeGeneric();
+}
 
 } // namespace cpu
 } // namespace kernel
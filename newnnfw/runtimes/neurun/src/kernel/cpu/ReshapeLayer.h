@@ -19,6 +19,7 @@
 
 #include <NeuralNetworks.h>
 
+#include <arm_compute/core/ITensor.h>
 #include <arm_compute/runtime/IFunction.h>
 
 #include "kernel/cpu/OperationUtils.h"
@@ -38,14 +39,14 @@ public:
 public:
   bool reshapeGeneric();
 
-  void configure(uint8_t *inputData, const Shape &inputShape, uint8_t *outputData,
-                 const Shape &outputShape);
+  void configure(::arm_compute::ITensor *input, const Shape &inputShape,
+                 ::arm_compute::ITensor *output, const Shape &outputShape);
 
   void run();
 
 private:
-  uint8_t *_inputData;
-  uint8_t *_outputData;
+  ::arm_compute::ITensor *_input;
+  ::arm_compute::ITensor *_output;
 
   Shape _inputShape;
   Shape _outputShape;
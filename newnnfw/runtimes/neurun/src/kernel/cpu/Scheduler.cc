@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Scheduler.h"
+
+namespace
+{
+
+// Runs every slice on the calling thread
+class SequentialScheduler final : public neurun::kernel::cpu::IScheduler
+{
+public:
+  uint32_t concurrency(void) const override { return 1; }
+
+  void parallel(uint32_t count, const std::function<void(uint32_t)> &fn) const override
+  {
+    for (uint32_t n = 0; n < count; ++n)
+    {
+      fn(n);
+    }
+  }
+
+  uint32_t winogradTile(void) const override { return 0; }
+};
+
+// The scheduler of the current thread (nullptr means the sequential one)
+thread_local const neurun::kernel::cpu::IScheduler *current_scheduler = nullptr;
+
+} // namespace
+
+namespace neurun
+{
+namespace kernel
+{
+namespace cpu
+{
+
+const IScheduler &currentScheduler(void)
+{
+  static const SequentialScheduler sequential;
+
+  if (current_scheduler == nullptr)
+  {
+    return sequential;
+  }
+
+  return *current_scheduler;
+}
+
+const IScheduler *setCurrentScheduler(const IScheduler *scheduler)
+{
+  const auto prev = current_scheduler;
+  current_scheduler = scheduler;
+  return prev;
+}
+
+} // namespace cpu
+} // namespace kernel
+} // namespace neurun
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NEURUN_KERNEL_CPU_SCHEDULER_H__
+#define __NEURUN_KERNEL_CPU_SCHEDULER_H__
+
+#include <cstdint>
+#include <functional>
+
+namespace neurun
+{
+namespace kernel
+{
+namespace cpu
+{
+
+// Threads that CPU kernels run their slices on
+//
+// NOTE The runtime provides the scheduler of each thread (see exec::SchedulingProfile). Kernels
+//      run every slice on the calling thread if none is set.
+struct IScheduler
+{
+  virtual ~IScheduler() = default;
+
+  // Number of threads that slices run on
+  virtual uint32_t concurrency(void) const = 0;
+  // Runs 'fn(n)' for every n in [0, count), and returns when all of them are done
+  virtual void parallel(uint32_t count, const std::function<void(uint32_t)> &fn) const = 0;
+  // Size of Winograd output tiles, or 0 to choose it per convolution
+  virtual uint32_t winogradTile(void) const = 0;
+};
+
+// Returns the scheduler of the calling thread
+const IScheduler &currentScheduler(void);
+
+// Sets the scheduler of the calling thread (nullptr for the sequential one), and returns the
+// previous one
+const IScheduler *setCurrentScheduler(const IScheduler *scheduler);
+
+} // namespace cpu
+} // namespace kernel
+} // namespace neurun
+
+#endif // __NEURUN_KERNEL_CPU_SCHEDULER_H__
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ScratchArena.h"
+
+#include <cassert>
+#include <mutex>
+#include <set>
+
+namespace
+{
+
+// Arenas of live threads, and the number of live users
+struct Registry
+{
+  std::mutex mutex;
+  std::set<neurun::kernel::cpu::ScratchArena *> arenas;
+  uint32_t users = 0;
+};
+
+Registry &registry(void)
+{
+  // NOTE This is never destroyed, as threads may exit after static objects are destroyed
+  static Registry *registry = new Registry;
+  return *registry;
+}
+
+} // namespace
+
+namespace neurun
+{
+namespace kernel
+{
+namespace cpu
+{
+
+ScratchArena &ScratchArena::local(void)
+{
+  static thread_local ScratchArena arena;
+  return arena;
+}
+
+ScratchArena::User::User()
+{
+  auto &r = registry();
+  std::lock_guard<std::mutex> lock{r.mutex};
+
+  ++r.users;
+}
+
+ScratchArena::User::~User()
+{
+  auto &r = registry();
+  std::lock_guard<std::mutex> lock{r.mutex};
+
+  assert(r.users > 0);
+  if (--r.users == 0)
+  {
+    for (auto arena : r.arenas)
+    {
+      arena->release();
+    }
+  }
+}
+
+ScratchArena::ScratchArena()
+{
+  auto &r = registry();
+  std::lock_guard<std::mutex> lock{r.mutex};
+
+  r.arenas.insert(this);
+}
+
+ScratchArena::~ScratchArena()
+{
+  auto &r = registry();
+  std::lock_guard<std::mutex> lock{r.mutex};
+
+  r.arenas.erase(this);
+}
+
+uint8_t *ScratchArena::get(size_t size)
+{
+  if (size > _capacity)
+  {
+    _buffer.reset(new uint8_t[size]);
+    _capacity = size;
+  }
+
+  return _buffer.get();
+}
+
+gemmlowp::GemmContext &ScratchArena::gemm_context(void)
+{
+  if (_gemm_context == nullptr)
+  {
+    _gemm_context.reset(new gemmlowp::GemmContext);
+  }
+
+  return *_gemm_context;
+}
+
+void ScratchArena::release(void)
+{
+  _buffer.reset();
+  _capacity = 0;
+  _gemm_context.reset();
+}
+
+} // namespace cpu
+} // namespace kernel
+} // namespace neurun
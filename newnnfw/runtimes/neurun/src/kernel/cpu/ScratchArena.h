@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NEURUN_KERNEL_CPU_SCRATCH_ARENA_H__
+#define __NEURUN_KERNEL_CPU_SCRATCH_ARENA_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "public/gemmlowp.h"
+
+namespace neurun
+{
+namespace kernel
+{
+namespace cpu
+{
+
+// Per-thread scratch memory (im2col buffer, GEMM context) for CPU kernels
+//
+// An arena grows to the largest size requested on its thread (e.g. the im2col buffer of the
+// largest slice that the thread runs), so run() allocates nothing on the heap once a thread has
+// warmed up, and kernels running on different threads never share scratch memory.
+//
+// Kernels that use an arena hold a ScratchArena::User. The arenas of every thread are released
+// when the last user is destroyed, that is, when the last plan with such kernels is freed.
+class ScratchArena
+{
+public:
+  // Returns the arena of the calling thread
+  static ScratchArena &local(void);
+
+public:
+  class User
+  {
+  public:
+    User();
+    ~User();
+
+  public:
+    User(const User &) = delete;
+    User &operator=(const User &) = delete;
+  };
+
+public:
+  ScratchArena();
+  ~ScratchArena();
+
+public:
+  ScratchArena(const ScratchArena &) = delete;
+  ScratchArena &operator=(const ScratchArena &) = delete;
+
+public:
+  // Returns a buffer of at least 'size' bytes, which is valid until the next get() on this thread
+  uint8_t *get(size_t size);
+
+  gemmlowp::GemmContext &gemm_context(void);
+
+public:
+  size_t capacity(void) const { return _capacity; }
+
+private:
+  // NOTE This is called only when no kernel may run (see User)
+  void release(void);
+
+private:
+  std::unique_ptr<uint8_t[]> _buffer;
+  size_t _capacity = 0;
+  std::unique_ptr<gemmlowp::GemmContext> _gemm_context;
+};
+
+} // namespace cpu
+} // namespace kernel
+} // namespace neurun
+
+#endif // __NEURUN_KERNEL_CPU_SCRATCH_ARENA_H__
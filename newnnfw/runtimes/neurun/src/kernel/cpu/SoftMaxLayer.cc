@@ -27,7 +27,7 @@ namespace cpu
 {
 
 SoftMaxLayer::SoftMaxLayer()
-    : _inputData(nullptr), _outputData(nullptr), _beta(0.0), _inputShape(), _outputShape(),
+    : _input(nullptr), _output(nullptr), _beta(0.0), _inputShape(), _outputShape(),
       _inputType(OperandType::SCALAR_FLOAT32)
 {
   // DO NOTHING
@@ -53,8 +53,8 @@ bool SoftMaxLayer::softmaxFloat32()
     std::cout << "only 2D and 4D tensors supported" << std::endl;
     return false;
   }
-  ::tflite::optimized_ops::Softmax(reinterpret_cast<const float *>(_inputData), dim, _beta,
-                                   reinterpret_cast<float *>(_outputData), dim);
+  ::tflite::optimized_ops::Softmax(reinterpret_cast<const float *>(_input->buffer()), dim, _beta,
+                                   reinterpret_cast<float *>(_output->buffer()), dim);
   return true;
 }
 
@@ -94,18 +94,19 @@ bool SoftMaxLayer::softmaxQuant8()
     return false;
   }
   float diff_min = -1.0f * CalculateInputRadius(kScaledDiffIntegerBits, input_left_shift);
-  ::tflite::optimized_ops::Softmax(_inputData, dim, input_multiplier, input_left_shift, diff_min,
-                                   _outputData, dim);
+  ::tflite::optimized_ops::Softmax(_input->buffer(), dim, input_multiplier, input_left_shift,
+                                   diff_min, _output->buffer(), dim);
   return true;
 }
 
-void SoftMaxLayer::configure(uint8_t *inputData, const Shape &inputShape, const float beta,
-                             uint8_t *outputData, const Shape &outputShape)
+void SoftMaxLayer::configure(::arm_compute::ITensor *input, const Shape &inputShape,
+                             const float beta, ::arm_compute::ITensor *output,
+                             const Shape &outputShape)
 {
-  _inputData = inputData;
+  _input = input;
   _inputShape = inputShape;
   _inputType = inputShape.type;
-  _outputData = outputData;
+  _output = output;
   _outputShape = outputShape;
   _beta = beta;
 }
@@ -118,8 +119,7 @@ void SoftMaxLayer::run()
   }
   else if (_inputType == OperandType::TENSOR_QUANT8_ASYMM)
   {
-    throw std::runtime_error{"SoftMaxLayer : Not tested for TENSOR_QUANT8_ASYMM"};
-    // softmaxQuant8();
+    softmaxQuant8();
   }
 }
 
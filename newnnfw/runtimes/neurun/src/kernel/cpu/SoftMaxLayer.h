@@ -19,6 +19,7 @@
 
 #include <NeuralNetworks.h>
 
+#include <arm_compute/core/ITensor.h>
 #include <arm_compute/runtime/IFunction.h>
 
 #include "kernel/cpu/OperationUtils.h"
@@ -40,14 +41,14 @@ public:
 
   bool softmaxQuant8();
 
-  void configure(uint8_t *inputData, const Shape &inputShape, const float beta, uint8_t *outputData,
-                 const Shape &outputShape);
+  void configure(::arm_compute::ITensor *input, const Shape &inputShape, const float beta,
+                 ::arm_compute::ITensor *output, const Shape &outputShape);
 
   void run();
 
 private:
-  uint8_t *_inputData;
-  uint8_t *_outputData;
+  ::arm_compute::ITensor *_input;
+  ::arm_compute::ITensor *_output;
 
   float _beta;
 
@@ -0,0 +1,430 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "WinogradConvolutionLayer.h"
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+
+#include "kernel/cpu/PackedGemm.h"
+#include "kernel/cpu/Parallel.h"
+#include "kernel/cpu/Scheduler.h"
+#include "util/EnvVar.h"
+
+namespace
+{
+
+// Transform matrices of F(MxM, 3x3) with input tiles of T x T (T = M + 2)
+//
+//   Y = AT * [(G * g * GT) .* (BT * d * B)] * A
+//
+// See "Fast Algorithms for Convolutional Neural Networks" (Lavin and Gray, 2015)
+template <uint32_t M> struct Transform;
+
+template <> struct Transform<2>
+{
+  static constexpr uint32_t T = 4;
+  static const float BT[4][4];
+  static const float G[4][3];
+  static const float AT[2][4];
+};
+
+const float Transform<2>::BT[4][4] = {
+    {1.0f, 0.0f, -1.0f, 0.0f}, {0.0f, 1.0f, 1.0f, 0.0f}, {0.0f, -1.0f, 1.0f, 0.0f},
+    {0.0f, 1.0f, 0.0f, -1.0f}};
+const float Transform<2>::G[4][3] = {
+    {1.0f, 0.0f, 0.0f}, {0.5f, 0.5f, 0.5f}, {0.5f, -0.5f, 0.5f}, {0.0f, 0.0f, 1.0f}};
+const float Transform<2>::AT[2][4] = {{1.0f, 1.0f, 1.0f, 0.0f}, {0.0f, 1.0f, -1.0f, -1.0f}};
+
+template <> struct Transform<4>
+{
+  static constexpr uint32_t T = 6;
+  static const float BT[6][6];
+  static const float G[6][3];
+  static const float AT[4][6];
+};
+
+const float Transform<4>::BT[6][6] = {
+    {4.0f, 0.0f, -5.0f, 0.0f, 1.0f, 0.0f},  {0.0f, -4.0f, -4.0f, 1.0f, 1.0f, 0.0f},
+    {0.0f, 4.0f, -4.0f, -1.0f, 1.0f, 0.0f}, {0.0f, -2.0f, -1.0f, 2.0f, 1.0f, 0.0f},
+    {0.0f, 2.0f, -1.0f, -2.0f, 1.0f, 0.0f}, {0.0f, 4.0f, 0.0f, -5.0f, 0.0f, 1.0f}};
+const float Transform<4>::G[6][3] = {{1.0f / 4, 0.0f, 0.0f},
+                                     {-1.0f / 6, -1.0f / 6, -1.0f / 6},
+                                     {-1.0f / 6, 1.0f / 6, -1.0f / 6},
+                                     {1.0f / 24, 1.0f / 12, 1.0f / 6},
+                                     {1.0f / 24, -1.0f / 12, 1.0f / 6},
+                                     {0.0f, 0.0f, 1.0f}};
+const float Transform<4>::AT[4][6] = {{1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 0.0f},
+                                      {0.0f, 1.0f, -1.0f, 2.0f, -2.0f, 0.0f},
+                                      {0.0f, 1.0f, 1.0f, 4.0f, 4.0f, 0.0f},
+                                      {0.0f, 1.0f, -1.0f, 8.0f, -8.0f, 1.0f}};
+
+// Number of floats of scratch memory for 'tiles' tiles
+uint32_t scratchSize(uint32_t tile, uint32_t tiles, uint32_t inDepth, uint32_t outDepth)
+{
+  const uint32_t T = tile + 2;
+
+  // Input patch and its half transform, transformed inputs and outputs, and half output transform
+  return 2 * T * T * inDepth + T * T * tiles * (inDepth + outDepth) + tile * T * outDepth;
+}
+
+} // namespace
+
+namespace neurun
+{
+namespace kernel
+{
+namespace cpu
+{
+
+const std::string &WinogradConvolutionLayer::mode(void)
+{
+  static const std::string value = nnfw::util::EnvVar{"NEURUN_CPU_WINOGRAD"}.asString("auto");
+  return value;
+}
+
+bool WinogradConvolutionLayer::isSupported(OperandType type, uint32_t kernelHeight,
+                                           uint32_t kernelWidth, uint32_t strideHeight,
+                                           uint32_t strideWidth)
+{
+  if (mode() == "off")
+  {
+    return false;
+  }
+
+  return type == OperandType::TENSOR_FLOAT32 && kernelHeight == 3 && kernelWidth == 3 &&
+         strideHeight == 1 && strideWidth == 1;
+}
+
+uint32_t WinogradConvolutionLayer::selectTile(uint32_t outHeight, uint32_t outWidth)
+{
+  const auto &tile = mode();
+
+  if (tile == "2x2")
+  {
+    return 2;
+  }
+  if (tile == "4x4")
+  {
+    return 4;
+  }
+
+  // The scheduler may prefer a tile (e.g. LOW_POWER prefers smaller transforms)
+  const auto preferred = currentScheduler().winogradTile();
+  if (preferred != 0)
+  {
+    return preferred;
+  }
+
+  // NOTE 4x4 tiles need fewer multiplications per output (2.25 vs 4), but waste more work on
+  //      partial tiles. Compare the multiplications of the whole output, and prefer 2x2 tiles
+  //      on a tie as their transforms are cheaper and more accurate.
+  auto multiplications = [&](uint32_t tile) {
+    const uint32_t size = tile + 2;
+    return ((outHeight + tile - 1) / tile) * ((outWidth + tile - 1) / tile) * size * size;
+  };
+
+  return (multiplications(4) < multiplications(2)) ? 4 : 2;
+}
+
+WinogradConvolutionLayer::WinogradConvolutionLayer()
+    : _input(nullptr), _kernel(nullptr), _bias(nullptr), _output(nullptr), _inputShape(),
+      _kernelShape(), _biasShape(), _outputShape(), _paddingLeft(0), _paddingTop(0),
+      _activation(ANEURALNETWORKS_FUSED_NONE), _tile(2), _prepared(false)
+{
+  // DO NOTHING
+}
+
+void WinogradConvolutionLayer::configure(::arm_compute::ITensor *input, const Shape inputShape,
+                                         ::arm_compute::ITensor *kernel, const Shape kernelShape,
+                                         ::arm_compute::ITensor *bias, const Shape biasShape,
+                                         const uint32_t paddingLeft, const uint32_t paddingTop,
+                                         const FuseCode activation, ::arm_compute::ITensor *output,
+                                         const Shape outputShape, const uint32_t tile)
+{
+  assert(tile == 2 || tile == 4);
+
+  _input = input;
+  _inputShape = inputShape;
+  _kernel = kernel;
+  _kernelShape = kernelShape;
+  _bias = bias;
+  _biasShape = biasShape;
+  _paddingLeft = paddingLeft;
+  _paddingTop = paddingTop;
+  _activation = activation;
+  _output = output;
+  _outputShape = outputShape;
+  _tile = tile;
+}
+
+void WinogradConvolutionLayer::prepare()
+{
+  if (_prepared)
+  {
+    return;
+  }
+
+  if (_tile == 2)
+  {
+    transformKernel<2>();
+  }
+  else
+  {
+    transformKernel<4>();
+  }
+
+  _prepared = true;
+}
+
+void WinogradConvolutionLayer::run()
+{
+  // NOTE prepare() is called at compile time usually, but run() should work without it
+  prepare();
+
+  if (_tile == 2)
+  {
+    convFloat32<2>();
+  }
+  else
+  {
+    convFloat32<4>();
+  }
+}
+
+template <uint32_t M> void WinogradConvolutionLayer::transformKernel(void)
+{
+  using TF = Transform<M>;
+  const uint32_t T = TF::T;
+
+  const uint32_t outDepth = getSizeOfDimension(_kernelShape, 0);
+  const uint32_t inDepth = getSizeOfDimension(_kernelShape, 3);
+  const auto kernelData = reinterpret_cast<const float *>(_kernel->buffer());
+
+  // [T * T, OC, IC] before packing
+  std::vector<float> transformed(T * T * outDepth * inDepth);
+
+  for (uint32_t oc = 0; oc < outDepth; ++oc)
+  {
+    for (uint32_t ic = 0; ic < inDepth; ++ic)
+    {
+      // tmp = G * g
+      float tmp[T][3];
+      for (uint32_t i = 0; i < T; ++i)
+      {
+        for (uint32_t j = 0; j < 3; ++j)
+        {
+          float sum = 0.0f;
+          for (uint32_t k = 0; k < 3; ++k)
+          {
+            sum += TF::G[i][k] * kernelData[((oc * 3 + k) * 3 + j) * inDepth + ic];
+          }
+          tmp[i][j] = sum;
+        }
+      }
+
+      // u = tmp * GT
+      for (uint32_t i = 0; i < T; ++i)
+      {
+        for (uint32_t j = 0; j < T; ++j)
+        {
+          float sum = 0.0f;
+          for (uint32_t k = 0; k < 3; ++k)
+          {
+            sum += tmp[i][k] * TF::G[j][k];
+          }
+          transformed[((i * T + j) * outDepth + oc) * inDepth + ic] = sum;
+        }
+      }
+    }
+  }
+
+  _transformed.resize(transformed.size());
+  for (uint32_t p = 0; p < T * T; ++p)
+  {
+    packWeights(transformed.data() + p * outDepth * inDepth, outDepth, inDepth,
+                _transformed.data() + p * outDepth * inDepth);
+  }
+
+  _zeros.assign(outDepth, 0.0f);
+}
+
+template <uint32_t M> void WinogradConvolutionLayer::convFloat32(void)
+{
+  using TF = Transform<M>;
+  const uint32_t T = TF::T;
+
+  const uint32_t batches = getSizeOfDimension(_inputShape, 0);
+  const uint32_t height = getSizeOfDimension(_inputShape, 1);
+  const uint32_t width = getSizeOfDimension(_inputShape, 2);
+  const uint32_t inDepth = getSizeOfDimension(_inputShape, 3);
+  const uint32_t outHeight = getSizeOfDimension(_outputShape, 1);
+  const uint32_t outWidth = getSizeOfDimension(_outputShape, 2);
+  const uint32_t outDepth = getSizeOfDimension(_outputShape, 3);
+
+  const uint32_t tilesHeight = (outHeight + M - 1) / M;
+  const uint32_t tilesWidth = (outWidth + M - 1) / M;
+
+  float output_activation_min, output_activation_max;
+  CalculateActivationRangeFloat(_activation, &output_activation_min, &output_activation_max);
+
+  const auto inputData = reinterpret_cast<const float *>(_input->buffer());
+  const auto biasData = reinterpret_cast<const float *>(_bias->buffer());
+  const auto outputData = reinterpret_cast<float *>(_output->buffer());
+  const uint64_t macsPerTileRow = tilesWidth * T * T * inDepth * outDepth;
+
+  // Rows of tiles are split across threads, each of which has its own scratch memory
+  for (uint32_t b = 0; b < batches; ++b)
+  {
+    const float *input = inputData + b * height * width * inDepth;
+    float *output = outputData + b * outHeight * outWidth * outDepth;
+
+    parallelFor(tilesHeight, macsPerTileRow, 1, [&](uint32_t rowBegin, uint32_t rowEnd) {
+      const uint32_t tiles = (rowEnd - rowBegin) * tilesWidth;
+
+      auto scratch = reinterpret_cast<float *>(ScratchArena::local().get(
+          sizeof(float) * scratchSize(M, tiles, inDepth, outDepth)));
+
+      float *patch = scratch;                                   // [T, T, IC]
+      float *half = patch + T * T * inDepth;                    // [T, T, IC]
+      float *inputTiles = half + T * T * inDepth;               // [T * T, tiles, IC]
+      float *outputTiles = inputTiles + T * T * tiles * inDepth; // [T * T, tiles, OC]
+      float *outputHalf = outputTiles + T * T * tiles * outDepth; // [M, T, OC]
+
+      // Input transform: BT * d * B for each tile
+      for (uint32_t t = 0; t < tiles; ++t)
+      {
+        const int32_t originY = static_cast<int32_t>((rowBegin + t / tilesWidth) * M - _paddingTop);
+        const int32_t originX = static_cast<int32_t>((t % tilesWidth) * M - _paddingLeft);
+
+        for (uint32_t i = 0; i < T; ++i)
+        {
+          for (uint32_t j = 0; j < T; ++j)
+          {
+            const int32_t y = originY + i;
+            const int32_t x = originX + j;
+            float *into = patch + (i * T + j) * inDepth;
+
+            if (y < 0 || y >= static_cast<int32_t>(height) || x < 0 ||
+                x >= static_cast<int32_t>(width))
+            {
+              std::fill(into, into + inDepth, 0.0f);
+            }
+            else
+            {
+              std::copy_n(input + (y * width + x) * inDepth, inDepth, into);
+            }
+          }
+        }
+
+        for (uint32_t i = 0; i < T; ++i)
+        {
+          for (uint32_t j = 0; j < T; ++j)
+          {
+            float *into = half + (i * T + j) * inDepth;
+            std::fill(into, into + inDepth, 0.0f);
+            for (uint32_t k = 0; k < T; ++k)
+            {
+              const float coef = TF::BT[i][k];
+              const float *from = patch + (k * T + j) * inDepth;
+              for (uint32_t ic = 0; ic < inDepth; ++ic)
+              {
+                into[ic] += coef * from[ic];
+              }
+            }
+          }
+        }
+
+        for (uint32_t i = 0; i < T; ++i)
+        {
+          for (uint32_t j = 0; j < T; ++j)
+          {
+            float *into = inputTiles + ((i * T + j) * tiles + t) * inDepth;
+            std::fill(into, into + inDepth, 0.0f);
+            for (uint32_t k = 0; k < T; ++k)
+            {
+              const float coef = TF::BT[j][k];
+              const float *from = half + (i * T + k) * inDepth;
+              for (uint32_t ic = 0; ic < inDepth; ++ic)
+              {
+                into[ic] += coef * from[ic];
+              }
+            }
+          }
+        }
+      }
+
+      // Element-wise products summed over input channels, which are a GEMM for each point
+      const float lowest = std::numeric_limits<float>::lowest();
+      const float highest = std::numeric_limits<float>::max();
+
+      for (uint32_t p = 0; p < T * T; ++p)
+      {
+        gemmPacked(inputTiles + p * tiles * inDepth, tiles, inDepth,
+                   _transformed.data() + p * outDepth * inDepth, outDepth, _zeros.data(), lowest,
+                   highest, outputTiles + p * tiles * outDepth, 0, outDepth);
+      }
+
+      // Output transform: AT * m * A for each tile
+      for (uint32_t t = 0; t < tiles; ++t)
+      {
+        const uint32_t originY = (rowBegin + t / tilesWidth) * M;
+        const uint32_t originX = (t % tilesWidth) * M;
+
+        for (uint32_t i = 0; i < M; ++i)
+        {
+          for (uint32_t j = 0; j < T; ++j)
+          {
+            float *into = outputHalf + (i * T + j) * outDepth;
+            std::fill(into, into + outDepth, 0.0f);
+            for (uint32_t k = 0; k < T; ++k)
+            {
+              const float coef = TF::AT[i][k];
+              const float *from = outputTiles + ((k * T + j) * tiles + t) * outDepth;
+              for (uint32_t oc = 0; oc < outDepth; ++oc)
+              {
+                into[oc] += coef * from[oc];
+              }
+            }
+          }
+        }
+
+        for (uint32_t i = 0; i < M && originY + i < outHeight; ++i)
+        {
+          for (uint32_t j = 0; j < M && originX + j < outWidth; ++j)
+          {
+            float *into = output + ((originY + i) * outWidth + originX + j) * outDepth;
+            for (uint32_t oc = 0; oc < outDepth; ++oc)
+            {
+              float sum = biasData[oc];
+              for (uint32_t k = 0; k < T; ++k)
+              {
+                sum += TF::AT[j][k] * outputHalf[(i * T + k) * outDepth + oc];
+              }
+              into[oc] = std::min(std::max(sum, output_activation_min), output_activation_max);
+            }
+          }
+        }
+      }
+    });
+  }
+}
+
+} // namespace cpu
+} // namespace kernel
+} // namespace neurun
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef __NEURUN_KERNEL_CPU_WINOGRAD_CONVOLUTIONLAYER_H__
+#define __NEURUN_KERNEL_CPU_WINOGRAD_CONVOLUTIONLAYER_H__
+
+#include <NeuralNetworks.h>
+
+#include <string>
+#include <vector>
+
+#include <arm_compute/core/ITensor.h>
+#include <arm_compute/runtime/IFunction.h>
+
+#include "kernel/cpu/OperationUtils.h"
+#include "kernel/cpu/ScratchArena.h"
+
+namespace neurun
+{
+namespace kernel
+{
+namespace cpu
+{
+
+// 3x3 stride-1 FLOAT32 convolution with Winograd minimal filtering F(MxM, 3x3)
+//
+// The kernel tensor holds the kernel in NHWC order as is. prepare() transforms it into the
+// Winograd domain once, so run() transforms only the input and output tiles, and the
+// multiplications in between are GEMMs of packed weights (see PackedGemm.h).
+//
+// NOTE Set NEURUN_CPU_WINOGRAD to choose the output tile:
+//        - "auto" (default) picks the tile that the scheduling profile prefers, or the tile
+//          that needs fewer multiplications
+//        - "2x2" or "4x4" forces the tile, and "off" disables Winograd convolution
+//      It is read once per process, as InitializerGenerator (NHWC kernel or packed GEMM panels)
+//      and StageGenerator (Winograd or GEMM stage) should make the same decision.
+class WinogradConvolutionLayer : public ::arm_compute::IFunction
+{
+public:
+  // Value of NEURUN_CPU_WINOGRAD
+  static const std::string &mode(void);
+
+  // Whether a convolution may be run by this layer
+  static bool isSupported(OperandType type, uint32_t kernelHeight, uint32_t kernelWidth,
+                          uint32_t strideHeight, uint32_t strideWidth);
+
+  // Size of the output tile for a convolution of output 'outHeight x outWidth'
+  static uint32_t selectTile(uint32_t outHeight, uint32_t outWidth);
+
+public:
+  WinogradConvolutionLayer();
+
+public:
+  void configure(::arm_compute::ITensor *input, const Shape inputShape,
+                 ::arm_compute::ITensor *kernel, const Shape kernelShape,
+                 ::arm_compute::ITensor *bias, const Shape biasShape, const uint32_t paddingLeft,
+                 const uint32_t paddingTop, const FuseCode activation,
+                 ::arm_compute::ITensor *output, const Shape outputShape, const uint32_t tile);
+
+  void prepare() override;
+  void run() override;
+
+private:
+  template <uint32_t M> void transformKernel(void);
+  template <uint32_t M> void convFloat32(void);
+
+private:
+  ::arm_compute::ITensor *_input;
+  ::arm_compute::ITensor *_kernel;
+  ::arm_compute::ITensor *_bias;
+  ::arm_compute::ITensor *_output;
+
+  Shape _inputShape;
+  Shape _kernelShape;
+  Shape _biasShape;
+  Shape _outputShape;
+
+  uint32_t _paddingLeft;
+  uint32_t _paddingTop;
+
+  FuseCode _activation;
+
+  uint32_t _tile;
+  bool _prepared;
+
+  // Kernel in Winograd domain: a packed [OC, IC] matrix for each point of an input tile
+  std::vector<float> _transformed;
+  std::vector<float> _zeros;
+
+  // Keeps the scratch memory of every thread while this kernel exists
+  ScratchArena::User _scratch_user;
+};
+
+} // namespace cpu
+} // namespace kernel
+} // namespace neurun
+
+#endif // __NEURUN_KERNEL_CPU_WINOGRAD_CONVOLUTIONLAYER_H__
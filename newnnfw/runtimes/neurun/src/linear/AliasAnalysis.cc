@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "AliasAnalysis.h"
+
+#include <unordered_map>
+#include <unordered_set>
+
+#include "graph/Graph.h"
+#include "graph/operation/NodeVisitor.h"
+#include "logging.h"
+
+namespace
+{
+
+using namespace neurun::graph;
+using Alias = neurun::linear::AliasAnalysis::Alias;
+using Filter = neurun::linear::AliasAnalysis::Filter;
+
+class AliasFinder final : public operation::NodeVisitor
+{
+public:
+  AliasFinder(const Graph &graph, const Filter &filter, std::vector<Alias> &aliases,
+              std::unordered_map<operand::Index, operand::Index> &parents)
+      : _graph(graph), _filter(filter), _aliases(aliases), _parents(parents)
+  {
+    // DO NOTHING
+  }
+
+public:
+  void visit(const operation::Conv2D::Implicit::Node &) override {}
+  void visit(const operation::DepthwiseConv2D::Implicit::Node &) override {}
+  void visit(const operation::MaxPool2D::Implicit::Node &) override {}
+  void visit(const operation::AvgPool2D::Implicit::Node &) override {}
+  void visit(const operation::Concat::Node &node) override;
+  void visit(const operation::Reshape::Node &node) override;
+  void visit(const operation::FullyConnected::Node &) override {}
+  void visit(const operation::Softmax::Node &) override {}
+  void visit(const operation::NOP::Node &) override {}
+  void visit(const operation::Permute::Node &) override {}
+
+private:
+  // Whether 'ind' may live in the buffer of 'parent'
+  bool available(const operand::Index &ind, const operand::Index &parent) const;
+  void add(const operand::Index &ind, const operand::Index &parent, size_t offset);
+
+private:
+  const Graph &_graph;
+  const Filter &_filter;
+  std::vector<Alias> &_aliases;
+  std::unordered_map<operand::Index, operand::Index> &_parents;
+};
+
+bool AliasFinder::available(const operand::Index &ind, const operand::Index &parent) const
+{
+  const auto &object = _graph.operands().at(ind);
+
+  // NOTE Constants and model inputs are filled outside the operations
+  if (object.isConstant() || object.isModelInput() || (_parents.count(ind) > 0))
+  {
+    return false;
+  }
+
+  // NOTE An operand may not live in its own buffer
+  for (auto it = _parents.find(parent); it != _parents.end(); it = _parents.find(it->second))
+  {
+    if (it->second == ind)
+    {
+      return false;
+    }
+  }
+
+  return (parent != ind) && !_graph.operands().at(parent).isConstant() && _filter(ind, parent);
+}
+
+void AliasFinder::add(const operand::Index &ind, const operand::Index &parent, size_t offset)
+{
+  VERBOSE(AliasAnalysis) << "Operand #" << ind.value() << " lives at " << offset
+                         << " bytes of operand #" << parent.value() << std::endl;
+
+  _parents.emplace(ind, parent);
+  _aliases.emplace_back(Alias{ind, parent, offset});
+}
+
+void AliasFinder::visit(const operation::Concat::Node &node)
+{
+  const auto &output_index = node.getOutputs().at(0);
+  const auto &output_shape = _graph.operands().at(output_index).shape();
+  const operand::Index axis_index{node.param().axis_index};
+  const auto axis = _graph.operands().at(axis_index).asScalar<int32_t>();
+
+  for (int32_t n = 0; n < axis; ++n)
+  {
+    if (output_shape.dim(n) != 1)
+    {
+      return;
+    }
+  }
+
+  // NOTE Inputs are aliased all or nothing, as Concat copies every input otherwise
+  std::unordered_set<operand::Index> inputs;
+
+  for (const auto &input_index : node.getInputs())
+  {
+    if (!inputs.insert(input_index).second || !available(input_index, output_index))
+    {
+      return;
+    }
+  }
+
+  size_t offset = 0;
+
+  for (const auto &input_index : node.getInputs())
+  {
+    add(input_index, output_index, offset);
+    offset += _graph.operands().at(input_index).operandSize();
+  }
+}
+
+void AliasFinder::visit(const operation::Reshape::Node &node)
+{
+  const auto &input_index = node.getInputs().at(0);
+  const auto &output_index = node.getOutputs().at(0);
+
+  if (available(output_index, input_index))
+  {
+    add(output_index, input_index, 0);
+  }
+}
+
+} // namespace
+
+namespace neurun
+{
+namespace linear
+{
+
+AliasAnalysis::AliasAnalysis(const graph::Graph &graph,
+                             const std::vector<const graph::operation::Node *> &operations,
+                             const Filter &filter)
+{
+  std::unordered_map<graph::operand::Index, graph::operand::Index> parents;
+
+  for (const auto op : operations)
+  {
+    op->accept(AliasFinder{graph, filter, _aliases, parents});
+  }
+}
+
+} // namespace linear
+} // namespace neurun
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef __NEURUN_LINEAR_ALIAS_ANALYSIS_H__
+#define __NEURUN_LINEAR_ALIAS_ANALYSIS_H__
+
+#include <functional>
+#include <vector>
+
+#include "graph/operand/Index.h"
+#include "graph/operation/Node.h"
+
+namespace neurun
+{
+namespace graph
+{
+class Graph;
+} // namespace graph
+} // namespace neurun
+
+namespace neurun
+{
+namespace linear
+{
+
+// Finds operands that may live in the buffer of another operand, so that the operations between
+// them have nothing to copy
+//
+//   - The output of Reshape lives in the buffer of its input
+//   - Each input of Concat lives in its region of the output buffer if the regions are contiguous,
+//     that is, every dimension of the output before the axis is 1
+//
+// NOTE In NHWC, a Concat over the depth of feature maps larger than 1x1 interleaves its inputs,
+//      which needs producers that write with strides
+class AliasAnalysis
+{
+public:
+  struct Alias
+  {
+    graph::operand::Index ind;
+    graph::operand::Index parent;
+    size_t offset; // in bytes
+  };
+
+  // Tells whether backends let 'ind' live in the buffer of 'parent'
+  using Filter =
+      std::function<bool(const graph::operand::Index &ind, const graph::operand::Index &parent)>;
+
+public:
+  AliasAnalysis(const graph::Graph &graph,
+                const std::vector<const graph::operation::Node *> &operations,
+                const Filter &filter);
+
+public:
+  const std::vector<Alias> &aliases(void) const { return _aliases; }
+
+private:
+  std::vector<Alias> _aliases;
+};
+
+} // namespace linear
+} // namespace neurun
+
+#endif // __NEURUN_LINEAR_ALIAS_ANALYSIS_H__
@@ -15,19 +15,353 @@
  */
 
 #include "Linear.h"
+#include "AliasAnalysis.h"
+
+#include <algorithm>
+#include <cassert>
+#include <functional>
+#include <queue>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "graph/Graph.h"
 
 #include "graph/operation/LowerInfo.h"
+#include "backend/IBackendConfig.h"
 #include "backend/IStageGenerator.h"
+#include "util/EnvVar.h"
+
+#include "logging.h"
+
+namespace
+{
+
+// Whether 'order' lists every operation of 'graph' once with each definition before its uses
+bool isTopologicalOrder(const neurun::graph::Graph &graph,
+                        const std::vector<neurun::graph::operation::Index> &order)
+{
+  const auto &operations = graph.operations();
+
+  if (order.size() != operations.size())
+  {
+    return false;
+  }
+
+  std::unordered_map<neurun::graph::operation::Index, uint32_t> position;
+
+  for (uint32_t pos = 0; pos < order.size(); ++pos)
+  {
+    if (!operations.exist(order[pos]) || !position.emplace(order[pos], pos).second)
+    {
+      return false;
+    }
+  }
+
+  for (uint32_t pos = 0; pos < order.size(); ++pos)
+  {
+    for (const auto &ind : operations.at(order[pos]).getInputs())
+    {
+      for (const auto &def : graph.operands().at(ind).getDef().list())
+      {
+        auto it = position.find(def);
+        if (it == position.end() || it->second >= pos)
+        {
+          return false;
+        }
+      }
+    }
+  }
+
+  return true;
+}
+
+using NodeList = std::vector<const neurun::graph::operation::Node *>;
+using OperandBytes = std::unordered_map<neurun::graph::operand::Index, uint64_t>;
+
+// Operands in 'set' without duplicates
+std::unordered_set<neurun::graph::operand::Index>
+distinct(const neurun::graph::operand::IndexSet &set)
+{
+  return std::unordered_set<neurun::graph::operand::Index>(set.begin(), set.end());
+}
+
+// Bytes allocated for each non-constant operand
+//
+// NOTE An operand has a tensor on every backend that defines or uses it (see Linear::markTensors)
+OperandBytes operandBytes(const neurun::graph::Graph &graph)
+{
+  using namespace neurun::graph;
+
+  std::unordered_map<operand::Index, std::unordered_set<const neurun::backend::IBackendConfig *>>
+      backends;
+
+  graph.operations().iterate([&](const operation::Index &, const operation::Node &node) {
+    const auto &lower_info = *node.lower_info();
+    for (const auto &ind : node.getInputs())
+    {
+      backends[ind].insert(lower_info.input_backend().config().get());
+    }
+    for (const auto &ind : node.getOutputs())
+    {
+      backends[ind].insert(lower_info.output_backend().config().get());
+    }
+  });
+
+  OperandBytes bytes;
+
+  for (const auto &entry : backends)
+  {
+    const auto &object = graph.operands().at(entry.first);
+    if (!object.isConstant())
+    {
+      bytes[entry.first] = entry.second.size() * object.operandSize();
+    }
+  }
+
+  return bytes;
+}
+
+// Peak bytes of non-constant operands alive at once when operations run in 'order'
+//
+// NOTE This follows the lifetime that Linear::markTensors notifies
+uint64_t peakLiveBytes(const neurun::graph::Graph &graph, const NodeList &order,
+                       const OperandBytes &bytes)
+{
+  using namespace neurun::graph;
+
+  std::unordered_map<operand::Index, uint32_t> last_pos;
+
+  for (uint32_t pos = 0; pos < order.size(); ++pos)
+  {
+    for (const auto &ind : order[pos]->getInputs())
+    {
+      last_pos[ind] = pos;
+    }
+    for (const auto &ind : order[pos]->getOutputs())
+    {
+      last_pos[ind] = pos;
+    }
+  }
+
+  std::unordered_set<operand::Index> alive;
+  uint64_t live = 0;
+
+  for (const auto &entry : bytes)
+  {
+    if (graph.operands().at(entry.first).isModelInput())
+    {
+      alive.insert(entry.first);
+      live += entry.second;
+    }
+  }
+
+  uint64_t peak = live;
+
+  for (uint32_t pos = 0; pos < order.size(); ++pos)
+  {
+    const auto &node = *order[pos];
+
+    // NOTE An input without any definition is regarded to be defined right here
+    auto claim = [&](const operand::Index &ind) {
+      auto it = bytes.find(ind);
+      if (it != bytes.end() && alive.insert(ind).second)
+      {
+        live += it->second;
+      }
+    };
+
+    auto release = [&](const operand::Index &ind) {
+      if (last_pos.at(ind) == pos && !graph.getOutputs().contains(ind) && alive.erase(ind) > 0)
+      {
+        live -= bytes.at(ind);
+      }
+    };
+
+    for (const auto &ind : node.getOutputs())
+    {
+      claim(ind);
+    }
+    for (const auto &ind : node.getInputs())
+    {
+      claim(ind);
+    }
+
+    peak = std::max(peak, live);
+
+    for (const auto &ind : node.getInputs())
+    {
+      release(ind);
+    }
+    for (const auto &ind : node.getOutputs())
+    {
+      release(ind);
+    }
+  }
+
+  return peak;
+}
+
+// Orders operations by running, among the operations whose inputs are ready, the one that
+// increases live bytes the least (ties are broken by operation index)
+NodeList memoryAwareOrder(const neurun::graph::Graph &graph, const OperandBytes &bytes)
+{
+  using namespace neurun::graph;
+
+  // Producers that each operation waits for, and users that each operand waits for
+  std::unordered_map<operation::Index, uint32_t> waiting;
+  std::unordered_map<operand::Index, uint32_t> remaining_uses;
+
+  graph.operations().iterate([&](const operation::Index &index, const operation::Node &node) {
+    std::unordered_set<operation::Index> producers;
+    for (const auto &ind : node.getInputs())
+    {
+      for (const auto &def : graph.operands().at(ind).getDef().list())
+      {
+        producers.insert(def);
+      }
+    }
+    waiting[index] = producers.size();
+
+    for (const auto &ind : distinct(node.getInputs()))
+    {
+      remaining_uses[ind] += 1;
+    }
+  });
+
+  std::unordered_set<operand::Index> alive;
+
+  auto is_alive = [&](const operand::Index &ind) {
+    return graph.operands().at(ind).isModelInput() || alive.count(ind) > 0;
+  };
+
+  // Change of live bytes when 'node' runs next
+  auto delta = [&](const operation::Node &node) {
+    int64_t value = 0;
+    for (const auto &ind : node.getOutputs())
+    {
+      auto it = bytes.find(ind);
+      if (it != bytes.end() && !is_alive(ind))
+      {
+        value += it->second;
+      }
+    }
+    for (const auto &ind : distinct(node.getInputs()))
+    {
+      auto it = bytes.find(ind);
+      if (it != bytes.end() && remaining_uses.at(ind) == 1 && !graph.getOutputs().contains(ind))
+      {
+        value -= it->second;
+      }
+    }
+    return value;
+  };
+
+  // Ready operations keyed by (delta, operation index value)
+  //
+  // NOTE The delta of a ready operation only decreases (when another user of one of its inputs
+  //      runs), so an entry is pushed again whenever that happens and outdated entries are
+  //      skipped once they come up
+  using Entry = std::pair<int64_t, uint32_t>;
+  std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> ready;
+
+  auto push = [&](const operation::Index &index) {
+    ready.emplace(delta(graph.operations().at(index)), index.value());
+  };
+
+  for (const auto &entry : waiting)
+  {
+    if (entry.second == 0)
+    {
+      push(entry.first);
+    }
+  }
+
+  NodeList order;
+
+  while (!ready.empty())
+  {
+    const auto top = ready.top();
+    ready.pop();
+
+    const operation::Index index{top.second};
+    auto it = waiting.find(index);
+    if (it == waiting.end())
+    {
+      // Already ordered
+      continue;
+    }
+
+    const auto &node = graph.operations().at(index);
+    if (delta(node) != top.first)
+    {
+      continue;
+    }
+
+    waiting.erase(it);
+    order.emplace_back(&node);
+
+    // NOTE An operation that reads several outputs of 'node' still waits for 'node' once
+    std::unordered_set<operation::Index> users;
+    for (const auto &ind : node.getOutputs())
+    {
+      alive.insert(ind);
+      for (const auto &use : graph.operands().at(ind).getUses().list())
+      {
+        users.insert(use);
+      }
+    }
+    for (const auto &use : users)
+    {
+      auto it = waiting.find(use);
+      assert(it != waiting.end() && it->second > 0);
+      if (--it->second == 0)
+      {
+        push(use);
+      }
+    }
+    for (const auto &ind : distinct(node.getInputs()))
+    {
+      if (--remaining_uses.at(ind) != 1)
+      {
+        continue;
+      }
+
+      // The last user of 'ind' now releases it
+      for (const auto &use : graph.operands().at(ind).getUses().list())
+      {
+        auto it = waiting.find(use);
+        if (it != waiting.end() && it->second == 0)
+        {
+          push(use);
+        }
+      }
+    }
+  }
+
+  assert(waiting.empty());
+
+  return order;
+}
+
+} // namespace
 
 namespace neurun
 {
 namespace linear
 {
 
-Linear::Linear(const graph::Graph &graph)
+Linear::Linear(const graph::Graph &graph, const std::vector<graph::operation::Index> &order)
+    : _graph{graph}
 {
+  if (isTopologicalOrder(graph, order))
+  {
+    for (const auto &index : order)
+    {
+      _operations.emplace_back(&graph.operations().at(index));
+    }
+    return;
+  }
+
   // Linearize with topological sort
   //
   // Topological sort algorithm
@@ -39,6 +373,35 @@ Linear::Linear(const graph::Graph &graph)
       graph, [&](const neurun::graph::operation::Node &node) { _operations.emplace_back(&node); });
 
   std::reverse(std::begin(_operations), std::end(_operations));
+
+  // NOTE Set NEURUN_LINEARIZE as "MemoryAware" to order operations so that fewer bytes are alive
+  //      at once. Peak live bytes of both orders are reported when logging is enabled.
+  const bool memory_aware =
+      nnfw::util::EnvVar{"NEURUN_LINEARIZE"}.asString("DFS") == "MemoryAware";
+
+  if (!memory_aware && !::logging::ctx.enabled())
+  {
+    return;
+  }
+
+  const auto bytes = operandBytes(graph);
+  auto reordered = memoryAwareOrder(graph, bytes);
+
+  VERBOSE(Linear) << "Peak live bytes: DFS " << peakLiveBytes(graph, _operations, bytes)
+                  << ", MemoryAware " << peakLiveBytes(graph, reordered, bytes) << std::endl;
+
+  if (memory_aware)
+  {
+    _operations = std::move(reordered);
+  }
+}
+
+void Linear::iterate(const std::function<void(const graph::operation::Node &)> &fn) const
+{
+  for (const auto op : _operations)
+  {
+    fn(*op);
+  }
 }
 
 void Linear::accept(graph::operation::NodeVisitor &&visitor) const
@@ -49,23 +412,147 @@ void Linear::accept(graph::operation::NodeVisitor &&visitor) const
   }
 }
 
-backend::TensorBuilderSet Linear::markTensors() const
+backend::TensorBuilderSet Linear::markTensors(bool in_order) const
 {
   backend::TensorBuilderSet tensor_builders;
+
+  // Tensor builders that have marked each operand
+  std::unordered_map<graph::operand::Index, backend::TensorBuilderSet> owners;
+
   for (const auto op : _operations)
   {
-    const auto tensor_builder = op->lower_info()->backend().stage_gen()->tensor_builder();
+    // NOTE An operation may read and write the tensors of other backends (e.g. Permute)
+    const auto input_tensor_builder = op->lower_info()->input_backend().tensor_builder();
+    for (const auto &ind : op->getInputs())
+    {
+      input_tensor_builder->mark(ind);
+      tensor_builders.insert(input_tensor_builder);
+      owners[ind].insert(input_tensor_builder);
+    }
+    const auto output_tensor_builder = op->lower_info()->output_backend().tensor_builder();
+    for (const auto &ind : op->getOutputs())
+    {
+      output_tensor_builder->mark(ind);
+      tensor_builders.insert(output_tensor_builder);
+      owners[ind].insert(output_tensor_builder);
+    }
+  }
+
+  // Let an operand live in the buffer of another operand where the operation between them only
+  // copies (e.g. Reshape), if a single backend that supports it has both of them
+  {
+    auto filter = [&](const graph::operand::Index &ind, const graph::operand::Index &parent) {
+      const auto &builders = owners.at(ind);
+      return (builders.size() == 1) && (owners.at(parent) == builders) &&
+             (*builders.begin())->supportAliasing();
+    };
+
+    for (const auto &alias : AliasAnalysis{_graph, _operations, filter}.aliases())
+    {
+      (*owners.at(alias.ind).begin())->alias(alias.ind, alias.parent, alias.offset);
+    }
+  }
+
+  // Notify the lifetime of each operand over the linear order
+  //
+  //   - Constants and model inputs are alive from the beginning
+  //   - Constants and model outputs are alive until the end
+  //   - The others are alive from their def to their last use (or until the end if operations
+  //     may run out of the linear order)
+  const auto &operands = _graph.operands();
+
+  auto is_alive_from_beginning = [&](const graph::operand::Index &ind) {
+    const auto &object = operands.at(ind);
+    return object.isModelInput() || object.isConstant();
+  };
+
+  auto is_alive_until_end = [&](const graph::operand::Index &ind) {
+    return operands.at(ind).isConstant() || _graph.getOutputs().contains(ind);
+  };
+
+  auto notify_first_use = [&](const graph::operand::Index &ind) {
+    for (const auto &tensor_builder : owners.at(ind))
+    {
+      tensor_builder->notifyFirstUse(ind);
+    }
+  };
+
+  auto notify_last_use = [&](const graph::operand::Index &ind) {
+    for (const auto &tensor_builder : owners.at(ind))
+    {
+      tensor_builder->notifyLastUse(ind);
+    }
+  };
+
+  // Position of the last operation that touches each operand
+  std::unordered_map<graph::operand::Index, uint32_t> last_pos;
+
+  for (uint32_t pos = 0; pos < _operations.size(); ++pos)
+  {
+    for (const auto &ind : _operations[pos]->getInputs())
+    {
+      last_pos[ind] = pos;
+    }
+    for (const auto &ind : _operations[pos]->getOutputs())
+    {
+      last_pos[ind] = pos;
+    }
+  }
+
+  for (const auto &entry : owners)
+  {
+    if (is_alive_from_beginning(entry.first))
+    {
+      notify_first_use(entry.first);
+    }
+  }
+
+  std::unordered_map<graph::operand::Index, bool> claimed;
+
+  for (uint32_t pos = 0; pos < _operations.size(); ++pos)
+  {
+    const auto op = _operations[pos];
+
+    // NOTE Outputs are claimed before inputs are released, as an operation may not write its
+    //      output on the memory of its input
+    for (const auto &ind : op->getOutputs())
+    {
+      if (!is_alive_from_beginning(ind) && !claimed[ind])
+      {
+        notify_first_use(ind);
+        claimed[ind] = true;
+      }
+    }
+
     for (const auto &ind : op->getInputs())
     {
-      tensor_builder->mark(ind);
-      tensor_builders.insert(tensor_builder);
+      if (!is_alive_from_beginning(ind) && !claimed[ind])
+      {
+        // NOTE An input without any definition is regarded to be defined right here
+        notify_first_use(ind);
+        claimed[ind] = true;
+      }
+    }
+
+    auto release = [&](const graph::operand::Index &ind) {
+      if (in_order && (last_pos.at(ind) == pos) && !is_alive_until_end(ind))
+      {
+        notify_last_use(ind);
+        // Prevent the duplicated notification for an operand that appears twice in 'op'
+        last_pos[ind] = _operations.size();
+      }
+    };
+
+    for (const auto &ind : op->getInputs())
+    {
+      release(ind);
     }
     for (const auto &ind : op->getOutputs())
     {
-      tensor_builder->mark(ind);
-      tensor_builders.insert(tensor_builder);
+      release(ind);
     }
   }
+
   return tensor_builders;
 }
 
@@ -17,8 +17,10 @@
 #ifndef __NEURUN_LINEAR_LINEAR_H__
 #define __NEURUN_LINEAR_LINEAR_H__
 
+#include <functional>
 #include <vector>
 
+#include "graph/operation/Index.h"
 #include "graph/operation/Node.h"
 #include "backend/ITensorBuilder.h"
 
@@ -49,19 +51,26 @@ namespace linear
 class Linear
 {
 public:
-  Linear(const graph::Graph &graph);
+  // NOTE 'order' is used as the order of operations if it is a valid topological order of 'graph'
+  //      (e.g. from a cached plan), otherwise operations are sorted again
+  Linear(const graph::Graph &graph, const std::vector<graph::operation::Index> &order = {});
 
 public:
   Linear(const Linear &linear) = delete;
 
 public:
   void accept(graph::operation::NodeVisitor &&visitor) const;
+  void iterate(const std::function<void(const graph::operation::Node &)> &fn) const;
 
   // TODO Should not return TensorBuilderSet
-  virtual backend::TensorBuilderSet markTensors() const;
+  // NOTE This also notifies tensor builders of the first/last use of each operand in this order
+  //      If operations may run out of this order, 'in_order' should be false so that no operand
+  //      is released (and thus no memory is shared)
+  virtual backend::TensorBuilderSet markTensors(bool in_order) const;
 
 public:
 private:
+  const graph::Graph &_graph;
   std::vector<const graph::operation::Node *> _operations;
 };
 
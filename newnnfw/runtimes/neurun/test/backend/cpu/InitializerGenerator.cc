@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <NeuralNetworks.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "backend/cpu/InitializerGenerator.h"
+#include "backend/cpu/operand/Tensor.h"
+#include "graph/operand/Set.h"
+#include "graph/operation/Conv2D.h"
+#include "graph/operation/FullyConnected.h"
+#include "internal/Convert.h"
+
+namespace
+{
+
+using Index = neurun::graph::operand::Index;
+using Shape = neurun::graph::operand::Shape;
+using TypeInfo = neurun::graph::operand::TypeInfo;
+using Tensor = neurun::backend::cpu::operand::Tensor;
+
+template <typename T>
+Index addConstant(neurun::graph::operand::Set &operands, const Shape &shape, const TypeInfo &type,
+                  const std::vector<T> &values)
+{
+  const auto index = operands.append(shape, type);
+  auto &object = operands.at(index);
+
+  object.setAsConstant();
+  object.data<neurun::graph::operand::CachedData>(reinterpret_cast<const uint8_t *>(values.data()),
+                                                  values.size() * sizeof(T));
+
+  return index;
+}
+
+Index addScalar(neurun::graph::operand::Set &operands, int32_t value)
+{
+  return addConstant<int32_t>(operands, Shape{0}, TypeInfo{ANEURALNETWORKS_INT32, 0, 0}, {value});
+}
+
+Shape makeShape(std::initializer_list<int32_t> dims)
+{
+  Shape shape(dims.size());
+
+  uint32_t axis = 0;
+  for (auto dim : dims)
+  {
+    shape.dim(axis++) = dim;
+  }
+
+  return shape;
+}
+
+// Runs 'initializer' on a CPU tensor of 'info', and returns the content of the tensor
+template <typename T>
+std::vector<T> initialize(const Initializer &initializer,
+                          const ::arm_compute::TensorInfo &info)
+{
+  std::vector<T> buffer(info.total_size() / sizeof(T));
+
+  Tensor tensor{info};
+  tensor.setBuffer(reinterpret_cast<uint8_t *>(buffer.data()));
+
+  initializer(tensor);
+
+  return buffer;
+}
+
+} // namespace
+
+TEST(backend_cpu_InitializerGenerator, quant8_conv)
+{
+  neurun::graph::operand::Set operands;
+
+  const TypeInfo quant8{ANEURALNETWORKS_TENSOR_QUANT8_ASYMM, 0.5f, 3};
+  const TypeInfo int32{ANEURALNETWORKS_TENSOR_INT32, 0.25f, 0};
+
+  // NHWC kernel of 2 filters over 1x2 patches of 3 channels
+  const std::vector<uint8_t> kernel{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+  const std::vector<int32_t> bias{-7, 1 << 20};
+
+  const auto ifm = operands.append(makeShape({1, 3, 3, 3}), quant8);
+  const auto ker = addConstant(operands, makeShape({2, 1, 2, 3}), quant8, kernel);
+  const auto bia = addConstant(operands, makeShape({2}), int32, bias);
+  const auto padding = addScalar(operands, ANEURALNETWORKS_PADDING_VALID);
+  const auto hstride = addScalar(operands, 1);
+  const auto vstride = addScalar(operands, 1);
+  const auto activation = addScalar(operands, ANEURALNETWORKS_FUSED_NONE);
+  const auto ofm = operands.append(makeShape({1, 3, 2, 2}), quant8);
+
+  const uint32_t inputs[7] = {ifm.value(),     ker.value(),     bia.value(),       padding.value(),
+                              hstride.value(), vstride.value(), activation.value()};
+  const uint32_t outputs[1] = {ofm.value()};
+
+  neurun::graph::operation::Conv2D::Implicit::Node node{{7, inputs, 1, outputs}};
+  neurun::backend::cpu::InitializerGenerator generator{operands};
+
+  // CPU kernels keep the NHWC order of NNAPI
+  const auto ker_info = ::internal::asTensorInfo(operands.at(ker).shape().asKernel(), quant8);
+  ASSERT_EQ(initialize<uint8_t>(generator.generateWeight(node), ker_info), kernel);
+
+  const auto bias_info = ::internal::asTensorInfo(operands.at(bia).shape().asVector(), int32);
+  ASSERT_EQ(initialize<int32_t>(generator.generateBias(node), bias_info), bias);
+}
+
+TEST(backend_cpu_InitializerGenerator, quant8_fully_connected)
+{
+  neurun::graph::operand::Set operands;
+
+  const TypeInfo quant8{ANEURALNETWORKS_TENSOR_QUANT8_ASYMM, 0.5f, 3};
+  const TypeInfo int32{ANEURALNETWORKS_TENSOR_INT32, 0.25f, 0};
+
+  const std::vector<uint8_t> weights{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+  const std::vector<int32_t> bias{-7, 1 << 20};
+
+  const auto input = operands.append(makeShape({1, 1, 2, 3}), quant8);
+  const auto weight = addConstant(operands, makeShape({2, 6}), quant8, weights);
+  const auto bia = addConstant(operands, makeShape({2}), int32, bias);
+  const auto activation = addScalar(operands, ANEURALNETWORKS_FUSED_NONE);
+  const auto output = operands.append(makeShape({1, 2}), quant8);
+
+  const uint32_t inputs[4] = {input.value(), weight.value(), bia.value(), activation.value()};
+  const uint32_t outputs[1] = {output.value()};
+
+  neurun::graph::operation::FullyConnected::Node node{{4, inputs, 1, outputs}};
+  neurun::backend::cpu::InitializerGenerator generator{operands};
+
+  // Quantized weights are not packed, and keep the row-major order of NNAPI
+  const auto weight_info = ::internal::asTensorInfo(2, 6, quant8);
+  ASSERT_EQ(initialize<uint8_t>(generator.generateWeight(node), weight_info), weights);
+
+  const auto bias_info = ::internal::asTensorInfo(2, int32);
+  ASSERT_EQ(initialize<int32_t>(generator.generateBias(node), bias_info), bias);
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "backend/cpu/MemoryPlanner.h"
+
+using neurun::backend::cpu::BumpPlanner;
+using neurun::backend::cpu::FitPlanner;
+using neurun::graph::operand::Index;
+
+TEST(backend_cpu_MemoryPlanner, bump_planner)
+{
+  BumpPlanner planner;
+
+  planner.claim(Index{0u}, 10);
+  planner.claim(Index{1u}, 100);
+  planner.release(Index{0u});
+  planner.claim(Index{2u}, 10);
+
+  ASSERT_EQ(planner.plans().at(Index{0u}).offset, 0);
+  ASSERT_EQ(planner.plans().at(Index{1u}).offset, 64);
+  ASSERT_EQ(planner.plans().at(Index{2u}).offset, 192);
+  ASSERT_EQ(planner.capacity(), 256);
+}
+
+TEST(backend_cpu_MemoryPlanner, first_fit_planner)
+{
+  FitPlanner planner{FitPlanner::Policy::FirstFit};
+
+  planner.claim(Index{0u}, 128);
+  planner.claim(Index{1u}, 64);
+  planner.claim(Index{2u}, 64);
+  planner.release(Index{0u});
+  planner.release(Index{2u});
+
+  // Takes the lowest gap
+  planner.claim(Index{3u}, 32);
+  // Does not fit in the remaining gap before #1
+  planner.claim(Index{4u}, 128);
+
+  ASSERT_EQ(planner.plans().at(Index{3u}).offset, 0);
+  ASSERT_EQ(planner.plans().at(Index{4u}).offset, 192);
+  ASSERT_EQ(planner.capacity(), 320);
+}
+
+TEST(backend_cpu_MemoryPlanner, best_fit_planner)
+{
+  FitPlanner planner{FitPlanner::Policy::BestFit};
+
+  planner.claim(Index{0u}, 128);
+  planner.claim(Index{1u}, 64);
+  planner.claim(Index{2u}, 64);
+  planner.claim(Index{3u}, 64);
+  planner.release(Index{0u});
+  planner.release(Index{2u});
+
+  // Takes the smallest gap
+  planner.claim(Index{4u}, 64);
+
+  ASSERT_EQ(planner.plans().at(Index{4u}).offset, 192);
+  ASSERT_EQ(planner.capacity(), 320);
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "backend/cpu/TensorBuilder.h"
+#include "codegen/Plan.h"
+
+namespace
+{
+
+using Index = neurun::graph::operand::Index;
+
+::arm_compute::TensorInfo makeInfo(size_t elements)
+{
+  return ::arm_compute::TensorInfo{::arm_compute::TensorShape{elements}, 1,
+                                   ::arm_compute::DataType::F32};
+}
+
+} // namespace
+
+TEST(backend_cpu_TensorBuilder, alias)
+{
+  // NOTE A plan without model (e.g. of BackendCalibrator) is enough to prepare tensors
+  neurun::codegen::Plan plan{nullptr};
+  neurun::backend::cpu::TensorBuilder builder;
+
+  // x -> Op -> a -> Concat -> z
+  // x -> Op -> b ->
+  Index x{0u}, a{1u}, b{2u}, z{3u};
+
+  for (const auto &ind : {x, a, b, z})
+  {
+    builder.mark(ind);
+  }
+
+  builder.alias(a, z, 0);
+  builder.alias(b, z, 2 * sizeof(float));
+
+  builder.notifyFirstUse(x);
+  builder.notifyFirstUse(a);
+  builder.notifyFirstUse(b);
+  builder.notifyLastUse(x);
+  builder.notifyFirstUse(z);
+  builder.notifyLastUse(a);
+  builder.notifyLastUse(b);
+
+  const std::map<int, ::arm_compute::TensorInfo> infos{
+      {x.asInt(), makeInfo(2)}, {a.asInt(), makeInfo(2)}, {b.asInt(), makeInfo(3)},
+      {z.asInt(), makeInfo(5)}};
+
+  ASSERT_EQ(builder.allocatedBytes(), 0);
+  builder.prepare(plan, infos);
+  ASSERT_GE(builder.allocatedBytes(), (2 + 5) * sizeof(float));
+
+  const auto base = builder.at(z)->buffer();
+  ASSERT_EQ(builder.at(a)->buffer(), base);
+  ASSERT_EQ(builder.at(b)->buffer(), base + 2 * sizeof(float));
+
+  // 'z' is claimed along with 'a' while 'x' is alive
+  const auto x_begin = builder.at(x)->buffer();
+  const auto x_end = x_begin + 2 * sizeof(float);
+  ASSERT_TRUE((x_end <= base) || (base + 5 * sizeof(float) <= x_begin));
+}
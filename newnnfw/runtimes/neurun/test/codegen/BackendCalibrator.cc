@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "codegen/BackendCalibrator.h"
+#include "frontend/wrapper/model.h"
+#include "../frontend/SimpleModel.h"
+
+using BackendCalibrator = neurun::codegen::BackendCalibrator;
+
+TEST(codegen_BackendCalibrator, measure_on_cpu)
+{
+  neurun_test::frontend::SimpleModel model;
+
+  std::shared_ptr<neurun::graph::Graph> graph;
+  model.get()->release(graph);
+
+  BackendCalibrator calibrator{*graph};
+
+  // FullyConnected, and Softmax
+  for (uint32_t n = 0; n < 2; ++n)
+  {
+    const auto elapsed = calibrator.measure(neurun::graph::operation::Index{n}, "cpu");
+
+    ASSERT_GE(elapsed, 0.0);
+    ASSERT_LT(elapsed, BackendCalibrator::kUnsupported);
+  }
+
+  // NOTE Logits that FullyConnected passes to Softmax stay within the CPU backend
+  ASSERT_EQ(calibrator.measurePermute(neurun::graph::operand::Index{4u}, "cpu", "cpu"), 0.0);
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "codegen/CostModel.h"
+#include "graph/Graph.h"
+#include "graph/operation/Conv2D.h"
+#include "graph/operation/FullyConnected.h"
+
+namespace
+{
+
+using namespace neurun::graph;
+
+operand::Index addOperand(Graph &graph, const std::vector<int32_t> &dims, bool constant)
+{
+  operand::Shape shape{static_cast<uint32_t>(dims.size())};
+  for (uint32_t axis = 0; axis < dims.size(); ++axis)
+  {
+    shape.dim(axis) = dims.at(axis);
+  }
+
+  operand::TypeInfo type{ANEURALNETWORKS_TENSOR_FLOAT32, 0, 0};
+
+  auto index = graph.addOperand(shape, type);
+
+  if (constant)
+  {
+    graph.operands().at(index).setAsConstant();
+  }
+
+  return index;
+}
+
+} // namespace
+
+TEST(codegen_CostModel, conv2d)
+{
+  Graph graph;
+
+  std::vector<uint32_t> inputs;
+  inputs.emplace_back(addOperand(graph, {1, 5, 5, 3}, false).asInt());
+  inputs.emplace_back(addOperand(graph, {4, 3, 3, 3}, true).asInt());
+  inputs.emplace_back(addOperand(graph, {4}, true).asInt());
+  // padding, strides and activation
+  for (int n = 0; n < 4; ++n)
+  {
+    inputs.emplace_back(addOperand(graph, {1}, true).asInt());
+  }
+  uint32_t output = addOperand(graph, {1, 3, 3, 4}, false).asInt();
+
+  operation::Conv2D::Implicit::Node node{
+      operation::Node::InitParam{7, inputs.data(), 1, &output}};
+
+  const auto cost = neurun::codegen::CostModel{graph.operands()}.estimate(node);
+
+  // 3x3x4 outputs, each of which accumulates a 3x3x3 window
+  ASSERT_EQ(cost.macs, 3 * 3 * 4 * 27);
+  ASSERT_EQ(cost.ops, 0);
+  ASSERT_EQ(cost.weight_bytes, (4 * 27 + 4) * sizeof(float));
+  ASSERT_EQ(cost.input_bytes, 75 * sizeof(float));
+  ASSERT_EQ(cost.output_bytes, 36 * sizeof(float));
+}
+
+TEST(codegen_CostModel, fully_connected)
+{
+  Graph graph;
+
+  std::vector<uint32_t> inputs;
+  inputs.emplace_back(addOperand(graph, {2, 16}, false).asInt());
+  inputs.emplace_back(addOperand(graph, {10, 16}, true).asInt());
+  inputs.emplace_back(addOperand(graph, {10}, true).asInt());
+  inputs.emplace_back(addOperand(graph, {1}, true).asInt());
+  uint32_t output = addOperand(graph, {2, 10}, false).asInt();
+
+  operation::FullyConnected::Node node{
+      operation::Node::InitParam{4, inputs.data(), 1, &output}};
+
+  const auto cost = neurun::codegen::CostModel{graph.operands()}.estimate(node);
+
+  ASSERT_EQ(cost.macs, 2 * 10 * 16);
+  ASSERT_EQ(cost.weight_bytes, (160 + 10) * sizeof(float));
+  ASSERT_EQ(cost.input_bytes, 32 * sizeof(float));
+  ASSERT_EQ(cost.output_bytes, 20 * sizeof(float));
+}
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "codegen/LatencyModel.h"
+
+namespace
+{
+
+using neurun::codegen::LatencyModel;
+
+// Two operations where the 1st passes its output to the 2nd, on two backends
+LatencyModel makeChain(double op0_b0, double op0_b1, double op1_b0, double op1_b1,
+                       double permute)
+{
+  LatencyModel model(2);
+
+  model.exec[0] = {op0_b0, op0_b1};
+  model.exec[1] = {op1_b0, op1_b1};
+
+  LatencyModel::Edge edge;
+  edge.def = 0;
+  edge.uses = {1};
+  edge.permute = {{0.0, permute}, {permute, 0.0}};
+  model.addEdge(std::move(edge));
+
+  return model;
+}
+
+} // namespace
+
+TEST(codegen_LatencyModel, total)
+{
+  const auto model = makeChain(1.0, 10.0, 10.0, 1.0, 2.0);
+
+  ASSERT_DOUBLE_EQ(model.total({0, 0}), 11.0);
+  ASSERT_DOUBLE_EQ(model.total({1, 1}), 11.0);
+  // Permute is counted when the operations run on different backends
+  ASSERT_DOUBLE_EQ(model.total({0, 1}), 4.0);
+  ASSERT_DOUBLE_EQ(model.local(0, {0, 1}), 3.0);
+  ASSERT_DOUBLE_EQ(model.local(1, {0, 1}), 3.0);
+}
+
+TEST(codegen_LatencyModel, permute_once_per_backend)
+{
+  LatencyModel model(3);
+
+  model.exec[0] = {1.0, 1.0};
+  model.exec[1] = {1.0, 1.0};
+  model.exec[2] = {1.0, 1.0};
+
+  LatencyModel::Edge edge;
+  edge.def = 0;
+  edge.uses = {1, 2};
+  edge.permute = {{0.0, 5.0}, {5.0, 0.0}};
+  model.addEdge(std::move(edge));
+
+  // Both uses on the other backend share a single permute
+  ASSERT_DOUBLE_EQ(model.total({0, 1, 1}), 3.0 + 5.0);
+  ASSERT_DOUBLE_EQ(model.total({0, 0, 1}), 3.0 + 5.0);
+  ASSERT_DOUBLE_EQ(model.total({0, 0, 0}), 3.0);
+}
+
+TEST(codegen_LatencyModel, search_mixed)
+{
+  const auto model = makeChain(1.0, 10.0, 10.0, 1.0, 2.0);
+
+  const LatencyModel::Assignment expected{0, 1};
+  ASSERT_EQ(model.search(2), expected);
+}
+
+TEST(codegen_LatencyModel, search_avoids_permute)
+{
+  const auto model = makeChain(1.0, 10.0, 5.0, 1.0, 100.0);
+
+  // Running each operation on its fastest backend costs 102, while all on the 1st costs 6
+  const LatencyModel::Assignment expected{0, 0};
+  ASSERT_EQ(model.search(2), expected);
+}
+
+TEST(codegen_LatencyModel, search_unsupported)
+{
+  // NOTE BackendCalibrator gives a huge cost to an operation that a backend does not support
+  const double unsupported = 1e30;
+  const auto model = makeChain(unsupported, 10.0, 1.0, 2.0, 5.0);
+
+  const LatencyModel::Assignment expected{1, 1};
+  ASSERT_EQ(model.search(2), expected);
+}
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "codegen/PlanCache.h"
+#include "backend/cpu/operand/Object.h"
+#include "backend/cpu/operand/Tensor.h"
+#include "nnfw/std/memory.h"
+
+namespace
+{
+
+using namespace neurun::graph;
+
+void buildModel(Graph &graph, float value)
+{
+  operand::Shape shape{1};
+  shape.dim(0) = 4;
+  operand::TypeInfo type{ANEURALNETWORKS_TENSOR_FLOAT32, 0, 0};
+
+  auto index = graph.addOperand(shape, type);
+
+  const float data[4] = {value, value, value, value};
+  graph.operands().at(index).setAsConstant();
+  graph.setOperandValue(index, nnfw::make_unique<operand::CachedData>(
+                                   reinterpret_cast<const uint8_t *>(data), sizeof(data)));
+}
+
+std::shared_ptr<neurun::backend::cpu::operand::Object> makeObject(std::vector<float> &buffer)
+{
+  ::arm_compute::TensorInfo info{::arm_compute::TensorShape{4}, 1, ::arm_compute::DataType::F32};
+
+  auto tensor = std::make_shared<neurun::backend::cpu::operand::Tensor>(info);
+  tensor->setBuffer(reinterpret_cast<uint8_t *>(buffer.data()));
+
+  return std::make_shared<neurun::backend::cpu::operand::Object>(tensor);
+}
+
+} // namespace
+
+// Caches plans in a private directory of each test
+class codegen_PlanCache : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    char dir[] = "/tmp/neurun_plan_cache.XXXXXX";
+    ASSERT_NE(mkdtemp(dir), nullptr);
+
+    _dir = dir;
+    setenv("NEURUN_PLAN_CACHE_DIR", dir, 1);
+
+    buildModel(_graph, 1.0f);
+  }
+
+  void TearDown() override
+  {
+    unsetenv("NEURUN_PLAN_CACHE_DIR");
+
+    if (auto handle = opendir(_dir.c_str()))
+    {
+      while (auto entry = readdir(handle))
+      {
+        const std::string name{entry->d_name};
+        if (name != "." && name != "..")
+        {
+          std::remove((_dir + "/" + name).c_str());
+        }
+      }
+      closedir(handle);
+    }
+
+    rmdir(_dir.c_str());
+  }
+
+protected:
+  // Saves a plan of '_graph' with '_weights', and returns the path of the plan file
+  std::string save(void)
+  {
+    neurun::codegen::PlanCache cache{_graph};
+
+    EXPECT_FALSE(cache.load());
+    cache.store(_index, makeObject(_weights));
+    EXPECT_TRUE(cache.save());
+
+    return cache.path();
+  }
+
+protected:
+  std::string _dir;
+  Graph _graph;
+  const operand::Index _index{0u};
+  std::vector<float> _weights{1.0f, 2.0f, 3.0f, 4.0f};
+};
+
+TEST_F(codegen_PlanCache, round_trip)
+{
+  save();
+
+  neurun::codegen::PlanCache cache{_graph};
+  std::vector<float> restored(4, 0.0f);
+
+  ASSERT_TRUE(cache.load());
+  ASSERT_TRUE(cache.restore(_index, *makeObject(restored)));
+  ASSERT_EQ(restored, _weights);
+}
+
+TEST_F(codegen_PlanCache, truncated)
+{
+  const auto path = save();
+
+  struct stat st;
+  ASSERT_EQ(stat(path.c_str(), &st), 0);
+  ASSERT_EQ(truncate(path.c_str(), st.st_size - 1), 0);
+
+  ASSERT_FALSE(neurun::codegen::PlanCache{_graph}.load());
+}
+
+TEST_F(codegen_PlanCache, corrupted)
+{
+  const auto path = save();
+
+  {
+    // Break the magic
+    std::fstream file{path, std::ios::in | std::ios::out | std::ios::binary};
+    file.put('X');
+  }
+
+  ASSERT_FALSE(neurun::codegen::PlanCache{_graph}.load());
+}
+
+TEST_F(codegen_PlanCache, writable_by_others)
+{
+  const auto path = save();
+
+  ASSERT_EQ(chmod(path.c_str(), 0666), 0);
+  ASSERT_FALSE(neurun::codegen::PlanCache{_graph}.load());
+
+  ASSERT_EQ(chmod(path.c_str(), 0600), 0);
+  ASSERT_TRUE(neurun::codegen::PlanCache{_graph}.load());
+}
+
+TEST_F(codegen_PlanCache, key_changes_with_constants)
+{
+  Graph graph;
+  buildModel(graph, 2.0f);
+
+  ASSERT_NE(neurun::codegen::PlanCache{_graph}.key(), neurun::codegen::PlanCache{graph}.key());
+}
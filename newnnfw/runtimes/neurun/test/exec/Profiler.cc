@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#include "exec/Profiler.h"
+
+TEST(exec_Profiler, write_chrome_trace)
+{
+  auto &profiler = neurun::exec::Profiler::get();
+
+  const auto id = profiler.addOperation("CONV_2D", "cpu", "1x3x3x1 -> 1x1x1x1", {9, 0, 36, 36, 4});
+
+  profiler.start();
+  ASSERT_TRUE(neurun::exec::Profiler::enabled());
+
+  neurun::exec::profile([](neurun::exec::Profiler &p) { return p.beginInput(0); }, [] {});
+  neurun::exec::profile([id](neurun::exec::Profiler &p) { return p.beginOperation(id); }, [] {});
+
+  std::stringstream ss;
+  profiler.write(ss);
+
+  const auto trace = ss.str();
+
+  ASSERT_NE(trace.find("\"traceEvents\""), std::string::npos);
+  ASSERT_NE(trace.find("\"name\": \"CONV_2D\""), std::string::npos);
+  ASSERT_NE(trace.find("\"backend\": \"cpu\""), std::string::npos);
+  ASSERT_NE(trace.find("\"shapes\": \"1x3x3x1 -> 1x1x1x1\""), std::string::npos);
+  ASSERT_NE(trace.find("\"name\": \"Input\""), std::string::npos);
+  ASSERT_NE(trace.find("\"name\": \"thread_name\""), std::string::npos);
+  ASSERT_NE(trace.find("\"macs\": 9, \"bytes\": 76"), std::string::npos);
+
+  std::stringstream roofline;
+  profiler.writeRoofline(roofline);
+
+  ASSERT_NE(roofline.str().find(std::to_string(id) + " CONV_2D (cpu)"), std::string::npos);
+
+  ASSERT_FALSE(profiler.stop("/dev/null/trace.json"));
+  ASSERT_FALSE(neurun::exec::Profiler::enabled());
+}
+
+TEST(exec_Profiler, run_without_recording)
+{
+  ASSERT_FALSE(neurun::exec::Profiler::enabled());
+
+  uint32_t count = 0;
+  neurun::exec::profile([](neurun::exec::Profiler &p) { return p.beginOutput(0); },
+                        [&count] { ++count; });
+
+  ASSERT_EQ(count, 1);
+}
+
+TEST(exec_Profiler, write_unregistered_operation)
+{
+  auto &profiler = neurun::exec::Profiler::get();
+
+  profiler.start();
+
+  const auto id = neurun::exec::Profiler::NO_OPERATION;
+  neurun::exec::profile([id](neurun::exec::Profiler &p) { return p.beginOperation(id); }, [] {});
+
+  std::stringstream ss;
+  profiler.write(ss);
+
+  // The event is kept without the name and the cost of its operation
+  const auto trace = ss.str();
+
+  ASSERT_NE(trace.find("\"name\": \"Operation\""), std::string::npos);
+  ASSERT_EQ(trace.find("\"macs\""), std::string::npos);
+
+  std::stringstream roofline;
+  profiler.writeRoofline(roofline);
+
+  ASSERT_FALSE(profiler.stop("/dev/null/trace.json"));
+}
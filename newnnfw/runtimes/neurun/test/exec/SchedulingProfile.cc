@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <future>
+
+#include "exec/SchedulingProfile.h"
+
+using neurun::exec::SchedulingProfile;
+using Preference = SchedulingProfile::Preference;
+
+TEST(exec_SchedulingProfile, threads)
+{
+  const auto &low_power = SchedulingProfile::get(Preference::LOW_POWER);
+  const auto &fast = SchedulingProfile::get(Preference::FAST_SINGLE_ANSWER);
+  const auto &sustained = SchedulingProfile::get(Preference::SUSTAINED_SPEED);
+
+  ASSERT_EQ(low_power.pool().size(), low_power.threads());
+  ASSERT_EQ(fast.pool().size(), fast.threads());
+  ASSERT_EQ(sustained.pool().size(), sustained.threads());
+
+  ASSERT_LE(low_power.threads(), sustained.threads());
+  ASSERT_LE(sustained.threads(), fast.threads());
+
+  ASSERT_FALSE(low_power.spin());
+  ASSERT_TRUE(fast.spin());
+  ASSERT_TRUE(sustained.pin());
+
+  ASSERT_EQ(low_power.winogradTile(), 2);
+  ASSERT_EQ(fast.winogradTile(), 0);
+}
+
+TEST(exec_SchedulingProfile, current)
+{
+  const auto &low_power = SchedulingProfile::get(Preference::LOW_POWER);
+
+  ASSERT_EQ(SchedulingProfile::current().preference(), Preference::FAST_SINGLE_ANSWER);
+
+  {
+    SchedulingProfile::Scope scope{low_power};
+
+    ASSERT_EQ(&SchedulingProfile::current(), &low_power);
+  }
+
+  ASSERT_EQ(SchedulingProfile::current().preference(), Preference::FAST_SINGLE_ANSWER);
+
+  // Workers of a profile run tasks with the profile
+  std::promise<const SchedulingProfile *> promise;
+
+  low_power.pool().submit([&] { promise.set_value(&SchedulingProfile::current()); });
+
+  ASSERT_EQ(promise.get_future().get(), &low_power);
+}
+
+TEST(exec_SchedulingProfile, kernel_scheduler)
+{
+  using neurun::kernel::cpu::IScheduler;
+  using neurun::kernel::cpu::currentScheduler;
+
+  const auto &low_power = SchedulingProfile::get(Preference::LOW_POWER);
+  const IScheduler &scheduler = low_power;
+
+  // CPU kernels run sequentially outside of any profile
+  ASSERT_EQ(currentScheduler().concurrency(), 1u);
+
+  {
+    SchedulingProfile::Scope scope{low_power};
+
+    ASSERT_EQ(&currentScheduler(), &scheduler);
+    ASSERT_EQ(currentScheduler().concurrency(), low_power.threads());
+  }
+
+  ASSERT_EQ(currentScheduler().concurrency(), 1u);
+
+  // Workers of a profile run CPU kernels with the profile
+  std::promise<const IScheduler *> promise;
+
+  low_power.pool().submit([&] { promise.set_value(&currentScheduler()); });
+
+  ASSERT_EQ(promise.get_future().get(), &scheduler);
+}
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <NeuralNetworks.h>
+
+#include <vector>
+
+#include "exec/Sink.h"
+#include "internal/Convert.h"
+
+namespace
+{
+
+// NOTE A tensor of another type than the CPU one takes the element-wise copy path as ACL tensors do
+class CopiedTensor final : public neurun::backend::cpu::operand::Tensor
+{
+public:
+  using neurun::backend::cpu::operand::Tensor::Tensor;
+};
+
+} // namespace
+
+TEST(exec_VectorSink, quant8)
+{
+  const neurun::graph::operand::TypeInfo type{ANEURALNETWORKS_TENSOR_QUANT8_ASYMM, 0.5f, 128};
+  std::vector<uint8_t> result{1, 2, 3, 4, 5, 6};
+
+  std::vector<uint8_t> output(result.size());
+
+  CopiedTensor tensor{::internal::asTensorInfo(2, 3, type)};
+  tensor.setBuffer(result.data());
+
+  neurun::exec::VectorSink sink{2, 3, output.data(), output.size()};
+
+  sink.bind(tensor);
+  sink.pull(tensor);
+
+  ASSERT_EQ(output, result);
+}
+
+TEST(exec_VectorSink, bind_cpu_tensor)
+{
+  const neurun::graph::operand::TypeInfo type{ANEURALNETWORKS_TENSOR_QUANT8_ASYMM, 0.5f, 128};
+
+  std::vector<uint8_t> output(6);
+
+  neurun::backend::cpu::operand::Tensor tensor{::internal::asTensorInfo(2, 3, type)};
+
+  neurun::exec::VectorSink sink{2, 3, output.data(), output.size()};
+
+  // CPU tensor writes the result into the user buffer directly
+  sink.bind(tensor);
+
+  ASSERT_EQ(tensor.buffer(), output.data());
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <NeuralNetworks.h>
+
+#include <vector>
+
+#include "exec/Source.h"
+#include "internal/Convert.h"
+
+namespace
+{
+
+// NOTE A tensor of another type than the CPU one takes the element-wise copy path as ACL tensors do
+class CopiedTensor final : public neurun::backend::cpu::operand::Tensor
+{
+public:
+  using neurun::backend::cpu::operand::Tensor::Tensor;
+};
+
+} // namespace
+
+TEST(exec_VectorSource, quant8)
+{
+  const neurun::graph::operand::TypeInfo type{ANEURALNETWORKS_TENSOR_QUANT8_ASYMM, 0.5f, 128};
+  const std::vector<uint8_t> input{1, 2, 3, 4, 5, 6};
+
+  std::vector<uint8_t> buffer(input.size());
+
+  CopiedTensor tensor{::internal::asTensorInfo(2, 3, type)};
+  tensor.setBuffer(buffer.data());
+
+  neurun::exec::VectorSource source{2, 3, input.data(), input.size()};
+
+  source.push(tensor);
+
+  ASSERT_EQ(buffer, input);
+}
+
+TEST(exec_VectorSource, float32)
+{
+  const neurun::graph::operand::TypeInfo type{ANEURALNETWORKS_TENSOR_FLOAT32, 0, 0};
+  const std::vector<float> input{0.5f, 1.5f, 2.5f, 3.5f};
+
+  std::vector<float> buffer(input.size());
+
+  CopiedTensor tensor{::internal::asTensorInfo(2, 2, type)};
+  tensor.setBuffer(reinterpret_cast<uint8_t *>(buffer.data()));
+
+  neurun::exec::VectorSource source{2, 2, reinterpret_cast<const uint8_t *>(input.data()),
+                                    input.size() * sizeof(float)};
+
+  source.push(tensor);
+
+  ASSERT_EQ(buffer, input);
+}
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+#include "exec/ThreadPool.h"
+
+TEST(exec_ThreadPool, run_all_tasks)
+{
+  neurun::exec::ThreadPool pool{4};
+
+  ASSERT_EQ(pool.size(), 4);
+
+  const uint32_t count = 1000;
+
+  std::atomic<uint32_t> sum{0};
+  std::atomic<uint32_t> remaining{count};
+
+  std::mutex mutex;
+  std::condition_variable cv;
+
+  for (uint32_t n = 0; n < count; ++n)
+  {
+    pool.submit([&, n] {
+      sum += n;
+      if (remaining.fetch_sub(1) == 1)
+      {
+        std::lock_guard<std::mutex> lock{mutex};
+        cv.notify_all();
+      }
+    });
+  }
+
+  std::unique_lock<std::mutex> lock{mutex};
+  cv.wait(lock, [&] { return remaining == 0; });
+
+  ASSERT_EQ(sum, count * (count - 1) / 2);
+}
+
+TEST(exec_ThreadPool, submit_from_worker)
+{
+  neurun::exec::ThreadPool pool{2};
+
+  const uint32_t depth = 100;
+
+  std::atomic<uint32_t> visited{0};
+
+  std::mutex mutex;
+  std::condition_variable cv;
+
+  std::function<void(uint32_t)> chain = [&](uint32_t n) {
+    visited += 1;
+    if (n + 1 < depth)
+    {
+      pool.submit([&, n] { chain(n + 1); });
+    }
+    else
+    {
+      std::lock_guard<std::mutex> lock{mutex};
+      cv.notify_all();
+    }
+  };
+
+  pool.submit([&] { chain(0); });
+
+  std::unique_lock<std::mutex> lock{mutex};
+  cv.wait(lock, [&] { return visited == depth; });
+
+  ASSERT_EQ(visited, depth);
+}
+
+TEST(exec_ThreadPool, parallel)
+{
+  neurun::exec::ThreadPool pool{4};
+
+  const uint32_t count = 100;
+
+  std::vector<std::atomic<uint32_t>> visits(count);
+
+  pool.parallel(count, [&](uint32_t n) { visits.at(n) += 1; });
+
+  for (uint32_t n = 0; n < count; ++n)
+  {
+    ASSERT_EQ(visits.at(n), 1);
+  }
+}
+
+TEST(exec_ThreadPool, parallel_from_worker)
+{
+  neurun::exec::ThreadPool pool{2};
+
+  std::atomic<uint32_t> sum{0};
+  std::atomic<uint32_t> remaining{2};
+
+  std::mutex mutex;
+  std::condition_variable cv;
+
+  // Every worker is busy with an outer task that waits on nested parallel calls
+  for (uint32_t n = 0; n < 2; ++n)
+  {
+    pool.submit([&] {
+      pool.parallel(10, [&](uint32_t k) { sum += k; });
+      if (remaining.fetch_sub(1) == 1)
+      {
+        std::lock_guard<std::mutex> lock{mutex};
+        cv.notify_all();
+      }
+    });
+  }
+
+  std::unique_lock<std::mutex> lock{mutex};
+  cv.wait(lock, [&] { return remaining == 0; });
+
+  ASSERT_EQ(sum, 2 * 45);
+}
+
+TEST(exec_ThreadPool, init_workers)
+{
+  std::mutex mutex;
+  std::vector<uint32_t> indexes;
+
+  {
+    neurun::exec::ThreadPool pool{3, false, [&](uint32_t index) {
+                                    std::lock_guard<std::mutex> lock{mutex};
+                                    indexes.emplace_back(index);
+                                  }};
+  }
+
+  std::sort(indexes.begin(), indexes.end());
+
+  ASSERT_EQ(indexes, (std::vector<uint32_t>{0, 1, 2}));
+}
+
+TEST(exec_ThreadPool, parallel_with_spin)
+{
+  neurun::exec::ThreadPool pool{4, true};
+
+  std::atomic<uint32_t> sum{0};
+
+  // Workers spin between the calls
+  for (uint32_t n = 0; n < 100; ++n)
+  {
+    pool.parallel(8, [&](uint32_t k) { sum += k; });
+  }
+
+  ASSERT_EQ(sum, 100 * 28);
+}
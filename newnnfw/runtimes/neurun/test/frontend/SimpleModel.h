@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NEURUN_TEST_FRONTEND_SIMPLE_MODEL_H__
+#define __NEURUN_TEST_FRONTEND_SIMPLE_MODEL_H__
+
+#include <NeuralNetworks.h>
+
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+namespace neurun_test
+{
+namespace frontend
+{
+
+// input [batch, 1, 1, 4] -> FullyConnected -> [batch, 3] -> Softmax -> output [batch, 3]
+//
+// NOTE The input is a feature map, as the CPU backend assumes for FullyConnected
+//      The weights pick the first two elements of each input row, and the bias is zero
+class SimpleModel
+{
+public:
+  static constexpr uint32_t INPUT_SIZE = 4;
+  static constexpr uint32_t OUTPUT_SIZE = 3;
+
+public:
+  // NOTE The weights are read from 'weight_memory' if given (see 'weights()' for its contents)
+  SimpleModel(uint32_t batch = 1, const ANeuralNetworksMemory *weight_memory = nullptr)
+      : _batch{batch}
+  {
+    // NOTE Every operation runs on the CPU backend so that this runs without a GPU
+    setenv("OP_BACKEND_ALLOPS", "cpu", 1);
+
+    ANeuralNetworksModel_create(&_model);
+
+    uint32_t input_dims[4] = {batch, 1, 1, INPUT_SIZE};
+    uint32_t weight_dims[2] = {OUTPUT_SIZE, INPUT_SIZE};
+    uint32_t bias_dims[1] = {OUTPUT_SIZE};
+    uint32_t output_dims[2] = {batch, OUTPUT_SIZE};
+
+    ANeuralNetworksOperandType input_type{ANEURALNETWORKS_TENSOR_FLOAT32, 4, input_dims, 0, 0};
+    ANeuralNetworksOperandType weight_type{ANEURALNETWORKS_TENSOR_FLOAT32, 2, weight_dims, 0, 0};
+    ANeuralNetworksOperandType bias_type{ANEURALNETWORKS_TENSOR_FLOAT32, 1, bias_dims, 0, 0};
+    ANeuralNetworksOperandType output_type{ANEURALNETWORKS_TENSOR_FLOAT32, 2, output_dims, 0, 0};
+    ANeuralNetworksOperandType int32_type{ANEURALNETWORKS_INT32, 0, nullptr, 0, 0};
+    ANeuralNetworksOperandType float32_type{ANEURALNETWORKS_FLOAT32, 0, nullptr, 0, 0};
+
+    ANeuralNetworksModel_addOperand(_model, &input_type);   // 0: input
+    ANeuralNetworksModel_addOperand(_model, &weight_type);  // 1: weights
+    ANeuralNetworksModel_addOperand(_model, &bias_type);    // 2: bias
+    ANeuralNetworksModel_addOperand(_model, &int32_type);   // 3: activation
+    ANeuralNetworksModel_addOperand(_model, &output_type);  // 4: logits
+    ANeuralNetworksModel_addOperand(_model, &float32_type); // 5: beta
+    ANeuralNetworksModel_addOperand(_model, &output_type);  // 6: output
+
+    const float bias[OUTPUT_SIZE] = {0, 0, 0};
+    const int32_t activation = ANEURALNETWORKS_FUSED_NONE;
+    const float beta = 1.0f;
+
+    if (weight_memory == nullptr)
+    {
+      const auto values = SimpleModel::weights();
+      ANeuralNetworksModel_setOperandValue(_model, 1, values.data(), values.size() * sizeof(float));
+    }
+    else
+    {
+      ANeuralNetworksModel_setOperandValueFromMemory(_model, 1, weight_memory, 0,
+                                                     OUTPUT_SIZE * INPUT_SIZE * sizeof(float));
+    }
+    ANeuralNetworksModel_setOperandValue(_model, 2, bias, sizeof(bias));
+    ANeuralNetworksModel_setOperandValue(_model, 3, &activation, sizeof(activation));
+    ANeuralNetworksModel_setOperandValue(_model, 5, &beta, sizeof(beta));
+
+    const uint32_t fc_inputs[4] = {0, 1, 2, 3};
+    const uint32_t fc_outputs[1] = {4};
+    const uint32_t softmax_inputs[2] = {4, 5};
+    const uint32_t softmax_outputs[1] = {6};
+
+    ANeuralNetworksModel_addOperation(_model, ANEURALNETWORKS_FULLY_CONNECTED, 4, fc_inputs, 1,
+                                      fc_outputs);
+    ANeuralNetworksModel_addOperation(_model, ANEURALNETWORKS_SOFTMAX, 2, softmax_inputs, 1,
+                                      softmax_outputs);
+
+    const uint32_t model_inputs[1] = {0};
+    const uint32_t model_outputs[1] = {6};
+
+    ANeuralNetworksModel_identifyInputsAndOutputs(_model, 1, model_inputs, 1, model_outputs);
+    ANeuralNetworksModel_finish(_model);
+  }
+
+public:
+  ~SimpleModel() { ANeuralNetworksModel_free(_model); }
+
+public:
+  ANeuralNetworksModel *get(void) const { return _model; }
+  uint32_t batch(void) const { return _batch; }
+
+public:
+  static std::vector<float> weights(void) { return {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0}; }
+
+public:
+  // Input whose rows differ from each other
+  std::vector<float> input(void) const
+  {
+    std::vector<float> values(_batch * INPUT_SIZE);
+
+    for (uint32_t n = 0; n < values.size(); ++n)
+    {
+      values[n] = 0.25f * static_cast<float>(n % 7) - 0.5f;
+    }
+
+    return values;
+  }
+
+  // Output computed without the runtime
+  std::vector<float> expected(const std::vector<float> &input) const
+  {
+    std::vector<float> values(_batch * OUTPUT_SIZE);
+
+    for (uint32_t b = 0; b < _batch; ++b)
+    {
+      const float logits[OUTPUT_SIZE] = {input[b * INPUT_SIZE], input[b * INPUT_SIZE + 1], 0.0f};
+
+      float sum = 0.0f;
+      for (uint32_t n = 0; n < OUTPUT_SIZE; ++n)
+      {
+        sum += std::exp(logits[n]);
+      }
+      for (uint32_t n = 0; n < OUTPUT_SIZE; ++n)
+      {
+        values[b * OUTPUT_SIZE + n] = std::exp(logits[n]) / sum;
+      }
+    }
+
+    return values;
+  }
+
+private:
+  uint32_t _batch;
+  ANeuralNetworksModel *_model = nullptr;
+};
+
+} // namespace frontend
+} // namespace neurun_test
+
+#endif // __NEURUN_TEST_FRONTEND_SIMPLE_MODEL_H__
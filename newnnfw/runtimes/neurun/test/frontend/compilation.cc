@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <NeuralNetworks.h>
+#include <NeuralNetworksEx.h>
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <dirent.h>
+#include <unistd.h>
+
+#include "SimpleModel.h"
+
+namespace
+{
+
+using SimpleModel = neurun_test::frontend::SimpleModel;
+
+// Compiles 'model' for 'batch' inputs at once (if non-zero), and runs it over the input of
+// 'reference', which is expected to give the output of 'reference'
+void verify(const SimpleModel &model, uint32_t batch, const SimpleModel &reference)
+{
+  ANeuralNetworksCompilation *compilation = nullptr;
+  ASSERT_EQ(ANeuralNetworksCompilation_create(model.get(), &compilation),
+            ANEURALNETWORKS_NO_ERROR);
+  if (batch != 0)
+  {
+    ASSERT_EQ(ANeuralNetworksCompilation_setBatchSizeEx(compilation, batch),
+              ANEURALNETWORKS_NO_ERROR);
+  }
+  ASSERT_EQ(ANeuralNetworksCompilation_finish(compilation), ANEURALNETWORKS_NO_ERROR);
+
+  const auto input = reference.input();
+  const auto expected = reference.expected(input);
+  std::vector<float> output(expected.size(), -1.0f);
+
+  ANeuralNetworksExecution *execution = nullptr;
+  ASSERT_EQ(ANeuralNetworksExecution_create(compilation, &execution), ANEURALNETWORKS_NO_ERROR);
+  ASSERT_EQ(ANeuralNetworksExecution_setInput(execution, 0, nullptr, input.data(),
+                                              input.size() * sizeof(float)),
+            ANEURALNETWORKS_NO_ERROR);
+  ASSERT_EQ(ANeuralNetworksExecution_setOutput(execution, 0, nullptr, output.data(),
+                                               output.size() * sizeof(float)),
+            ANEURALNETWORKS_NO_ERROR);
+
+  ANeuralNetworksEvent *event = nullptr;
+  ASSERT_EQ(ANeuralNetworksExecution_startCompute(execution, &event), ANEURALNETWORKS_NO_ERROR);
+  ASSERT_EQ(ANeuralNetworksEvent_wait(event), ANEURALNETWORKS_NO_ERROR);
+
+  for (uint32_t n = 0; n < output.size(); ++n)
+  {
+    EXPECT_NEAR(output[n], expected[n], 1e-5f) << "at " << n;
+  }
+
+  ANeuralNetworksEvent_free(event);
+  ANeuralNetworksExecution_free(execution);
+  ANeuralNetworksCompilation_free(compilation);
+}
+
+// Names of the files in 'dir'
+std::vector<std::string> list(const std::string &dir)
+{
+  std::vector<std::string> names;
+
+  if (auto handle = opendir(dir.c_str()))
+  {
+    while (auto entry = readdir(handle))
+    {
+      const std::string name{entry->d_name};
+      if (name != "." && name != "..")
+      {
+        names.emplace_back(name);
+      }
+    }
+    closedir(handle);
+  }
+
+  return names;
+}
+
+} // namespace
+
+TEST(frontend_compilation, batch)
+{
+  SimpleModel model{5};
+
+  verify(model, 0, model);
+}
+
+TEST(frontend_compilation, set_batch_size)
+{
+  SimpleModel model;
+  SimpleModel reference{4};
+
+  verify(model, 4, reference);
+}
+
+TEST(frontend_compilation, set_batch_size_after_finish)
+{
+  SimpleModel model;
+
+  ANeuralNetworksCompilation *compilation = nullptr;
+  ASSERT_EQ(ANeuralNetworksCompilation_create(model.get(), &compilation),
+            ANEURALNETWORKS_NO_ERROR);
+
+  ASSERT_EQ(ANeuralNetworksCompilation_setBatchSizeEx(compilation, 0), ANEURALNETWORKS_BAD_DATA);
+  ASSERT_EQ(ANeuralNetworksCompilation_finish(compilation), ANEURALNETWORKS_NO_ERROR);
+  ASSERT_EQ(ANeuralNetworksCompilation_setBatchSizeEx(compilation, 2), ANEURALNETWORKS_BAD_STATE);
+
+  ANeuralNetworksCompilation_free(compilation);
+}
+
+TEST(frontend_compilation, auto_backend)
+{
+  SimpleModel model;
+  SimpleModel cached;
+
+  char dir[] = "/tmp/neurun_backend_profile.XXXXXX";
+  ASSERT_NE(mkdtemp(dir), nullptr);
+
+  // NOTE This profiles operations on every backend, and saves the assignment into 'dir'. The
+  //      backend of each operation type is the fallback for the operations that fail to run.
+  setenv("OP_BACKEND_ALLOPS", "auto", 1);
+  setenv("OP_BACKEND_FULLY_CONNECTED", "cpu", 1);
+  setenv("OP_BACKEND_SOFTMAX", "cpu", 1);
+  setenv("NEURUN_BACKEND_PROFILE_DIR", dir, 1);
+
+  verify(model, 0, model);
+
+  const auto names = list(dir);
+  ASSERT_EQ(names.size(), 1);
+
+  // The same model loads the saved assignment
+  verify(cached, 0, cached);
+  ASSERT_EQ(list(dir), names);
+
+  unsetenv("NEURUN_BACKEND_PROFILE_DIR");
+  unsetenv("OP_BACKEND_SOFTMAX");
+  unsetenv("OP_BACKEND_FULLY_CONNECTED");
+  setenv("OP_BACKEND_ALLOPS", "cpu", 1);
+
+  unlink((std::string{dir} + "/" + names.at(0)).c_str());
+  rmdir(dir);
+}
@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <NeuralNetworks.h>
+
+#include <vector>
+
+#include "SimpleModel.h"
+
+namespace
+{
+
+using SimpleModel = neurun_test::frontend::SimpleModel;
+
+class Compilation
+{
+public:
+  Compilation(const SimpleModel &model)
+  {
+    ANeuralNetworksCompilation_create(model.get(), &_compilation);
+    ANeuralNetworksCompilation_finish(_compilation);
+  }
+
+public:
+  ~Compilation() { ANeuralNetworksCompilation_free(_compilation); }
+
+public:
+  ANeuralNetworksCompilation *get(void) const { return _compilation; }
+
+private:
+  ANeuralNetworksCompilation *_compilation = nullptr;
+};
+
+// Creates an execution from 'input' to 'output', and starts it
+ANeuralNetworksEvent *start(const Compilation &compilation, ANeuralNetworksExecution *&execution,
+                            const std::vector<float> &input, std::vector<float> &output)
+{
+  ANeuralNetworksEvent *event = nullptr;
+
+  EXPECT_EQ(ANeuralNetworksExecution_create(compilation.get(), &execution),
+            ANEURALNETWORKS_NO_ERROR);
+  EXPECT_EQ(ANeuralNetworksExecution_setInput(execution, 0, nullptr, input.data(),
+                                              input.size() * sizeof(float)),
+            ANEURALNETWORKS_NO_ERROR);
+  EXPECT_EQ(ANeuralNetworksExecution_setOutput(execution, 0, nullptr, output.data(),
+                                               output.size() * sizeof(float)),
+            ANEURALNETWORKS_NO_ERROR);
+  EXPECT_EQ(ANeuralNetworksExecution_startCompute(execution, &event), ANEURALNETWORKS_NO_ERROR);
+
+  return event;
+}
+
+void expectNear(const std::vector<float> &actual, const std::vector<float> &expected)
+{
+  ASSERT_EQ(actual.size(), expected.size());
+
+  for (uint32_t n = 0; n < actual.size(); ++n)
+  {
+    EXPECT_NEAR(actual[n], expected[n], 1e-5f) << "at " << n;
+  }
+}
+
+} // namespace
+
+TEST(frontend_execution, start_compute_and_wait)
+{
+  SimpleModel model;
+  Compilation compilation{model};
+
+  const auto input = model.input();
+  std::vector<float> output(SimpleModel::OUTPUT_SIZE, -1.0f);
+
+  ANeuralNetworksExecution *execution = nullptr;
+  ANeuralNetworksEvent *event = start(compilation, execution, input, output);
+
+  ASSERT_EQ(ANeuralNetworksEvent_wait(event), ANEURALNETWORKS_NO_ERROR);
+  expectNear(output, model.expected(input));
+
+  // Waiting again returns the same result
+  ASSERT_EQ(ANeuralNetworksEvent_wait(event), ANEURALNETWORKS_NO_ERROR);
+
+  ANeuralNetworksEvent_free(event);
+  ANeuralNetworksExecution_free(execution);
+}
+
+TEST(frontend_execution, executions_in_flight)
+{
+  SimpleModel model;
+  Compilation compilation{model};
+
+  const uint32_t count = 8;
+
+  std::vector<std::vector<float>> inputs(count);
+  std::vector<std::vector<float>> outputs(count);
+  std::vector<ANeuralNetworksExecution *> executions(count, nullptr);
+  std::vector<ANeuralNetworksEvent *> events(count, nullptr);
+
+  for (uint32_t n = 0; n < count; ++n)
+  {
+    inputs[n] = model.input();
+    inputs[n][0] = static_cast<float>(n);
+    outputs[n].resize(SimpleModel::OUTPUT_SIZE);
+
+    events[n] = start(compilation, executions[n], inputs[n], outputs[n]);
+  }
+
+  for (uint32_t n = 0; n < count; ++n)
+  {
+    ASSERT_EQ(ANeuralNetworksEvent_wait(events[n]), ANEURALNETWORKS_NO_ERROR);
+    expectNear(outputs[n], model.expected(inputs[n]));
+
+    ANeuralNetworksEvent_free(events[n]);
+    ANeuralNetworksExecution_free(executions[n]);
+  }
+}
+
+TEST(frontend_execution, free_execution_in_flight)
+{
+  SimpleModel model;
+  Compilation compilation{model};
+
+  const auto input = model.input();
+  std::vector<float> output(SimpleModel::OUTPUT_SIZE, -1.0f);
+
+  ANeuralNetworksExecution *execution = nullptr;
+  ANeuralNetworksEvent *event = start(compilation, execution, input, output);
+
+  // NOTE This waits for the computation, which still refers to the execution
+  ANeuralNetworksExecution_free(execution);
+  expectNear(output, model.expected(input));
+
+  // The event outlives its execution
+  ASSERT_EQ(ANeuralNetworksEvent_wait(event), ANEURALNETWORKS_NO_ERROR);
+  ANeuralNetworksEvent_free(event);
+}
+
+TEST(frontend_execution, free_event_in_flight)
+{
+  SimpleModel model;
+  Compilation compilation{model};
+
+  const auto input = model.input();
+  std::vector<float> output(SimpleModel::OUTPUT_SIZE, -1.0f);
+
+  ANeuralNetworksExecution *execution = nullptr;
+  ANeuralNetworksEvent *event = start(compilation, execution, input, output);
+
+  // NOTE This waits for the computation as well
+  ANeuralNetworksEvent_free(event);
+  expectNear(output, model.expected(input));
+
+  ANeuralNetworksExecution_free(execution);
+}
+
+TEST(frontend_execution, null_arguments)
+{
+  ANeuralNetworksEvent *event = nullptr;
+
+  ASSERT_EQ(ANeuralNetworksExecution_startCompute(nullptr, &event),
+            ANEURALNETWORKS_UNEXPECTED_NULL);
+  ASSERT_EQ(ANeuralNetworksEvent_wait(nullptr), ANEURALNETWORKS_UNEXPECTED_NULL);
+
+  // NOTE Freeing nothing is allowed
+  ANeuralNetworksEvent_free(nullptr);
+  ANeuralNetworksExecution_free(nullptr);
+}
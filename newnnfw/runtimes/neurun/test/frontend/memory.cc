@@ -0,0 +1,254 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <NeuralNetworks.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <string>
+#include <limits>
+#include <vector>
+
+#include "SimpleModel.h"
+
+namespace
+{
+
+using SimpleModel = neurun_test::frontend::SimpleModel;
+
+// Anonymous file of 'size' bytes, which is removed when closed
+class TempFile
+{
+public:
+  TempFile(size_t size) : _file{std::tmpfile()}
+  {
+    EXPECT_NE(_file, nullptr);
+    EXPECT_EQ(ftruncate(fd(), size), 0);
+  }
+
+public:
+  ~TempFile() { std::fclose(_file); }
+
+public:
+  int fd(void) const { return fileno(_file); }
+
+public:
+  void write(const std::vector<float> &values, size_t offset)
+  {
+    const size_t size = values.size() * sizeof(float);
+    EXPECT_EQ(pwrite(fd(), values.data(), size, offset), static_cast<ssize_t>(size));
+  }
+
+  std::vector<float> read(size_t count, size_t offset) const
+  {
+    std::vector<float> values(count);
+    const size_t size = count * sizeof(float);
+    EXPECT_EQ(pread(fd(), values.data(), size, offset), static_cast<ssize_t>(size));
+    return values;
+  }
+
+private:
+  std::FILE *_file;
+};
+
+void expectNear(const std::vector<float> &actual, const std::vector<float> &expected)
+{
+  ASSERT_EQ(actual.size(), expected.size());
+
+  for (uint32_t n = 0; n < actual.size(); ++n)
+  {
+    EXPECT_NEAR(actual[n], expected[n], 1e-5f) << "at " << n;
+  }
+}
+
+} // namespace
+
+TEST(frontend_memory, offset_overflow)
+{
+  SimpleModel model;
+
+  ANeuralNetworksCompilation *compilation = nullptr;
+  ASSERT_EQ(ANeuralNetworksCompilation_create(model.get(), &compilation),
+            ANEURALNETWORKS_NO_ERROR);
+  ASSERT_EQ(ANeuralNetworksCompilation_finish(compilation), ANEURALNETWORKS_NO_ERROR);
+
+  ANeuralNetworksExecution *execution = nullptr;
+  ASSERT_EQ(ANeuralNetworksExecution_create(compilation, &execution), ANEURALNETWORKS_NO_ERROR);
+
+  const size_t size = 64;
+  TempFile file{size};
+
+  ANeuralNetworksMemory *memory = nullptr;
+  ASSERT_EQ(ANeuralNetworksMemory_createFromFd(size, PROT_READ | PROT_WRITE, file.fd(), 0, &memory),
+            ANEURALNETWORKS_NO_ERROR);
+
+  // NOTE 'offset + length' wraps around to a value within the memory
+  const size_t offset = std::numeric_limits<size_t>::max() - 7;
+  const size_t length = 16;
+
+  ASSERT_EQ(ANeuralNetworksExecution_setInputFromMemory(execution, 0, nullptr, memory, offset,
+                                                        length),
+            ANEURALNETWORKS_BAD_DATA);
+  ASSERT_EQ(ANeuralNetworksExecution_setOutputFromMemory(execution, 0, nullptr, memory, offset,
+                                                         length),
+            ANEURALNETWORKS_BAD_DATA);
+  ASSERT_EQ(ANeuralNetworksExecution_setInputFromMemory(execution, 0, nullptr, memory, size + 1,
+                                                        0),
+            ANEURALNETWORKS_BAD_DATA);
+
+  ANeuralNetworksMemory_free(memory);
+  ANeuralNetworksExecution_free(execution);
+  ANeuralNetworksCompilation_free(compilation);
+}
+
+TEST(frontend_memory, read_only_output)
+{
+  SimpleModel model;
+
+  ANeuralNetworksCompilation *compilation = nullptr;
+  ASSERT_EQ(ANeuralNetworksCompilation_create(model.get(), &compilation),
+            ANEURALNETWORKS_NO_ERROR);
+  ASSERT_EQ(ANeuralNetworksCompilation_finish(compilation), ANEURALNETWORKS_NO_ERROR);
+
+  ANeuralNetworksExecution *execution = nullptr;
+  ASSERT_EQ(ANeuralNetworksExecution_create(compilation, &execution), ANEURALNETWORKS_NO_ERROR);
+
+  const size_t size = SimpleModel::INPUT_SIZE * sizeof(float);
+  TempFile file{size};
+
+  ANeuralNetworksMemory *memory = nullptr;
+  ASSERT_EQ(ANeuralNetworksMemory_createFromFd(size, PROT_READ, file.fd(), 0, &memory),
+            ANEURALNETWORKS_NO_ERROR);
+
+  // NOTE A memory without PROT_WRITE may be read, but may not be written
+  ASSERT_EQ(ANeuralNetworksExecution_setInputFromMemory(execution, 0, nullptr, memory, 0, size),
+            ANEURALNETWORKS_NO_ERROR);
+  ASSERT_EQ(ANeuralNetworksExecution_setOutputFromMemory(
+                execution, 0, nullptr, memory, 0, SimpleModel::OUTPUT_SIZE * sizeof(float)),
+            ANEURALNETWORKS_BAD_DATA);
+
+  ANeuralNetworksMemory_free(memory);
+  ANeuralNetworksExecution_free(execution);
+  ANeuralNetworksCompilation_free(compilation);
+}
+
+TEST(frontend_memory, input_and_output_from_memory)
+{
+  SimpleModel model;
+
+  ANeuralNetworksCompilation *compilation = nullptr;
+  ASSERT_EQ(ANeuralNetworksCompilation_create(model.get(), &compilation),
+            ANEURALNETWORKS_NO_ERROR);
+  ASSERT_EQ(ANeuralNetworksCompilation_finish(compilation), ANEURALNETWORKS_NO_ERROR);
+
+  ANeuralNetworksExecution *execution = nullptr;
+  ASSERT_EQ(ANeuralNetworksExecution_create(compilation, &execution), ANEURALNETWORKS_NO_ERROR);
+
+  // The input comes first, and then the output
+  const size_t input_size = SimpleModel::INPUT_SIZE * sizeof(float);
+  const size_t output_size = SimpleModel::OUTPUT_SIZE * sizeof(float);
+  TempFile file{input_size + output_size};
+
+  const auto input = model.input();
+  file.write(input, 0);
+
+  ANeuralNetworksMemory *memory = nullptr;
+  ASSERT_EQ(ANeuralNetworksMemory_createFromFd(input_size + output_size, PROT_READ | PROT_WRITE,
+                                               file.fd(), 0, &memory),
+            ANEURALNETWORKS_NO_ERROR);
+
+  ASSERT_EQ(
+      ANeuralNetworksExecution_setInputFromMemory(execution, 0, nullptr, memory, 0, input_size),
+      ANEURALNETWORKS_NO_ERROR);
+  ASSERT_EQ(ANeuralNetworksExecution_setOutputFromMemory(execution, 0, nullptr, memory,
+                                                         input_size, output_size),
+            ANEURALNETWORKS_NO_ERROR);
+
+  ANeuralNetworksEvent *event = nullptr;
+  ASSERT_EQ(ANeuralNetworksExecution_startCompute(execution, &event), ANEURALNETWORKS_NO_ERROR);
+  ASSERT_EQ(ANeuralNetworksEvent_wait(event), ANEURALNETWORKS_NO_ERROR);
+
+  // NOTE The output is written through a shared mapping, so the file has it
+  expectNear(file.read(SimpleModel::OUTPUT_SIZE, input_size), model.expected(input));
+
+  ANeuralNetworksEvent_free(event);
+  ANeuralNetworksMemory_free(memory);
+  ANeuralNetworksExecution_free(execution);
+  ANeuralNetworksCompilation_free(compilation);
+}
+
+TEST(frontend_memory, operand_value_from_memory)
+{
+  const auto weights = SimpleModel::weights();
+  const size_t size = weights.size() * sizeof(float);
+
+  TempFile file{size};
+  file.write(weights, 0);
+
+  // NOTE The fd is read-only, so a shared writable mapping is not allowed
+  const std::string path = "/proc/self/fd/" + std::to_string(file.fd());
+  const int fd = open(path.c_str(), O_RDONLY);
+  ASSERT_GE(fd, 0);
+
+  ANeuralNetworksMemory *memory = nullptr;
+  ASSERT_EQ(ANeuralNetworksMemory_createFromFd(size, PROT_READ | PROT_WRITE, fd, 0, &memory),
+            ANEURALNETWORKS_NO_ERROR);
+
+  SimpleModel model{1, memory};
+
+  ANeuralNetworksCompilation *compilation = nullptr;
+  ASSERT_EQ(ANeuralNetworksCompilation_create(model.get(), &compilation),
+            ANEURALNETWORKS_NO_ERROR);
+  ASSERT_EQ(ANeuralNetworksCompilation_finish(compilation), ANEURALNETWORKS_NO_ERROR);
+
+  ANeuralNetworksExecution *execution = nullptr;
+  ASSERT_EQ(ANeuralNetworksExecution_create(compilation, &execution), ANEURALNETWORKS_NO_ERROR);
+
+  const auto input = model.input();
+  std::vector<float> output(SimpleModel::OUTPUT_SIZE, -1.0f);
+
+  ASSERT_EQ(ANeuralNetworksExecution_setInput(execution, 0, nullptr, input.data(),
+                                              input.size() * sizeof(float)),
+            ANEURALNETWORKS_NO_ERROR);
+  ASSERT_EQ(ANeuralNetworksExecution_setOutput(execution, 0, nullptr, output.data(),
+                                               output.size() * sizeof(float)),
+            ANEURALNETWORKS_NO_ERROR);
+
+  ANeuralNetworksEvent *event = nullptr;
+  ASSERT_EQ(ANeuralNetworksExecution_startCompute(execution, &event), ANEURALNETWORKS_NO_ERROR);
+  ASSERT_EQ(ANeuralNetworksEvent_wait(event), ANEURALNETWORKS_NO_ERROR);
+
+  expectNear(output, model.expected(input));
+
+  ANeuralNetworksEvent_free(event);
+  ANeuralNetworksExecution_free(execution);
+  ANeuralNetworksCompilation_free(compilation);
+  ANeuralNetworksMemory_free(memory);
+  close(fd);
+}
+
+TEST(frontend_memory, bad_fd)
+{
+  ANeuralNetworksMemory *memory = nullptr;
+
+  ASSERT_EQ(ANeuralNetworksMemory_createFromFd(64, PROT_READ, -1, 0, &memory),
+            ANEURALNETWORKS_BAD_DATA);
+}
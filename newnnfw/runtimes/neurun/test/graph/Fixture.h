@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NEURUN_TEST_GRAPH_FIXTURE_H__
+#define __NEURUN_TEST_GRAPH_FIXTURE_H__
+
+#include <memory>
+#include <string>
+
+#include "graph/Graph.h"
+#include "graph/operation/LowerInfo.h"
+#include "backend/BackendManager.h"
+#include "backend/IBackendConfig.h"
+#include "nnfw/std/memory.h"
+
+namespace neurun_test
+{
+namespace graph
+{
+
+class MockBackendConfig : public neurun::backend::IBackendConfig
+{
+public:
+  MockBackendConfig(neurun::graph::operand::Layout layout = neurun::graph::operand::Layout::NHWC)
+      : _layout{layout}
+  {
+    // DO NOTHING
+  }
+
+public:
+  void initialize() override {}
+  std::string id() override { return "mock"; }
+  neurun::graph::operand::Layout getOperandLayout() override { return _layout; }
+  bool supportConcurrentExecution() override { return true; }
+  void sync() override {}
+
+private:
+  neurun::graph::operand::Layout _layout;
+};
+
+inline neurun::backend::Backend
+makeBackend(neurun::graph::operand::Layout layout = neurun::graph::operand::Layout::NHWC)
+{
+  return {std::make_shared<MockBackendConfig>(layout), nullptr, nullptr};
+}
+
+// Adds a float feature map operand of a single batch
+inline neurun::graph::operand::Index addFeature(neurun::graph::Graph &graph, int32_t height,
+                                                int32_t width, int32_t depth)
+{
+  neurun::graph::operand::Shape shape{4u};
+  neurun::graph::operand::TypeInfo type{ANEURALNETWORKS_TENSOR_FLOAT32, 0, 0};
+
+  shape.dim(0) = 1;
+  shape.dim(1) = height;
+  shape.dim(2) = width;
+  shape.dim(3) = depth;
+
+  return graph.addOperand(shape, type);
+}
+
+// Assigns 'backend' to every operation of 'graph'
+inline void lower(neurun::graph::Graph &graph, const neurun::backend::Backend &backend)
+{
+  graph.operations().iterate(
+      [&](const neurun::graph::operation::Index &, neurun::graph::operation::Node &node) {
+        node.lower_info(nnfw::make_unique<neurun::graph::operation::LowerInfo>(backend));
+      });
+}
+
+} // namespace graph
+} // namespace neurun_test
+
+#endif // __NEURUN_TEST_GRAPH_FIXTURE_H__
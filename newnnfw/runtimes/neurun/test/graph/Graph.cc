@@ -16,7 +16,11 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 #include "graph/Graph.h"
+#include "nnfw/std/memory.h"
+#include "operation/MockNode.h"
 
 TEST(Graph, inputs_and_outputs)
 {
@@ -50,3 +54,160 @@ TEST(Graph, inputs_and_outputs)
   ASSERT_EQ(graph.getOutputs().at(io_index1), 11);
   ASSERT_EQ(graph.getOutputs().at(io_index2), 12);
 }
+
+TEST(Graph, post_dfs_deep_chain)
+{
+  using IndexSet = ::neurun::graph::operand::IndexSet;
+  using MockNode = ::neurun_test::graph::operation::SimpleMockNode;
+
+  ::neurun::graph::Graph graph;
+
+  ::neurun::graph::operand::Shape shape{1u};
+  ::neurun::graph::operand::TypeInfo type{ANEURALNETWORKS_TENSOR_INT32, 0, 0};
+  shape.dim(0) = 1;
+
+  // NOTE This is deep enough to overflow the call stack with recursive DFS
+  const uint32_t depth = 200000;
+
+  std::vector<::neurun::graph::operand::Index> operands;
+  for (uint32_t n = 0; n <= depth; ++n)
+  {
+    operands.emplace_back(graph.addOperand(shape, type));
+    if (n != 0)
+    {
+      graph.operands().at(operands.back()).setAsOperationOutput();
+    }
+  }
+
+  graph.addInput(operands.front());
+  graph.operands().at(operands.front()).setAsModelInput();
+  graph.addOutput(operands.back());
+
+  for (uint32_t n = 0; n < depth; ++n)
+  {
+    const IndexSet inputs{operands[n]};
+    const IndexSet outputs{operands[n + 1]};
+    graph.addOperation(nnfw::make_unique<MockNode>(inputs, outputs));
+  }
+
+  graph.finishBuilding();
+
+  std::vector<const ::neurun::graph::operation::Node *> order;
+  ::neurun::graph::Graph::PostDfsConstIterator().iterate(
+      graph, [&](const ::neurun::graph::operation::Node &node) { order.emplace_back(&node); });
+
+  ASSERT_EQ(order.size(), depth);
+  for (uint32_t n = 0; n < depth; ++n)
+  {
+    const ::neurun::graph::operation::Index index{depth - 1 - n};
+    ASSERT_EQ(order[n], &graph.operations().at(index));
+  }
+}
+
+TEST(Graph, set_batch_size)
+{
+  using IndexSet = ::neurun::graph::operand::IndexSet;
+  using MockNode = ::neurun_test::graph::operation::SimpleMockNode;
+
+  ::neurun::graph::Graph graph;
+
+  ::neurun::graph::operand::TypeInfo type{ANEURALNETWORKS_TENSOR_FLOAT32, 0, 0};
+
+  ::neurun::graph::operand::Shape vector_shape{2u};
+  vector_shape.dim(0) = 1;
+  vector_shape.dim(1) = 4;
+
+  ::neurun::graph::operand::Shape weight_shape{2u};
+  weight_shape.dim(0) = 3;
+  weight_shape.dim(1) = 4;
+
+  auto input = graph.addOperand(vector_shape, type);
+  auto weight = graph.addOperand(weight_shape, type);
+  auto output = graph.addOperand(vector_shape, type);
+
+  graph.operands().at(input).setAsModelInput();
+  graph.operands().at(weight).setAsConstant();
+  graph.operands().at(output).setAsOperationOutput();
+
+  graph.addInput(input);
+  graph.addOutput(output);
+  graph.addOperation(nnfw::make_unique<MockNode>(IndexSet{input, weight}, IndexSet{output}));
+
+  graph.finishBuilding();
+
+  ASSERT_TRUE(graph.setBatchSize(8));
+
+  ASSERT_EQ(graph.operands().at(input).shape().dim(0), 8);
+  ASSERT_EQ(graph.operands().at(output).shape().dim(0), 8);
+  // Constants have no batch
+  ASSERT_EQ(graph.operands().at(weight).shape().dim(0), 3);
+}
+
+TEST(Graph, set_batch_size_without_batch)
+{
+  using IndexSet = ::neurun::graph::operand::IndexSet;
+  using MockNode = ::neurun_test::graph::operation::SimpleMockNode;
+
+  ::neurun::graph::Graph graph;
+
+  ::neurun::graph::operand::TypeInfo type{ANEURALNETWORKS_TENSOR_FLOAT32, 0, 0};
+
+  ::neurun::graph::operand::Shape scalar_shape{1u};
+  scalar_shape.dim(0) = 1;
+
+  ::neurun::graph::operand::Shape vector_shape{2u};
+  vector_shape.dim(0) = 1;
+  vector_shape.dim(1) = 4;
+
+  // NOTE A rank-1 operand computed at runtime has no batch dimension
+  auto input = graph.addOperand(scalar_shape, type);
+  auto output = graph.addOperand(vector_shape, type);
+
+  graph.operands().at(input).setAsModelInput();
+  graph.operands().at(output).setAsOperationOutput();
+
+  graph.addInput(input);
+  graph.addOutput(output);
+  graph.addOperation(nnfw::make_unique<MockNode>(IndexSet{input}, IndexSet{output}));
+
+  graph.finishBuilding();
+
+  ASSERT_FALSE(graph.setBatchSize(8));
+
+  ASSERT_EQ(graph.operands().at(output).shape().dim(0), 1);
+}
+
+TEST(Graph, report_phases)
+{
+  using IndexSet = ::neurun::graph::operand::IndexSet;
+  using MockNode = ::neurun_test::graph::operation::SimpleMockNode;
+
+  ::neurun::graph::Graph graph;
+
+  ::neurun::graph::operand::TypeInfo type{ANEURALNETWORKS_TENSOR_FLOAT32, 0, 0};
+
+  ::neurun::graph::operand::Shape shape{1u};
+  shape.dim(0) = 4;
+
+  auto input = graph.addOperand(shape, type);
+  auto output = graph.addOperand(shape, type);
+
+  graph.operands().at(input).setAsModelInput();
+  graph.operands().at(output).setAsOperationOutput();
+
+  graph.addInput(input);
+  graph.addOutput(output);
+  graph.addOperation(nnfw::make_unique<MockNode>(IndexSet{input}, IndexSet{output}));
+
+  ASSERT_TRUE(graph.report().phases().empty());
+
+  graph.finishBuilding();
+
+  const auto &report = graph.report();
+
+  ASSERT_EQ(report.phases().size(), 3);
+  ASSERT_EQ(report.phases().at(0).name, "finishBuilding");
+  ASSERT_EQ(report.find("finishBuilding")->runs, 1);
+  ASSERT_EQ(report.find("finishBuilding/verify")->runs, 1);
+  ASSERT_EQ(report.find("finishBuilding/constantFolding")->runs, 1);
+}
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "graph/Graph.h"
+#include "graph/operation/Concat.h"
+#include "graph/operation/Reshape.h"
+#include "nnfw/std/memory.h"
+#include "../operation/MockNode.h"
+
+namespace
+{
+
+using Graph = neurun::graph::Graph;
+using Index = neurun::graph::operand::Index;
+using IndexSet = neurun::graph::operand::IndexSet;
+using MockNode = neurun_test::graph::operation::SimpleMockNode;
+
+Index addTensor(Graph &graph, std::initializer_list<int32_t> dims)
+{
+  neurun::graph::operand::Shape shape(dims.size());
+  neurun::graph::operand::TypeInfo type{ANEURALNETWORKS_TENSOR_FLOAT32, 0, 0};
+
+  uint32_t axis = 0;
+  for (auto dim : dims)
+  {
+    shape.dim(axis++) = dim;
+  }
+
+  return graph.addOperand(shape, type);
+}
+
+template <typename T>
+void setConstant(Graph &graph, const Index &index, const std::vector<T> &value)
+{
+  graph.operands().at(index).setAsConstant();
+  graph.setOperandValue(index, nnfw::make_unique<neurun::graph::operand::CachedData>(
+                                   reinterpret_cast<const uint8_t *>(value.data()),
+                                   value.size() * sizeof(T)));
+}
+
+} // namespace
+
+TEST(graph_pass_ConstantFoldingPass, fold_constant_subgraph)
+{
+  Graph graph;
+
+  // (a, b) -> Concat -> c -> Reshape -> d -> MockNode -> output
+  //                                input -> MockNode
+  auto a = addTensor(graph, {2});
+  auto b = addTensor(graph, {2});
+  auto axis = graph.addOperand(neurun::graph::operand::Shape{0u},
+                               neurun::graph::operand::TypeInfo{ANEURALNETWORKS_INT32, 0, 0});
+  auto c = addTensor(graph, {4});
+  auto d = addTensor(graph, {2, 2});
+  auto input = addTensor(graph, {2, 2});
+  auto output = addTensor(graph, {2, 2});
+
+  setConstant<float>(graph, a, {1.0f, 2.0f});
+  setConstant<float>(graph, b, {3.0f, 4.0f});
+  setConstant<int32_t>(graph, axis, {0});
+
+  graph.addInput(input);
+  graph.operands().at(input).setAsModelInput();
+  graph.addOutput(output);
+  for (const auto &ind : {c, d, output})
+  {
+    graph.operands().at(ind).setAsOperationOutput();
+  }
+
+  const uint32_t concat_inputs[] = {a.value(), b.value(), axis.value()};
+  const uint32_t concat_outputs[] = {c.value()};
+  graph.addOperation(nnfw::make_unique<neurun::graph::operation::Concat::Node>(
+      neurun::graph::operation::Node::InitParam{3, concat_inputs, 1, concat_outputs}));
+
+  // NOTE Reshape does not read its shape operand (see Reshape::Node)
+  const uint32_t reshape_inputs[] = {c.value(), c.value()};
+  const uint32_t reshape_outputs[] = {d.value()};
+  graph.addOperation(nnfw::make_unique<neurun::graph::operation::Reshape::Node>(
+      neurun::graph::operation::Node::InitParam{2, reshape_inputs, 1, reshape_outputs}));
+
+  graph.addOperation(nnfw::make_unique<MockNode>(IndexSet{d, input}, IndexSet{output}));
+
+  graph.finishBuilding();
+
+  // Only the operation that reads the model input remains, and it is renumbered
+  ASSERT_EQ(graph.operations().size(), 1);
+  ASSERT_EQ(graph.operands().at(output).getDef().list().front(), 0);
+
+  const auto &folded = graph.operands().at(d);
+  ASSERT_TRUE(folded.isConstant());
+  ASSERT_EQ(folded.getDef().size(), 0);
+  ASSERT_EQ(folded.getUses().size(), 1);
+  ASSERT_EQ(folded.data().size(), 4 * sizeof(float));
+
+  const auto values = reinterpret_cast<const float *>(folded.data().base());
+  for (uint32_t n = 0; n < 4; ++n)
+  {
+    ASSERT_EQ(values[n], static_cast<float>(n + 1));
+  }
+
+  ASSERT_EQ(graph.operands().at(c).getUses().size(), 0);
+}
+
+TEST(graph_pass_ConstantFoldingPass, keep_model_output)
+{
+  Graph graph;
+
+  // a -> Reshape -> output
+  auto a = addTensor(graph, {4});
+  auto output = addTensor(graph, {2, 2});
+
+  setConstant<float>(graph, a, {1.0f, 2.0f, 3.0f, 4.0f});
+
+  graph.addOutput(output);
+  graph.operands().at(output).setAsOperationOutput();
+
+  const uint32_t reshape_inputs[] = {a.value(), a.value()};
+  const uint32_t reshape_outputs[] = {output.value()};
+  graph.addOperation(nnfw::make_unique<neurun::graph::operation::Reshape::Node>(
+      neurun::graph::operation::Node::InitParam{2, reshape_inputs, 1, reshape_outputs}));
+
+  graph.finishBuilding();
+
+  ASSERT_EQ(graph.operations().size(), 1);
+  ASSERT_FALSE(graph.operands().at(output).isConstant());
+}
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <typeinfo>
+
+#include "graph/Graph.h"
+#include "graph/operation/LowerInfo.h"
+#include "graph/operation/Permute.h"
+#include "graph/operation/Reshape.h"
+#include "graph/pass/LayoutPropagationPass.h"
+#include "nnfw/std/memory.h"
+#include "../Fixture.h"
+#include "../operation/MockNode.h"
+
+namespace
+{
+
+using Graph = neurun::graph::Graph;
+using IndexSet = neurun::graph::operand::IndexSet;
+using Layout = neurun::graph::operand::Layout;
+using MockNode = neurun_test::graph::operation::SimpleMockNode;
+using neurun_test::graph::addFeature;
+using neurun_test::graph::makeBackend;
+
+void assign(Graph &graph, const neurun::graph::operation::Index &index,
+            const neurun::backend::Backend &backend)
+{
+  graph.operations().at(index).lower_info(
+      nnfw::make_unique<neurun::graph::operation::LowerInfo>(backend));
+}
+
+uint32_t countPermutes(const Graph &graph)
+{
+  uint32_t count = 0;
+
+  graph.operations().iterate(
+      [&](const neurun::graph::operation::Index &, const neurun::graph::operation::Node &node) {
+        if (typeid(node) == typeid(neurun::graph::operation::Permute::Node))
+        {
+          ++count;
+        }
+      });
+
+  return count;
+}
+
+} // namespace
+
+TEST(graph_pass_LayoutPropagationPass, share_permute)
+{
+  Graph graph;
+
+  auto nchw = makeBackend(Layout::NCHW);
+  auto nhwc = makeBackend(Layout::NHWC);
+
+  // (nchw) -> x -> (nhwc)
+  //             -> (nhwc)
+  auto input = addFeature(graph, 1, 1, 8);
+  auto x = addFeature(graph, 1, 1, 8);
+  auto y = addFeature(graph, 1, 1, 8);
+  auto z = addFeature(graph, 1, 1, 8);
+
+  graph.addInput(input);
+  graph.operands().at(input).setAsModelInput();
+  graph.operands().at(x).setAsOperationOutput();
+  graph.addOutput(y);
+  graph.operands().at(y).setAsOperationOutput();
+  graph.addOutput(z);
+  graph.operands().at(z).setAsOperationOutput();
+
+  auto def = graph.addOperation(nnfw::make_unique<MockNode>(IndexSet{input}, IndexSet{x}));
+  auto use1 = graph.addOperation(nnfw::make_unique<MockNode>(IndexSet{x}, IndexSet{y}));
+  auto use2 = graph.addOperation(nnfw::make_unique<MockNode>(IndexSet{x}, IndexSet{z}));
+
+  graph.finishBuilding();
+
+  assign(graph, def, nchw);
+  assign(graph, use1, nhwc);
+  assign(graph, use2, nhwc);
+
+  neurun::graph::pass::LayoutPropagationPass{graph, nhwc}.run();
+
+  ASSERT_EQ(countPermutes(graph), 1);
+
+  // Both uses read the same permuted operand
+  const auto permuted = graph.operations().at(use1).getInputs().at(0);
+  ASSERT_NE(permuted, x);
+  ASSERT_EQ(graph.operations().at(use2).getInputs().at(0), permuted);
+  ASSERT_EQ(graph.operands().at(x).getUses().size(), 1);
+  ASSERT_EQ(graph.operands().at(permuted).getUses().size(), 2);
+
+  const auto permute = graph.operands().at(permuted).getDef().list().front();
+  const auto &node =
+      static_cast<const neurun::graph::operation::Permute::Node &>(graph.operations().at(permute));
+  ASSERT_EQ(node.param().type, neurun::graph::operation::Permute::Type::NCHW_TO_NHWC);
+}
+
+TEST(graph_pass_LayoutPropagationPass, move_layout_agnostic_operation)
+{
+  Graph graph;
+
+  auto nchw = makeBackend(Layout::NCHW);
+  auto nhwc = makeBackend(Layout::NHWC);
+
+  // (nchw) -> x -> Reshape (nhwc) -> y -> (nchw)
+  auto input = addFeature(graph, 1, 1, 8);
+  auto x = addFeature(graph, 1, 1, 8);
+  auto y = addFeature(graph, 1, 1, 8);
+  auto output = addFeature(graph, 1, 1, 8);
+
+  graph.addInput(input);
+  graph.operands().at(input).setAsModelInput();
+  graph.operands().at(x).setAsOperationOutput();
+  graph.operands().at(y).setAsOperationOutput();
+  graph.addOutput(output);
+  graph.operands().at(output).setAsOperationOutput();
+
+  const uint32_t reshape_inputs[] = {x.value(), 0};
+  const uint32_t reshape_outputs[] = {y.value()};
+  const neurun::graph::operation::Node::InitParam reshape_param{2, reshape_inputs, 1,
+                                                                reshape_outputs};
+
+  auto def = graph.addOperation(nnfw::make_unique<MockNode>(IndexSet{input}, IndexSet{x}));
+  auto reshape =
+      graph.addOperation(nnfw::make_unique<neurun::graph::operation::Reshape::Node>(reshape_param));
+  auto use = graph.addOperation(nnfw::make_unique<MockNode>(IndexSet{y}, IndexSet{output}));
+
+  graph.finishBuilding();
+
+  assign(graph, def, nchw);
+  assign(graph, reshape, nhwc);
+  assign(graph, use, nchw);
+
+  neurun::graph::pass::LayoutPropagationPass{graph, nhwc}.run();
+
+  // Reshape follows the operations around it instead of permuting its input and output
+  ASSERT_EQ(countPermutes(graph), 0);
+  ASSERT_EQ(graph.operations().at(reshape).lower_info()->backend().config(), nchw.config());
+}
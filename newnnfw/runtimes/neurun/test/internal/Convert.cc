@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <NeuralNetworks.h>
+
+#include "internal/Convert.h"
+
+using TypeInfo = neurun::graph::operand::TypeInfo;
+
+TEST(internal_Convert, asTensorInfo_quant8)
+{
+  const TypeInfo type{ANEURALNETWORKS_TENSOR_QUANT8_ASYMM, 0.5f, 128};
+  const nnfw::util::feature::Shape shape{1, 3, 2, 4};
+
+  const auto info = ::internal::asTensorInfo(shape, type);
+
+  ASSERT_EQ(info.data_type(), ::arm_compute::DataType::QASYMM8);
+  ASSERT_EQ(info.quantization_info().scale, 0.5f);
+  ASSERT_EQ(info.quantization_info().offset, 128);
+
+  // ARM Compute uses WHCN ordering, and a QUANT8 element takes a single byte
+  ASSERT_EQ(info.dimension(0), 4u);
+  ASSERT_EQ(info.dimension(1), 2u);
+  ASSERT_EQ(info.dimension(2), 3u);
+  ASSERT_EQ(info.total_size(), 1u * 3 * 2 * 4);
+}
+
+TEST(internal_Convert, asTensorInfo_types)
+{
+  const TypeInfo float32{ANEURALNETWORKS_TENSOR_FLOAT32, 0.0f, 0};
+  const TypeInfo int32{ANEURALNETWORKS_TENSOR_INT32, 0.25f, 0};
+
+  const auto float_info = ::internal::asTensorInfo(2, 3, float32);
+
+  ASSERT_EQ(float_info.data_type(), ::arm_compute::DataType::F32);
+  ASSERT_EQ(float_info.total_size(), 2u * 3 * sizeof(float));
+
+  // NOTE The bias of a quantized Conv2D/FullyConnected is INT32
+  const auto int32_info = ::internal::asTensorInfo(5, int32);
+
+  ASSERT_EQ(int32_info.data_type(), ::arm_compute::DataType::S32);
+  ASSERT_EQ(int32_info.total_size(), 5u * sizeof(int32_t));
+}
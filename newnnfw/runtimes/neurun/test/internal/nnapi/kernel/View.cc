@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <NeuralNetworks.h>
+
+#include <vector>
+
+#include "backend/cpu/operand/Tensor.h"
+#include "internal/Convert.h"
+#include "internal/nnapi/kernel/View.h"
+
+namespace
+{
+
+using TypeInfo = neurun::graph::operand::TypeInfo;
+
+template <typename T> void checkNHWC(const TypeInfo &type)
+{
+  // N = 2, H = 3, W = 4, C = 5
+  const nnfw::util::kernel::Shape shape{2, 5, 3, 4};
+
+  std::vector<T> buffer(2 * 3 * 4 * 5);
+
+  neurun::backend::cpu::operand::Tensor tensor{::internal::asTensorInfo(shape, type)};
+  tensor.setBuffer(reinterpret_cast<uint8_t *>(buffer.data()));
+
+  ::internal::nnapi::kernel::View<T> view{&tensor};
+
+  ASSERT_EQ(view.shape().N, 2);
+  ASSERT_EQ(view.shape().C, 5);
+  ASSERT_EQ(view.shape().H, 3);
+  ASSERT_EQ(view.shape().W, 4);
+
+  view.at(1, 2, 3, 4) = static_cast<T>(7);
+
+  // NNAPI uses NHWC ordering
+  const uint32_t index = ((1 * 3 + 2) * 4 + 3) * 5 + 4;
+
+  ASSERT_EQ(buffer[index], static_cast<T>(7));
+
+  const auto &reader = static_cast<const nnfw::util::kernel::Reader<T> &>(view);
+  ASSERT_EQ(reader.at(1, 2, 3, 4), static_cast<T>(7));
+}
+
+} // namespace
+
+TEST(internal_nnapi_kernel_View, float32)
+{
+  checkNHWC<float>({ANEURALNETWORKS_TENSOR_FLOAT32, 0, 0});
+}
+
+TEST(internal_nnapi_kernel_View, quant8)
+{
+  checkNHWC<uint8_t>({ANEURALNETWORKS_TENSOR_QUANT8_ASYMM, 0.5f, 128});
+}
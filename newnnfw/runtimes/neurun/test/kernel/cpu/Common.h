@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NEURUN_TEST_KERNEL_CPU_COMMON_H__
+#define __NEURUN_TEST_KERNEL_CPU_COMMON_H__
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "kernel/cpu/OperationUtils.h"
+
+namespace neurun_test
+{
+namespace kernel
+{
+namespace cpu
+{
+
+inline neurun::kernel::cpu::Shape makeShape(std::vector<uint32_t> dimensions)
+{
+  neurun::kernel::cpu::Shape shape;
+  shape.type = OperandType::TENSOR_FLOAT32;
+  shape.dimensions = dimensions;
+  shape.scale = 0.0f;
+  shape.offset = 0;
+  return shape;
+}
+
+// Values in [-0.5, 0.5) that repeat every 'period' elements
+inline std::vector<float> sequence(uint32_t size, uint32_t period)
+{
+  std::vector<float> values(size);
+  for (uint32_t n = 0; n < size; ++n)
+  {
+    values[n] = static_cast<float>(n % period) / period - 0.5f;
+  }
+  return values;
+}
+
+// Shape of a NHWC feature map
+struct Feature
+{
+  uint32_t batches;
+  uint32_t height;
+  uint32_t width;
+  uint32_t depth;
+
+  uint32_t size(void) const { return batches * height * width * depth; }
+};
+
+// Naive convolution (without activation) as the reference that kernels are checked against
+//
+// 'weight(oc, ky, kx, ic)' returns the weight between an input and an output channel, whatever
+// the layout of the kernel is (e.g. 0 for the channels that a depthwise kernel does not connect)
+template <typename WeightFn>
+std::vector<float> naiveConv(const std::vector<float> &input, const Feature &in,
+                             const Feature &out, uint32_t kernelSize, uint32_t stride,
+                             uint32_t padding, const std::vector<float> &bias, WeightFn weight)
+{
+  std::vector<float> output(out.size());
+
+  for (uint32_t b = 0; b < out.batches; ++b)
+  {
+    for (uint32_t row = 0; row < out.height; ++row)
+    {
+      for (uint32_t col = 0; col < out.width; ++col)
+      {
+        for (uint32_t oc = 0; oc < out.depth; ++oc)
+        {
+          float expected = bias[oc];
+          for (uint32_t ky = 0; ky < kernelSize; ++ky)
+          {
+            for (uint32_t kx = 0; kx < kernelSize; ++kx)
+            {
+              const int32_t y = row * stride + ky - padding;
+              const int32_t x = col * stride + kx - padding;
+              if (y < 0 || y >= static_cast<int32_t>(in.height) || x < 0 ||
+                  x >= static_cast<int32_t>(in.width))
+              {
+                continue;
+              }
+              for (uint32_t ic = 0; ic < in.depth; ++ic)
+              {
+                expected += input[((b * in.height + y) * in.width + x) * in.depth + ic] *
+                            weight(oc, ky, kx, ic);
+              }
+            }
+          }
+          output[((b * out.height + row) * out.width + col) * out.depth + oc] = expected;
+        }
+      }
+    }
+  }
+
+  return output;
+}
+
+inline void expectNear(const std::vector<float> &actual, const std::vector<float> &expected,
+                       float abs_error)
+{
+  ASSERT_EQ(actual.size(), expected.size());
+
+  for (uint32_t n = 0; n < expected.size(); ++n)
+  {
+    ASSERT_NEAR(actual[n], expected[n], abs_error) << "at " << n;
+  }
+}
+
+} // namespace cpu
+} // namespace kernel
+} // namespace neurun_test
+
+#endif // __NEURUN_TEST_KERNEL_CPU_COMMON_H__
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "kernel/cpu/DepthwiseConvolutionLayer.h"
+#include "backend/cpu/operand/Tensor.h"
+
+#include <vector>
+
+#include "Common.h"
+
+using Tensor = neurun::backend::cpu::operand::Tensor;
+using namespace neurun_test::kernel::cpu;
+
+namespace
+{
+
+// Runs a DepthwiseConvolutionLayer and checks its output against a naive implementation
+void verify(uint32_t height, uint32_t width, uint32_t depth, uint32_t multiplier,
+            uint32_t kernelSize, uint32_t stride, uint32_t padding)
+{
+  const uint32_t outHeight = (height + 2 * padding - kernelSize) / stride + 1;
+  const uint32_t outWidth = (width + 2 * padding - kernelSize) / stride + 1;
+  const uint32_t outDepth = depth * multiplier;
+
+  auto input = sequence(height * width * depth, 7);
+  auto kernel = sequence(kernelSize * kernelSize * outDepth, 5);
+  auto bias = sequence(outDepth, 3);
+  std::vector<float> output(outHeight * outWidth * outDepth);
+
+  Tensor input_tensor{reinterpret_cast<uint8_t *>(input.data())};
+  Tensor kernel_tensor{reinterpret_cast<uint8_t *>(kernel.data())};
+  Tensor bias_tensor{reinterpret_cast<uint8_t *>(bias.data())};
+  Tensor output_tensor{reinterpret_cast<uint8_t *>(output.data())};
+
+  neurun::kernel::cpu::DepthwiseConvolutionLayer layer;
+  layer.configure(&input_tensor, makeShape({1, height, width, depth}), &kernel_tensor,
+                  makeShape({1, kernelSize, kernelSize, outDepth}), &bias_tensor,
+                  makeShape({outDepth}), padding, padding, padding, padding, stride, stride,
+                  multiplier, ANEURALNETWORKS_FUSED_NONE, &output_tensor,
+                  makeShape({1, outHeight, outWidth, outDepth}));
+  layer.run();
+
+  // NOTE Output channel 'oc' is connected only to input channel 'oc / multiplier'
+  const auto expected =
+      naiveConv(input, {1, height, width, depth}, {1, outHeight, outWidth, outDepth}, kernelSize,
+                stride, padding, bias, [&](uint32_t oc, uint32_t ky, uint32_t kx, uint32_t ic) {
+                  return (ic == oc / multiplier) ? kernel[(ky * kernelSize + kx) * outDepth + oc]
+                                                 : 0.0f;
+                });
+
+  expectNear(output, expected, 1e-5);
+}
+
+} // namespace
+
+TEST(kernel_cpu_DepthwiseConvolutionLayer, float_3x3_stride1) { verify(9, 7, 13, 1, 3, 1, 1); }
+
+TEST(kernel_cpu_DepthwiseConvolutionLayer, float_3x3_stride2) { verify(9, 8, 8, 1, 3, 2, 1); }
+
+TEST(kernel_cpu_DepthwiseConvolutionLayer, float_generic) { verify(8, 9, 3, 2, 5, 1, 2); }
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "kernel/cpu/PackedGemm.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "Common.h"
+
+using neurun::kernel::cpu::kPanelWidth;
+using namespace neurun_test::kernel::cpu;
+
+namespace
+{
+
+// Runs gemmPacked over slices of 'slice' units and checks its output against a naive GEMM
+// clamped to [-bound, bound]
+void verify(uint32_t rows, uint32_t depth, uint32_t units, uint32_t slice, float bound = 1.0f)
+{
+  const float output_min = -bound;
+  const float output_max = bound;
+
+  auto lhs = sequence(rows * depth, 7);
+  auto weights = sequence(units * depth, 5);
+  auto bias = sequence(units, 3);
+
+  std::vector<float> packed(units * depth);
+  std::vector<float> output(rows * units);
+
+  neurun::kernel::cpu::packWeights(weights.data(), units, depth, packed.data());
+
+  for (uint32_t begin = 0; begin < units; begin += slice)
+  {
+    const uint32_t end = std::min(begin + slice, units);
+    neurun::kernel::cpu::gemmPacked(lhs.data(), rows, depth, packed.data(), units, bias.data(),
+                                    output_min, output_max, output.data(), begin, end);
+  }
+
+  // NOTE A GEMM is a 1x1 convolution of 'rows' pixels
+  auto expected = naiveConv(lhs, {1, rows, 1, depth}, {1, rows, 1, units}, 1, 1, 0, bias,
+                            [&](uint32_t oc, uint32_t, uint32_t, uint32_t ic) {
+                              return weights[oc * depth + ic];
+                            });
+  for (auto &value : expected)
+  {
+    value = std::min(std::max(value, output_min), output_max);
+  }
+
+  expectNear(output, expected, 1e-5);
+}
+
+} // namespace
+
+TEST(kernel_cpu_PackedGemm, single_row) { verify(1, 37, 3 * kPanelWidth, 3 * kPanelWidth); }
+
+TEST(kernel_cpu_PackedGemm, partial_panel_and_rows) { verify(7, 19, 2 * kPanelWidth + 3, 100); }
+
+TEST(kernel_cpu_PackedGemm, slices) { verify(9, 16, 5 * kPanelWidth + 1, 2 * kPanelWidth); }
+
+// NOTE Large enough to have several row and depth tiles, and a bound that keeps the partial sums
+//      of depth tiles from being clamped
+TEST(kernel_cpu_PackedGemm, tiles) { verify(70, 600, 3 * kPanelWidth + 3, 100, 1e3f); }
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "kernel/cpu/ScratchArena.h"
+
+using neurun::kernel::cpu::ScratchArena;
+
+TEST(kernel_cpu_ScratchArena, grow_to_requested_size)
+{
+  ScratchArena::User user;
+  auto &arena = ScratchArena::local();
+
+  arena.get(256);
+  ASSERT_GE(arena.capacity(), 256u);
+
+  // A smaller request reuses the same buffer
+  const auto buffer = arena.get(256);
+  ASSERT_EQ(arena.get(16), buffer);
+  ASSERT_EQ(arena.capacity(), 256u);
+
+  arena.get(1024);
+  ASSERT_EQ(arena.capacity(), 1024u);
+}
+
+TEST(kernel_cpu_ScratchArena, release_with_last_user)
+{
+  std::unique_ptr<ScratchArena::User> first{new ScratchArena::User};
+  std::unique_ptr<ScratchArena::User> second{new ScratchArena::User};
+
+  ScratchArena *other = nullptr;
+  bool released = false;
+
+  bool exit = false;
+  std::mutex mutex;
+  std::condition_variable cond;
+
+  // NOTE The other thread keeps running so that its arena is alive
+  std::thread thread{[&] {
+    std::unique_lock<std::mutex> lock{mutex};
+    other = &ScratchArena::local();
+    other->get(512);
+    cond.notify_all();
+    cond.wait(lock, [&] { return exit; });
+    released = (other->capacity() == 0);
+  }};
+
+  {
+    std::unique_lock<std::mutex> lock{mutex};
+    cond.wait(lock, [&] { return other != nullptr; });
+  }
+
+  ScratchArena::local().get(512);
+
+  first.reset();
+  ASSERT_EQ(ScratchArena::local().capacity(), 512u);
+
+  second.reset();
+  ASSERT_EQ(ScratchArena::local().capacity(), 0u);
+
+  {
+    std::lock_guard<std::mutex> lock{mutex};
+    exit = true;
+  }
+  cond.notify_all();
+  thread.join();
+
+  ASSERT_TRUE(released);
+}
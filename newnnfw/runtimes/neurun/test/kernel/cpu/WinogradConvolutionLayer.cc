@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "kernel/cpu/WinogradConvolutionLayer.h"
+#include "backend/cpu/operand/Tensor.h"
+
+#include <vector>
+
+#include "Common.h"
+
+using Tensor = neurun::backend::cpu::operand::Tensor;
+using namespace neurun_test::kernel::cpu;
+
+namespace
+{
+
+// Runs a WinogradConvolutionLayer and checks its output against a naive implementation
+void verify(uint32_t batches, uint32_t height, uint32_t width, uint32_t depth, uint32_t outDepth,
+            uint32_t padding, uint32_t tile)
+{
+  const uint32_t outHeight = height + 2 * padding - 2;
+  const uint32_t outWidth = width + 2 * padding - 2;
+
+  auto input = sequence(batches * height * width * depth, 7);
+  auto kernel = sequence(outDepth * 3 * 3 * depth, 5);
+  auto bias = sequence(outDepth, 3);
+  std::vector<float> output(batches * outHeight * outWidth * outDepth);
+
+  Tensor input_tensor{reinterpret_cast<uint8_t *>(input.data())};
+  Tensor kernel_tensor{reinterpret_cast<uint8_t *>(kernel.data())};
+  Tensor bias_tensor{reinterpret_cast<uint8_t *>(bias.data())};
+  Tensor output_tensor{reinterpret_cast<uint8_t *>(output.data())};
+
+  neurun::kernel::cpu::WinogradConvolutionLayer layer;
+  layer.configure(&input_tensor, makeShape({batches, height, width, depth}), &kernel_tensor,
+                  makeShape({outDepth, 3, 3, depth}), &bias_tensor, makeShape({outDepth}), padding,
+                  padding, ANEURALNETWORKS_FUSED_NONE, &output_tensor,
+                  makeShape({batches, outHeight, outWidth, outDepth}), tile);
+  layer.prepare();
+  layer.run();
+
+  const auto expected =
+      naiveConv(input, {batches, height, width, depth}, {batches, outHeight, outWidth, outDepth},
+                3, 1, padding, bias, [&](uint32_t oc, uint32_t ky, uint32_t kx, uint32_t ic) {
+                  return kernel[((oc * 3 + ky) * 3 + kx) * depth + ic];
+                });
+
+  expectNear(output, expected, 1e-4);
+}
+
+} // namespace
+
+TEST(kernel_cpu_WinogradConvolutionLayer, float_2x2) { verify(1, 9, 7, 5, 11, 1, 2); }
+
+TEST(kernel_cpu_WinogradConvolutionLayer, float_4x4) { verify(2, 12, 13, 3, 17, 1, 4); }
+
+TEST(kernel_cpu_WinogradConvolutionLayer, float_4x4_valid) { verify(1, 11, 10, 8, 9, 0, 4); }
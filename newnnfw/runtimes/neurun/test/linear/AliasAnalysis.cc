@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "graph/Graph.h"
+#include "graph/operation/Concat.h"
+#include "graph/operation/Reshape.h"
+#include "linear/AliasAnalysis.h"
+#include "nnfw/std/memory.h"
+#include "../graph/Fixture.h"
+#include "../graph/operation/MockNode.h"
+
+namespace
+{
+
+using Graph = neurun::graph::Graph;
+using Index = neurun::graph::operand::Index;
+using IndexSet = neurun::graph::operand::IndexSet;
+using MockNode = neurun_test::graph::operation::SimpleMockNode;
+using AliasAnalysis = neurun::linear::AliasAnalysis;
+using neurun_test::graph::addFeature;
+
+// Builds '(input -> MockNode -> a, input -> MockNode -> b) -> Concat -> output' over depth
+std::vector<const neurun::graph::operation::Node *> buildConcat(Graph &graph, int32_t size)
+{
+  auto input = addFeature(graph, size, size, 1);
+  auto a = addFeature(graph, size, size, 2);
+  auto b = addFeature(graph, size, size, 3);
+  auto output = addFeature(graph, size, size, 5);
+  auto axis = graph.addOperand(neurun::graph::operand::Shape{0u},
+                               neurun::graph::operand::TypeInfo{ANEURALNETWORKS_INT32, 0, 0});
+
+  const int32_t axis_value = 3;
+  graph.operands().at(axis).setAsConstant();
+  graph.setOperandValue(axis, nnfw::make_unique<neurun::graph::operand::CachedData>(
+                                  reinterpret_cast<const uint8_t *>(&axis_value), sizeof(int32_t)));
+
+  graph.addInput(input);
+  graph.operands().at(input).setAsModelInput();
+  graph.addOutput(output);
+  for (const auto &ind : {a, b, output})
+  {
+    graph.operands().at(ind).setAsOperationOutput();
+  }
+
+  const uint32_t concat_inputs[] = {a.value(), b.value(), axis.value()};
+  const uint32_t concat_outputs[] = {output.value()};
+
+  auto def_a = graph.addOperation(nnfw::make_unique<MockNode>(IndexSet{input}, IndexSet{a}));
+  auto def_b = graph.addOperation(nnfw::make_unique<MockNode>(IndexSet{input}, IndexSet{b}));
+  auto concat = graph.addOperation(nnfw::make_unique<neurun::graph::operation::Concat::Node>(
+      neurun::graph::operation::Node::InitParam{3, concat_inputs, 1, concat_outputs}));
+
+  graph.finishBuilding();
+
+  return {&graph.operations().at(def_a), &graph.operations().at(def_b),
+          &graph.operations().at(concat)};
+}
+
+} // namespace
+
+TEST(linear_AliasAnalysis, reshape)
+{
+  Graph graph;
+
+  // input -> MockNode -> x -> Reshape -> y
+  auto input = addFeature(graph, 1, 1, 4);
+  auto x = addFeature(graph, 1, 1, 4);
+  neurun::graph::operand::Shape shape{2u};
+  shape.dim(0) = 1;
+  shape.dim(1) = 4;
+  auto y = graph.addOperand(shape, {ANEURALNETWORKS_TENSOR_FLOAT32, 0, 0});
+
+  graph.addInput(input);
+  graph.operands().at(input).setAsModelInput();
+  graph.addOutput(y);
+  graph.operands().at(x).setAsOperationOutput();
+  graph.operands().at(y).setAsOperationOutput();
+
+  const uint32_t reshape_inputs[] = {x.value(), x.value()};
+  const uint32_t reshape_outputs[] = {y.value()};
+
+  auto def = graph.addOperation(nnfw::make_unique<MockNode>(IndexSet{input}, IndexSet{x}));
+  auto reshape = graph.addOperation(nnfw::make_unique<neurun::graph::operation::Reshape::Node>(
+      neurun::graph::operation::Node::InitParam{2, reshape_inputs, 1, reshape_outputs}));
+
+  graph.finishBuilding();
+
+  AliasAnalysis analysis{graph,
+                         {&graph.operations().at(def), &graph.operations().at(reshape)},
+                         [](const Index &, const Index &) { return true; }};
+
+  ASSERT_EQ(analysis.aliases().size(), 1);
+  ASSERT_EQ(analysis.aliases()[0].ind, y);
+  ASSERT_EQ(analysis.aliases()[0].parent, x);
+  ASSERT_EQ(analysis.aliases()[0].offset, 0);
+}
+
+TEST(linear_AliasAnalysis, contiguous_concat)
+{
+  Graph graph;
+
+  auto operations = buildConcat(graph, 1);
+  AliasAnalysis analysis{graph, operations, [](const Index &, const Index &) { return true; }};
+
+  const auto &output = graph.getOutputs().at(neurun::graph::operand::IO::Index{0});
+  const auto &inputs = operations.back()->getInputs();
+
+  ASSERT_EQ(analysis.aliases().size(), 2);
+  for (uint32_t n = 0; n < 2; ++n)
+  {
+    ASSERT_EQ(analysis.aliases()[n].ind, inputs.at(neurun::graph::operand::IO::Index{n}));
+    ASSERT_EQ(analysis.aliases()[n].parent, output);
+  }
+  ASSERT_EQ(analysis.aliases()[0].offset, 0);
+  ASSERT_EQ(analysis.aliases()[1].offset, 2 * sizeof(float));
+}
+
+TEST(linear_AliasAnalysis, interleaved_concat)
+{
+  Graph graph;
+
+  // Inputs are interleaved over pixels in the output
+  auto operations = buildConcat(graph, 2);
+  AliasAnalysis analysis{graph, operations, [](const Index &, const Index &) { return true; }};
+
+  ASSERT_EQ(analysis.aliases().size(), 0);
+}
+
+TEST(linear_AliasAnalysis, concat_all_or_nothing)
+{
+  Graph graph;
+
+  auto operations = buildConcat(graph, 1);
+  const auto rejected = operations.back()->getInputs().at(neurun::graph::operand::IO::Index{1});
+  AliasAnalysis analysis{graph, operations,
+                         [&](const Index &ind, const Index &) { return ind != rejected; }};
+
+  ASSERT_EQ(analysis.aliases().size(), 0);
+}
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <vector>
+
+#include "graph/Graph.h"
+#include "linear/Linear.h"
+#include "nnfw/std/memory.h"
+#include "../graph/Fixture.h"
+#include "../graph/operation/MockNode.h"
+
+namespace
+{
+
+using Graph = neurun::graph::Graph;
+using IndexSet = neurun::graph::operand::IndexSet;
+using MockNode = neurun_test::graph::operation::SimpleMockNode;
+using neurun_test::graph::addFeature;
+
+} // namespace
+
+TEST(linear_Linear, memory_aware_order)
+{
+  Graph graph;
+
+  // input -> Expand -> big1 -> Reduce -> small1 -> Merge -> output
+  //       -> Expand -> big2 -> Reduce -> small2 ->
+  auto input = addFeature(graph, 1, 1, 8);
+  auto big1 = addFeature(graph, 1, 1, 1024);
+  auto big2 = addFeature(graph, 1, 1, 1024);
+  auto small1 = addFeature(graph, 1, 1, 8);
+  auto small2 = addFeature(graph, 1, 1, 8);
+  auto output = addFeature(graph, 1, 1, 8);
+
+  graph.addInput(input);
+  graph.operands().at(input).setAsModelInput();
+  for (const auto &ind : {big1, big2, small1, small2, output})
+  {
+    graph.operands().at(ind).setAsOperationOutput();
+  }
+  graph.addOutput(output);
+
+  auto expand1 = graph.addOperation(nnfw::make_unique<MockNode>(IndexSet{input}, IndexSet{big1}));
+  auto expand2 = graph.addOperation(nnfw::make_unique<MockNode>(IndexSet{input}, IndexSet{big2}));
+  auto reduce1 = graph.addOperation(nnfw::make_unique<MockNode>(IndexSet{big1}, IndexSet{small1}));
+  auto reduce2 = graph.addOperation(nnfw::make_unique<MockNode>(IndexSet{big2}, IndexSet{small2}));
+  auto merge =
+      graph.addOperation(nnfw::make_unique<MockNode>(IndexSet{small1, small2}, IndexSet{output}));
+
+  graph.finishBuilding();
+
+  neurun_test::graph::lower(graph, neurun_test::graph::makeBackend());
+
+  setenv("NEURUN_LINEARIZE", "MemoryAware", 1);
+  neurun::linear::Linear linear{graph};
+  unsetenv("NEURUN_LINEARIZE");
+
+  std::vector<const neurun::graph::operation::Node *> order;
+  linear.iterate([&](const neurun::graph::operation::Node &node) { order.emplace_back(&node); });
+
+  // Each big operand is released before the other one is defined
+  const std::vector<const neurun::graph::operation::Node *> expected{
+      &graph.operations().at(expand1), &graph.operations().at(reduce1),
+      &graph.operations().at(expand2), &graph.operations().at(reduce2),
+      &graph.operations().at(merge)};
+
+  ASSERT_EQ(order, expected);
+}
+
+TEST(linear_Linear, memory_aware_order_releases_shared_input)
+{
+  Graph graph;
+
+  // input -> Expand -> big -> Split1 -> half1 -> Shrink -> quarter -> Merge -> output
+  //                        -> Split2 -> half2 ----------------------->
+  auto input = addFeature(graph, 1, 1, 2);
+  auto big = addFeature(graph, 1, 1, 256);
+  auto half1 = addFeature(graph, 1, 1, 128);
+  auto half2 = addFeature(graph, 1, 1, 128);
+  auto quarter = addFeature(graph, 1, 1, 64);
+  auto output = addFeature(graph, 1, 1, 2);
+
+  graph.addInput(input);
+  graph.operands().at(input).setAsModelInput();
+  for (const auto &ind : {big, half1, half2, quarter, output})
+  {
+    graph.operands().at(ind).setAsOperationOutput();
+  }
+  graph.addOutput(output);
+
+  auto expand = graph.addOperation(nnfw::make_unique<MockNode>(IndexSet{input}, IndexSet{big}));
+  auto split1 = graph.addOperation(nnfw::make_unique<MockNode>(IndexSet{big}, IndexSet{half1}));
+  auto split2 = graph.addOperation(nnfw::make_unique<MockNode>(IndexSet{big}, IndexSet{half2}));
+  auto shrink =
+      graph.addOperation(nnfw::make_unique<MockNode>(IndexSet{half1}, IndexSet{quarter}));
+  auto merge =
+      graph.addOperation(nnfw::make_unique<MockNode>(IndexSet{half2, quarter}, IndexSet{output}));
+
+  graph.finishBuilding();
+
+  neurun_test::graph::lower(graph, neurun_test::graph::makeBackend());
+
+  setenv("NEURUN_LINEARIZE", "MemoryAware", 1);
+  neurun::linear::Linear linear{graph};
+  unsetenv("NEURUN_LINEARIZE");
+
+  std::vector<const neurun::graph::operation::Node *> order;
+  linear.iterate([&](const neurun::graph::operation::Node &node) { order.emplace_back(&node); });
+
+  // Once Split1 runs, Split2 releases 'big' and so runs before Shrink
+  const std::vector<const neurun::graph::operation::Node *> expected{
+      &graph.operations().at(expand), &graph.operations().at(split1),
+      &graph.operations().at(split2), &graph.operations().at(shrink),
+      &graph.operations().at(merge)};
+
+  ASSERT_EQ(order, expected);
+}
@@ -80,14 +80,23 @@
 #include "internal/layers/SimpleSpaceToDepth.h"
 #include "internal/layers/SimpleEmbeddingLookup.h"
 #include "internal/layers/SquaredDifferenceOperation.h"
+#include "internal/CostModel.h"
 
 #include "util/matrix/IndexIterator.h"
 #include "util/kernel/IndexIterator.h"
 #include "util/feature/IndexIterator.h"
 #include "util/tensor/IndexIterator.h"
+#include "util/profiling/profiling.h"
+#include "util/profiling/OperationCounters.h"
+#include "util/profiling/PhaseReport.h"
+#include "util/profiling/time.h"
 
 #include <nnfw/std/memory.h>
 
+#include <algorithm>
+#include <sstream>
+#include <thread>
+
 #include "compilation.h"
 #include "model.h"
 #include "logging.h"
@@ -3964,6 +3973,10 @@ public:
 public:
   void addStage(const Stage &stage) override;
 
+public:
+  // Set the index of a model operation that subsequent stages come from
+  void setOperation(uint32_t index) { _operation = index; }
+
 public:
   void finalize(void) const;
 
@@ -4000,6 +4013,9 @@ private:
   std::map<int, std::shared_ptr<Subsumption>> _subsumption_ctx;
   std::map<int, Initializer> _initializer_ctx;
   std::vector<Stage> _stages;
+  // Index of a model operation that each stage comes from
+  std::vector<uint32_t> _stage_operations;
+  uint32_t _operation = 0;
 };
 
 void PlanBuilder::addShapeConstr(const ::internal::tflite::operand::Index &ind,
@@ -4022,12 +4038,22 @@ void PlanBuilder::addInitializer(const ::internal::tflite::operand::Index &ind,
   _initializer_ctx[ind.asInt()] = initializer;
 }
 
-void PlanBuilder::addStage(const Stage &stage) { _stages.emplace_back(stage); }
+void PlanBuilder::addStage(const Stage &stage)
+{
+  _stages.emplace_back(stage);
+  _stage_operations.emplace_back(_operation);
+}
 
 #include <stack>
 
 void PlanBuilder::finalize(void) const
 {
+  using nnfw::util::profiling::ScopedPhase;
+
+  auto report = &_plan.report();
+
+  ScopedPhase prepare_phase{report, "prepare"};
+
   // ITensor objects to be initialized later
   std::vector<std::shared_ptr<::arm_compute::ITensor>> tensors;
 
@@ -4144,6 +4170,8 @@ void PlanBuilder::finalize(void) const
       setNETensor(it->first);
   }
 
+  prepare_phase.end();
+
   // Process Stage
   AllocationContext allocation_context{_plan};
   ExecutionBuilder execution_builder{_plan};
@@ -4154,16 +4182,34 @@ void PlanBuilder::finalize(void) const
 #ifdef TFLITE_PROFILING_ENABLED
     int from = execution_builder.plan_op_size();
 #endif
-    stage(allocation_context, execution_builder);
+    {
+      // NOTE Stages configure ACL functions
+      ScopedPhase phase{report, "stages"};
+
+      const auto first = _plan.operations().size();
+      const auto begin_us = tflite::profiling::time::NowMicros();
+      stage(allocation_context, execution_builder);
+      const auto elapsed_us = tflite::profiling::time::NowMicros() - begin_us;
+
+      // Attribute the time (only) to the first function that the stage appends (e.g. "Conv2D")
+      if (_plan.operations().size() > first)
+      {
+        report->add("stages/" + _plan.operations().at(first).name(), elapsed_us, 0);
+      }
+    }
 #ifdef TFLITE_PROFILING_ENABLED
     int to = execution_builder.plan_op_size();
-    execution_builder.addOpIndexToSteps(from, to, idx);
+    execution_builder.addOpIndexToSteps(from, to, _stage_operations[idx]);
 #endif
   }
 
   // Allocate Tensor Memory
+  ScopedPhase allocate_phase{report, "allocate"};
+
   for (const auto &tensor : tensors)
   {
+    report->allocate("allocate", tensor->info()->total_size());
+
     if (::internal::arm_compute::isGpuMode())
     {
       auto cl_tensor = CAST_CL(tensor.get());
@@ -4176,7 +4222,11 @@ void PlanBuilder::finalize(void) const
     }
   }
 
+  allocate_phase.end();
+
   // Fill weight/bias
+  ScopedPhase initialize_phase{report, "initialize"};
+
   for (auto it = _initializer_ctx.begin(); it != _initializer_ctx.end(); ++it)
   {
     const ::internal::tflite::operand::Index operand_index{it->first};
@@ -4402,8 +4452,30 @@ int ANeuralNetworksCompilation_setPreference(ANeuralNetworksCompilation *compila
     return ANEURALNETWORKS_UNEXPECTED_NULL;
   }
 
-  // NOTE Pure CL runimte currently ignores this API call
-  // TODO Use preference
+  if (compilation->isFinished())
+  {
+    return ANEURALNETWORKS_BAD_STATE;
+  }
+
+  // NOTE The preference decides how many cores NEON functions run on. OpenCL kernels run on the
+  //      GPU whatever the preference is.
+  const uint32_t cores = std::max(std::thread::hardware_concurrency(), 1u);
+
+  switch (preference)
+  {
+    case ANEURALNETWORKS_PREFER_LOW_POWER:
+      compilation->plan().threads(1);
+      break;
+    case ANEURALNETWORKS_PREFER_FAST_SINGLE_ANSWER:
+      compilation->plan().threads(0);
+      break;
+    case ANEURALNETWORKS_PREFER_SUSTAINED_SPEED:
+      compilation->plan().threads(std::max(cores / 2, 1u));
+      break;
+    default:
+      return ANEURALNETWORKS_BAD_DATA;
+  }
+
   return ANEURALNETWORKS_NO_ERROR;
 }
 
@@ -4426,13 +4498,39 @@ int ANeuralNetworksCompilation_finish(ANeuralNetworksCompilation *compilation)
 
   PlanBuilder plan_builder{compilation->plan()};
 
-  for (uint32_t n = 0; n < operations.size(); ++n)
+  auto report = &compilation->plan().report();
+
+  {
+    nnfw::util::profiling::ScopedPhase phase{report, "planner"};
+
+    for (uint32_t n = 0; n < operations.size(); ++n)
+    {
+      plan_builder.setOperation(n);
+      operations.at(n).accept(Planner{operands, plan_builder});
+    }
+  }
+
+  // Register the static cost of each operation for the roofline report
+  auto counters = profiling::Context::get().getCounters();
+
+  if (counters != nullptr)
   {
-    operations.at(n).accept(Planner{operands, plan_builder});
+    const auto &signatures = compilation->plan().model().signatures();
+
+    for (uint32_t n = 0; n < signatures.size(); ++n)
+    {
+      counters->cost(n, ::internal::estimate(operands, signatures.at(n)));
+    }
   }
 
   plan_builder.finalize();
 
+  compilation->markAsFinished();
+
+  std::stringstream ss;
+  report->report(ss);
+  VERBOSE(Compilation) << "Time and memory of each phase:" << std::endl << ss.str();
+
   return ANEURALNETWORKS_NO_ERROR;
 }
 
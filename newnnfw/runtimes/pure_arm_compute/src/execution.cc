@@ -20,6 +20,7 @@
 #include "execution.h"
 #include "util/profiling/profiling.h"
 #include "util/profiling/profiler.h"
+#include "util/profiling/OperationCounters.h"
 #include "event.h"
 
 #include "internal/VectorSource.h"
@@ -37,6 +38,7 @@
 #include "util/feature/IndexIterator.h"
 
 #include <arm_compute/runtime/CL/CLScheduler.h>
+#include <arm_compute/runtime/Scheduler.h>
 
 #include <cassert>
 
@@ -523,12 +525,24 @@ int ANeuralNetworksExecution_startCompute(ANeuralNetworksExecution *execution,
     }
   }
 
+  // NOTE The scheduler of NEON functions is shared, so each execution sets the threads its plan
+  //      is compiled for
+  if (!::internal::arm_compute::isGpuMode())
+  {
+    arm_compute::Scheduler::get().set_num_threads(plan.threads());
+  }
+
   const auto &operations = execution->plan().operations();
 
   for (uint32_t n = 0; n < operations.size(); ++n)
   {
     auto prof = profiling::Context::get().getProfiler();
     SCOPED_OPERATOR_PROFILE(prof, operations.at(n).op_idx());
+#ifdef TFLITE_PROFILING_ENABLED
+    // NOTE Steps know their operations only if profiling is enabled
+    nnfw::util::profiling::ScopedOperationCounters counters{
+        profiling::Context::get().getCounters(), static_cast<uint32_t>(operations.at(n).op_idx())};
+#endif
     operations.at(n).run();
 
     if (sync)
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "internal/CostModel.h"
+
+#include <NeuralNetworks.h>
+
+namespace
+{
+
+uint64_t elements(const ::internal::tflite::operand::Object &object)
+{
+  const auto &shape = object.shape();
+
+  uint64_t count = 1;
+
+  for (uint32_t axis = 0; axis < shape.rank(); ++axis)
+  {
+    count *= shape.dim(axis);
+  }
+
+  return count;
+}
+
+uint64_t bytes(const ::internal::tflite::operand::Object &object)
+{
+  const uint64_t element_size = (object.type() == ANEURALNETWORKS_TENSOR_QUANT8_ASYMM) ? 1 : 4;
+
+  return elements(object) * element_size;
+}
+
+} // namespace
+
+namespace internal
+{
+
+nnfw::util::profiling::OperationCost estimate(const ::internal::tflite::operand::Set &operands,
+                                              const ::internal::tflite::op::Signature &signature)
+{
+  using ::internal::tflite::operand::Index;
+
+  nnfw::util::profiling::OperationCost cost{0, 0, 0, 0, 0};
+
+  for (const auto input : signature.inputs)
+  {
+    const auto &object = operands.at(Index{static_cast<int>(input)});
+
+    if (object.hasData())
+    {
+      cost.weight_bytes += bytes(object);
+    }
+    else
+    {
+      cost.input_bytes += bytes(object);
+    }
+  }
+
+  for (const auto output : signature.outputs)
+  {
+    cost.output_bytes += bytes(operands.at(Index{static_cast<int>(output)}));
+  }
+
+  if (signature.outputs.empty())
+  {
+    return cost;
+  }
+
+  const auto &ofm = operands.at(Index{static_cast<int>(signature.outputs.at(0))});
+
+  switch (signature.type)
+  {
+    case ANEURALNETWORKS_CONV_2D:
+    {
+      // NOTE Kernel is of shape [OFM_C, KER_H, KER_W, IFM_C]
+      const auto &ker = operands.at(Index{static_cast<int>(signature.inputs.at(1))}).shape();
+
+      // Each output element accumulates a KER_H x KER_W x IFM_C window
+      cost.macs = elements(ofm) * ker.dim(1) * ker.dim(2) * ker.dim(3);
+      break;
+    }
+    case ANEURALNETWORKS_DEPTHWISE_CONV_2D:
+    {
+      // NOTE Kernel is of shape [1, KER_H, KER_W, IFM_C * MULTIPLIER]
+      const auto &ker = operands.at(Index{static_cast<int>(signature.inputs.at(1))}).shape();
+
+      cost.macs = elements(ofm) * ker.dim(1) * ker.dim(2);
+      break;
+    }
+    case ANEURALNETWORKS_FULLY_CONNECTED:
+    {
+      // NOTE Weight is of shape [NUM_UNITS, INPUT_SIZE]
+      const auto &weight = operands.at(Index{static_cast<int>(signature.inputs.at(1))}).shape();
+
+      cost.macs = elements(ofm) * weight.dim(1);
+      break;
+    }
+    case ANEURALNETWORKS_AVERAGE_POOL_2D:
+    case ANEURALNETWORKS_MAX_POOL_2D:
+    case ANEURALNETWORKS_L2_POOL_2D:
+    {
+      // NOTE Filter width/height are at 4/5 with implicit padding (7 inputs), and at 7/8 with
+      //      explicit padding (10 inputs)
+      const uint32_t base = (signature.inputs.size() == 10) ? 7 : 4;
+
+      const auto fw_index = Index{static_cast<int>(signature.inputs.at(base))};
+      const auto fh_index = Index{static_cast<int>(signature.inputs.at(base + 1))};
+
+      const int32_t fw = operands.at(fw_index).asScalar<int32_t>();
+      const int32_t fh = operands.at(fh_index).asScalar<int32_t>();
+
+      // A comparison or an addition per element of a window
+      cost.ops = elements(ofm) * fw * fh;
+      break;
+    }
+    case ANEURALNETWORKS_ADD:
+    case ANEURALNETWORKS_SUB:
+    case ANEURALNETWORKS_MUL:
+    case ANEURALNETWORKS_DIV:
+    case ANEURALNETWORKS_RELU:
+    case ANEURALNETWORKS_RELU1:
+    case ANEURALNETWORKS_RELU6:
+    case ANEURALNETWORKS_LOGISTIC:
+    case ANEURALNETWORKS_TANH:
+    {
+      cost.ops = elements(ofm);
+      break;
+    }
+    case ANEURALNETWORKS_SOFTMAX:
+    {
+      // max, exp(x - max), sum and division per element
+      cost.ops = elements(ofm) * 4;
+      break;
+    }
+    default:
+      // Data movement only (or not modeled yet)
+      break;
+  }
+
+  return cost;
+}
+
+} // namespace internal
@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2018 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __INTERNAL_COST_MODEL_H__
+#define __INTERNAL_COST_MODEL_H__
+
+#include "internal/Model.h"
+
+#include "util/profiling/Roofline.h"
+
+namespace internal
+{
+
+// Estimates the arithmetic work and the memory traffic of an operation from the shapes of its
+// operands
+//
+// NOTE Every input and output is counted as read or written once, and inputs with data are
+//      counted as weights
+nnfw::util::profiling::OperationCost estimate(const ::internal::tflite::operand::Set &operands,
+                                              const ::internal::tflite::op::Signature &signature);
+
+} // namespace internal
+
+#endif // __INTERNAL_COST_MODEL_H__
@@ -284,6 +284,14 @@ private:
   std::vector<std::unique_ptr<op::Node>> _ops;
 };
 
+// NN API type and operands of an operation, which op::Node keeps only in its own Param
+struct Signature
+{
+  int32_t type;
+  std::vector<uint32_t> inputs;
+  std::vector<uint32_t> outputs;
+};
+
 } // namespace op
 } // namespace tflite
 } // namespace internal
@@ -303,9 +311,15 @@ public:
   op::Sequence &operations(void) { return _operations; }
   const op::Sequence &operations(void) const { return _operations; }
 
+public:
+  // Signature of each operation (in the order of 'operations')
+  std::vector<op::Signature> &signatures(void) { return _signatures; }
+  const std::vector<op::Signature> &signatures(void) const { return _signatures; }
+
 private:
   operand::Set _operands;
   op::Sequence _operations;
+  std::vector<op::Signature> _signatures;
 
 public:
   // TODO Hide these fields
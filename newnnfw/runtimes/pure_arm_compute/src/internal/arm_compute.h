@@ -164,6 +164,8 @@ private:
 } // namepsace arm_compute
 } // namespace internal
 
+#include "util/profiling/PhaseReport.h"
+
 namespace internal
 {
 namespace arm_compute
@@ -188,10 +190,22 @@ public:
   op::Sequence &operations(void) { return _ops; }
   const op::Sequence &operations(void) const { return _ops; }
 
+public:
+  // Time and memory of each phase that has compiled this plan
+  nnfw::util::profiling::PhaseReport &report(void) { return _report; }
+  const nnfw::util::profiling::PhaseReport &report(void) const { return _report; }
+
+public:
+  // Threads that NEON functions of this plan run on (0 means every core)
+  uint32_t threads(void) const { return _threads; }
+  void threads(uint32_t threads) { _threads = threads; }
+
 private:
   std::shared_ptr<const ::internal::tflite::Model> _model;
   operand::Context _operands;
   op::Sequence _ops;
+  nnfw::util::profiling::PhaseReport _report;
+  uint32_t _threads{0};
 };
 
 } // namepsace arm_compute
@@ -679,6 +679,9 @@ int ANeuralNetworksModel_addOperation(ANeuralNetworksModel *model,
       throw std::runtime_error{"Not supported operation"};
   };
 
+  model->deref().signatures().emplace_back(internal::tflite::op::Signature{
+      type, {inputs, inputs + inputCount}, {outputs, outputs + outputCount}});
+
   return ANEURALNETWORKS_NO_ERROR;
 }
 
@@ -782,6 +785,9 @@ int ANeuralNetworksModel_addOperationEx(ANeuralNetworksModel *model,
       throw std::runtime_error{"Not supported operation"};
   }
 
+  model->deref().signatures().emplace_back(internal::tflite::op::Signature{
+      type, {inputs, inputs + inputCount}, {outputs, outputs + outputCount}});
+
   return ANEURALNETWORKS_NO_ERROR;
 }
 
@@ -35,6 +35,7 @@ limitations under the License.
 #include <cstdlib>
 #include <iostream>
 #include <memory>
+#include <sstream>
 #include <string>
 #include <unordered_set>
 #include <vector>
@@ -43,6 +44,7 @@ limitations under the License.
 #include "tensorflow/contrib/lite/model.h"
 #include "tensorflow/contrib/lite/op_resolver.h"
 #include "tensorflow/contrib/lite/string_util.h"
+#include "tensorflow/contrib/lite/schema/schema_generated.h"
 #include "logging.h"
 #include "util/profiling/profiling.h"
 #include "support/tflite/nnapi_delegate.h"
@@ -64,6 +66,7 @@ void ProfilingListener::OnSingleRunStart(RunType run_type) {
   if (run_type == REGULAR) {
     profiler_.Reset();
     profiler_.StartProfiling();
+    counters_.start();
   }
 }
 
@@ -71,10 +74,35 @@ void ProfilingListener::OnBenchmarkEnd(const BenchmarkResults& results) {
   if (has_profiles_) {
     TFLITE_LOG(INFO) << summarizer_.GetOutputString();
   }
+
+  if (profiling::Context::get().getCounters() == &counters_) {
+    auto name = [this](uint32_t index) -> std::string {
+      auto node_reg = interpreter_->node_and_registration(index);
+      if (node_reg == nullptr) {
+        return "Unknown";
+      }
+      const int code = node_reg->second.builtin_code;
+      if (code == tflite::BuiltinOperator_CUSTOM) {
+        const char* custom_name = node_reg->second.custom_name;
+        return custom_name ? custom_name : "UnknownCustomOp";
+      }
+      return tflite::EnumNamesBuiltinOperator()[code];
+    };
+    std::stringstream report;
+    counters_.report(report, name);
+    TFLITE_LOG(INFO) << "Time (us) and hardware counts per run of each operation:"
+                     << std::endl << report.str();
+
+    std::stringstream roofline;
+    counters_.roofline(roofline, name, peak_gflops_, peak_gbps_);
+    TFLITE_LOG(INFO) << "Roofline of each operation:" << std::endl
+                     << roofline.str();
+  }
 }
 
 void ProfilingListener::OnSingleRunEnd() {
   profiler_.StopProfiling();
+  counters_.stop();
   auto profile_events = profiler_.GetProfileEvents();
   has_profiles_ = !profile_events.empty();
   summarizer_.ProcessProfiles(profile_events, *interpreter_);
@@ -188,6 +216,9 @@ BenchmarkParams GetDefaultParams() {
   default_params.AddParam("input_layer_shape",
                           BenchmarkParam::Create<std::string>(""));
   default_params.AddParam("use_nnapi", BenchmarkParam::Create<bool>(false));
+  default_params.AddParam("perf_counters", BenchmarkParam::Create<bool>(false));
+  default_params.AddParam("peak_gflops", BenchmarkParam::Create<float>(0.0f));
+  default_params.AddParam("peak_gbps", BenchmarkParam::Create<float>(0.0f));
   return default_params;
 }
 
@@ -210,7 +241,13 @@ std::vector<Flag> BenchmarkTfLiteModel::GetFlags() {
       CreateFlag<std::string>("input_layer", &params_, "input layer names"),
       CreateFlag<std::string>("input_layer_shape", &params_,
                               "input layer shape"),
-      CreateFlag<bool>("use_nnapi", &params_, "use nnapi api")};
+      CreateFlag<bool>("use_nnapi", &params_, "use nnapi api"),
+      CreateFlag<bool>("perf_counters", &params_,
+                       "report hardware counters per operation (nnapi)"),
+      CreateFlag<float>("peak_gflops", &params_,
+                        "peak compute of the device for the roofline"),
+      CreateFlag<float>("peak_gbps", &params_,
+                        "peak bandwidth of the device for the roofline")};
 
   flags.insert(flags.end(), specific_flags.begin(), specific_flags.end());
   return flags;
@@ -224,6 +261,12 @@ void BenchmarkTfLiteModel::LogFlags() {
   TFLITE_LOG(INFO) << "Input shapes: ["
                    << params_.Get<std::string>("input_layer_shape") << "]";
   TFLITE_LOG(INFO) << "Use nnapi : [" << params_.Get<bool>("use_nnapi") << "]";
+  TFLITE_LOG(INFO) << "Perf counters : [" << params_.Get<bool>("perf_counters")
+                   << "]";
+  TFLITE_LOG(INFO) << "Peak GFLOP/s : [" << params_.Get<float>("peak_gflops")
+                   << "]";
+  TFLITE_LOG(INFO) << "Peak GB/s : [" << params_.Get<float>("peak_gbps")
+                   << "]";
 }
 
 bool BenchmarkTfLiteModel::ValidateFlags() {
@@ -270,6 +313,11 @@ void BenchmarkTfLiteModel::Init() {
   }
   profiling_listener_.SetInterpreter(interpreter.get());
   profiling::Context::get().setProfiler(interpreter->GetProfiler());
+  if (params_.Get<bool>("perf_counters")) {
+    profiling::Context::get().setCounters(profiling_listener_.GetCounters());
+    profiling_listener_.SetPeaks(params_.Get<float>("peak_gflops"),
+                                 params_.Get<float>("peak_gbps"));
+  }
 
   const int32_t num_threads = params_.Get<int32_t>("num_threads");
 
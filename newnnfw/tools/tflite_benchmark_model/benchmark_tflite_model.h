@@ -38,6 +38,7 @@ limitations under the License.
 
 #include "tensorflow/contrib/lite/model.h"
 #include "tensorflow/contrib/lite/profiling/profile_summarizer.h"
+#include "util/profiling/OperationCounters.h"
 #include "benchmark_model.h"
 
 namespace nnfw {
@@ -46,7 +47,11 @@ namespace benchmark {
 // Dumps profiling events if profiling is enabled
 class ProfilingListener : public BenchmarkListener {
  public:
-  explicit ProfilingListener() : interpreter_(nullptr), has_profiles_(false) {}
+  explicit ProfilingListener()
+      : interpreter_(nullptr),
+        has_profiles_(false),
+        peak_gflops_(0.0),
+        peak_gbps_(0.0) {}
 
   void SetInterpreter(tflite::Interpreter* interpreter);
 
@@ -56,11 +61,23 @@ class ProfilingListener : public BenchmarkListener {
 
   void OnBenchmarkEnd(const BenchmarkResults& results) override;
 
+  // Time and hardware counts of each operation, which a runtime measures
+  nnfw::util::profiling::OperationCounters* GetCounters() { return &counters_; }
+
+  // Peak compute and bandwidth of the device, which bound the roofline report
+  void SetPeaks(double peak_gflops, double peak_gbps) {
+    peak_gflops_ = peak_gflops;
+    peak_gbps_ = peak_gbps;
+  }
+
  private:
   tflite::Interpreter* interpreter_;
   tflite::profiling::Profiler profiler_;
   tflite::profiling::ProfileSummarizer summarizer_;
+  nnfw::util::profiling::OperationCounters counters_;
   bool has_profiles_;
+  double peak_gflops_;
+  double peak_gbps_;
 };
 
 // Benchmarks a TFLite model by running tflite interpreter.